@@ -49,8 +49,49 @@ void ActorBase::extraeDibujo (Dibujable * dibujo) {
 }
 
 
+void ActorBase::extraeDibujos (std::vector <Dibujable *> & dibujos) {
+    if (dibujos.empty ()) {
+        return;
+    }
+    std::sort (dibujos.begin (), dibujos.end ());
+    std::erase_if (m_dibujos, [& dibujos] (Dibujable * dibujo) {
+        return std::binary_search (dibujos.begin (), dibujos.end (), dibujo);
+    });
+}
+
+
 void ActorBase::extraeDibujos () {
     m_dibujos.clear ();
+    for (Nodo * raiz : m_nodos) {
+        raiz->m_actor = nullptr;
+        raiz->marca ();
+    }
+    m_nodos.clear ();
+}
+
+
+void ActorBase::agregaNodo (Nodo * raiz) {
+    assert (raiz != nullptr && raiz->m_padre == nullptr && raiz->m_actor == nullptr);
+    raiz->m_actor = this;
+    m_nodos.push_back (raiz);
+    raiz->registra (this);
+    raiz->marca ();
+}
+
+
+void ActorBase::extraeNodo (Nodo * raiz) {
+    assert (raiz != nullptr && raiz->m_actor == this);
+    raiz->retira (this);
+    m_nodos.erase (std::find (m_nodos.begin (), m_nodos.end (), raiz));
+    raiz->m_actor = nullptr;
+    raiz->marca ();
+}
+
+
+void ActorBase::validaNodos () {
+    for (Nodo * raiz : m_nodos) {
+        raiz->calcula (false);
+    }
 }
 
 
@@ -77,8 +118,8 @@ void ActorBase::presenta (Rendidor * rendidor, int indice_z) {
         }
         if (dibujo->indiceZ () == indice_z) {
             presentados ++;
-            if (dibujo->visible ()) {
-                dibujo->dibuja (this->m_transforma, rendidor);
+            if (presentable (dibujo)) {
+                dibujo->dibuja (contenedor (dibujo), rendidor);
             }
         }
 
@@ -99,6 +140,22 @@ void ActorBase::presenta (Rendidor * rendidor, int indice_z) {
 }
 
 
+bool ActorBase::recoge (int indice_z, std::vector <Dibujable *> & recogidos) {
+    // avanza igual que 'presenta' pero recoge los dibujos en lugar de dibujarlos
+    while (this->presentados < this->m_dibujos.size ()) {
+        Dibujable * dibujo = this->m_dibujos [this->presentados];
+        if (dibujo->indiceZ () != indice_z) {
+            break;
+        }
+        presentados ++;
+        if (presentable (dibujo)) {
+            recogidos.push_back (dibujo);
+        }
+    }
+    return presentados == m_dibujos.size ();
+}
+
+
 inline sf::Vertex sfmlVertex (Vector v, sf::Color color) {
     return sf::Vertex {sf::Vector2f {v.x (), v.y ()}, color};
 }
@@ -106,8 +163,8 @@ inline sf::Vertex sfmlVertex (Vector v, sf::Color color) {
 
 void ActorBase::dibujaDiana (Rendidor * rendidor) {
     Vector posc = m_transforma.posicion ();
-    float  sen  = std::sin (m_transforma.rotacion ());
-    float  cos  = std::cos (m_transforma.rotacion ());
+    float  sen  = m_transforma.seno ();
+    float  cos  = m_transforma.coseno ();
     float  lngt = 100;
 
     Vector pnt_1 {      lngt * cos,       lngt * sen};
@@ -127,7 +184,7 @@ void ActorBase::dibujaDiana (Rendidor * rendidor) {
             sfmlVertex (posc + pnt_4, sf::Color::Blue),
     };
 
-    rendidor->window->draw (vertices, dim, sf::Lines);
+    rendidor->dibuja (vertices, dim, sf::Lines, sf::RenderStates::Default, "ActorBase");
 }
 
 
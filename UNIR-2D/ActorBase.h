@@ -74,10 +74,60 @@ namespace unir2d {
         /// @param dibujo elemento a extraer de la lista.
         void extraeDibujo (Dibujable * dibujo);
 
+        /// @brief Extrae varios elementos de la lista contenida en esta instancia.
+        /// @details Recorre la lista una sola vez; conviene más que 'extraeDibujo' para extraer 
+        /// muchos elementos a la vez. No accede a los elementos, que pueden estar ya destruidos.
+        /// @param dibujos elementos a extraer de la lista; el método los reordena.
+        void extraeDibujos (std::vector <Dibujable *> & dibujos);
+
         /// @brief Extrae todos los elementos de la lista de instancias de la clase Dibujable 
         /// contenida en esta instancia.
+        /// @details También extrae las jerarquías de nodos agregadas con 'agregaNodo', que 
+        /// conservan sus dibujables.
         void extraeDibujos ();
 
+        /// @brief Agrega al actor la raíz de una jerarquía de nodos.
+        /// @details Los dibujables de la jerarquía se agregan a la lista del actor y se presentan 
+        /// en la situación de su nodo, relativa a la del actor (véase Nodo). La raíz no debe tener 
+        /// padre ni estar en otro actor.
+        /// @param raiz Raíz de la jerarquía.
+        void agregaNodo (Nodo * raiz);
+
+        /// @brief Extrae del actor una jerarquía de nodos y sus dibujables.
+        /// @param raiz Raíz de la jerarquía.
+        void extraeNodo (Nodo * raiz);
+
+        /// @brief Declara que el actor se puede actualizar en paralelo con otros actores.
+        /// @details Los actores se actualizan, por defecto, en serie y en el orden de la lista del 
+        /// juego. Los actores declarados en paralelo se agrupan por fases: las fases negativas se 
+        /// actualizan antes que los actores en serie y las demás después, en orden creciente. Los 
+        /// actores de una fase se actualizan a la vez en los hilos del servicio de tareas (véase 
+        /// Tareas).<p>
+        /// Los bits de 'lee' y 'escribe' representan el estado compartido entre actores que el 
+        /// actor lee o modifica al actualizarse; el juego decide qué representa cada bit. Dos 
+        /// actores de una fase están en conflicto si uno escribe un bit que el otro lee o escribe. 
+        /// Los actores en conflicto se actualizan en el orden de la lista del juego, de modo que el 
+        /// resultado es el mismo que en serie. El estado propio del actor y sus dibujos no 
+        /// necesitan declararse.<p>
+        /// Al actualizarse en paralelo, el actor no debe crear ni destruir dibujos, ni usar la 
+        /// memoria de ciclo (véase ArenaCiclo), ni agregar ni extraer actores, ni llamar al juego o 
+        /// a otros servicios del motor que modifiquen su estado. Esas acciones se aplazan con el 
+        /// método 'aplaza'.<p>
+        /// El cambio de la declaración tiene efecto en el ciclo siguiente.
+        /// @param fase Fase de la actualización del actor.
+        /// @param lee Bits del estado compartido que el actor lee.
+        /// @param escribe Bits del estado compartido que el actor modifica.
+        void ponActualizaParalelo (int fase, uint32_t lee = 0, uint32_t escribe = 0);
+
+        /// @brief Declara que el actor se actualiza en serie, en el hilo del juego. Es la opción 
+        /// por defecto.
+        /// @details El cambio de la declaración tiene efecto en el ciclo siguiente.
+        void ponActualizaSerie ();
+
+        /// @brief Indica si el actor se actualiza en paralelo.
+        /// @return Si el actor se actualiza en paralelo.
+        bool actualizaParalelo () const;
+
     protected:
 
         /// @brief Constructor.
@@ -111,6 +161,16 @@ namespace unir2d {
 	    /// @param tiempo_seg: tiempo en segundos desde el inicio de la ejecución del juego. 
 	    virtual void actualiza (double tiempo_seg);
 
+        /// @brief Aplaza una acción hasta que se hayan actualizado todos los actores.
+        /// @details Las acciones aplazadas se ejecutan en el hilo del juego, después de actualizar 
+        /// todos los actores y antes de JuegoBase#posactualiza, en el orden de los actores en la 
+        /// lista del juego y, para cada actor, en el orden en que se aplazaron. El orden no depende 
+        /// de los hilos que hayan actualizado a los actores. Las acciones aplazadas pueden agregar 
+        /// y extraer actores; las que aplaza otra acción aplazada se ejecutan en el ciclo 
+        /// siguiente.
+        /// @param accion Acción aplazada.
+        void aplaza (std::function <void ()> accion);
+
         /// @brief Muestra unas marcas en pantalla durante la presentación del actor.
         /// @details Debe usarse solo para depurar errores de programación.
         void ponDiana ();
@@ -119,10 +179,24 @@ namespace unir2d {
 
         Transforma m_transforma {};
         std::vector <Dibujable *> m_dibujos {};   
+        std::vector <Nodo *> m_nodos {};
         int presentados {};
         bool diana {false};
 
+        // actualización en paralelo y acciones aplazadas
+        bool     paralelo {};
+        int      fase {};
+        uint32_t lee {};
+        uint32_t escribe {};
+        // si el actor está en el plan de la actualización en paralelo del ciclo
+        bool     planificado {};
+        std::vector <std::function <void ()>> aplazadas {};
+
         inline static int cuenta_instancias {};
+        // aumenta al cambiar la declaración de cualquier actor, para rehacer el plan de la 
+        // actualización en paralelo; es atómico porque los actores que se actualizan en paralelo 
+        // pueden cambiar su declaración desde un hilo de tareas
+        inline static std::atomic <int> cambios_paralelo {};
 
         // los actores no se pueden copiar ni mover       
         ActorBase (const ActorBase & )              = delete;
@@ -131,11 +205,19 @@ namespace unir2d {
         ActorBase & operator = (ActorBase && )      = delete;
 
         virtual void presenta (Rendidor * rendidor, int z_indice);
+        bool recoge (int z_indice, std::vector <Dibujable *> & recogidos);
+
+        // situación y visibilidad de un dibujo, que dependen de su nodo si lo tiene; antes se 
+        // llama a 'validaNodos'
+        void validaNodos ();
+        const Transforma & contenedor (Dibujable * dibujo) const;
+        bool presentable (Dibujable * dibujo) const;
        
         void dibujaDiana (Rendidor * rendidor);
 
 
         friend class JuegoBase;
+        friend class Nodo;
 
     };
 
@@ -148,6 +230,14 @@ namespace unir2d {
         cuenta_instancias --;
     }
 
+    inline const Transforma & ActorBase::contenedor (Dibujable * dibujo) const {
+        return dibujo->m_nodo != nullptr ? dibujo->m_nodo->m_mundo : m_transforma;
+    }
+
+    inline bool ActorBase::presentable (Dibujable * dibujo) const {
+        return dibujo->visible () && (dibujo->m_nodo == nullptr || dibujo->m_nodo->visible_mundo);
+    }
+
     inline Vector ActorBase::posicion () const {
         return m_transforma.posicion ();
     }
@@ -172,6 +262,27 @@ namespace unir2d {
         diana = true;
     }
 
+    inline void ActorBase::ponActualizaParalelo (int fase, uint32_t lee, uint32_t escribe) {
+        this->paralelo = true;
+        this->fase     = fase;
+        this->lee      = lee;
+        this->escribe  = escribe;
+        cambios_paralelo ++;
+    }
+
+    inline void ActorBase::ponActualizaSerie () {
+        this->paralelo = false;
+        cambios_paralelo ++;
+    }
+
+    inline bool ActorBase::actualizaParalelo () const {
+        return paralelo;
+    }
+
+    inline void ActorBase::aplaza (std::function <void ()> accion) {
+        aplazadas.push_back (std::move (accion));
+    }
+
 
 }
 
@@ -235,4 +346,33 @@ namespace unir2d {
 ///     imagen->seleccionaEstampa (1, indice);
 /// }
 /// @endcode
+/// 
+/// Ejemplo de actualización en paralelo:
+/// @code {.cpp}
+/// // Bits del estado compartido, definidos por el juego.
+/// constexpr uint32_t estadoFeromonas = 1 << 0;
+/// 
+/// // Las hormigas solo leen las feromonas: se actualizan todas a la vez en la fase 0. 
+/// ActorHormiga::ActorHormiga () {
+///     ponActualizaParalelo (0, estadoFeromonas, 0);
+/// }
+/// 
+/// // El rastro modifica las feromonas: en la fase 0, se actualiza después de las hormigas que 
+/// // le preceden en la lista del juego y antes de las que le siguen.
+/// ActorRastro::ActorRastro () {
+///     ponActualizaParalelo (0, 0, estadoFeromonas);
+/// }
+/// 
+/// void ActorHormiga::actualiza (double tiempo_seg) {
+///     avanza (tiempo_seg);
+///     imagen->ponPosicion (posicion_hormiga);
+///     if (alcanzaComida ()) {
+///         // El marcador y la lista de actores se modifican en el hilo del juego.
+///         aplaza ([this] () { 
+///             juego->sumaPunto ();
+///             juego->extraeActor (this);
+///         });
+///     }
+/// }
+/// @endcode
 
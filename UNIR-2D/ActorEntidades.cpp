@@ -0,0 +1,82 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: ActorEntidades.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+
+#include "UNIR-2D.h"
+
+using namespace unir2d;
+
+
+/// @cond
+
+ActorEntidades::ActorEntidades () {
+    m_entidades.alAgregar <DibujoEntidad> ([this] (Entidad, DibujoEntidad & componente) {
+        // la lista no puede contener dibujos pendientes de extraer, quizás ya destruidos, al 
+        // ordenar el nuevo por su índice Z
+        aplicaExtraidos ();
+        agregaDibujo (componente.dibujo);
+    });
+    m_entidades.alQuitar <DibujoEntidad> ([this] (Entidad, DibujoEntidad & componente) {
+        if (en_sistemas) {
+            extraidos.push_back (componente.dibujo);
+        } else {
+            extraeDibujo (componente.dibujo);
+        }
+    });
+}
+
+
+void ActorEntidades::agregaSistema (Sistema sistema) {
+    assert (sistema);
+    sistemas.push_back (std::move (sistema));
+}
+
+
+void ActorEntidades::actualiza (double tiempo_seg) {
+    en_sistemas = true;
+    try {
+        for (Sistema & sistema : sistemas) {
+            sistema (m_entidades, tiempo_seg);
+        }
+    } catch (...) {
+        en_sistemas = false;
+        aplicaExtraidos ();
+        throw;
+    }
+    en_sistemas = false;
+    aplicaExtraidos ();
+}
+
+
+void ActorEntidades::termina () {
+    // se vacía la lista de una vez para no buscar cada dibujo al destruir las entidades
+    extraeDibujos ();
+    extraidos.clear ();
+    m_entidades.vacia ();
+}
+
+
+void ActorEntidades::aplicaExtraidos () {
+    if (extraidos.empty ()) {
+        return;
+    }
+    extraeDibujos (extraidos);
+    extraidos.clear ();
+}
+
+/// @endcond
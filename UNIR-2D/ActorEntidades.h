@@ -0,0 +1,123 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: ActorEntidades.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    /// @brief Componente que asocia un elemento Dibujable a una entidad de un ActorEntidades.
+    /// @details Al agregar este componente a una entidad, el dibujo se agrega a la lista de 
+    /// dibujos del actor, y se extrae de ella al quitar el componente o destruir la entidad. El 
+    /// actor no es propietario del dibujo.<p>
+    /// Los dibujos de los componentes que quitan los sistemas se extraen todos juntos al terminar 
+    /// los sistemas del ciclo, o antes de agregar otro componente de este tipo; así, quitar muchas 
+    /// entidades no recorre la lista de dibujos una vez por cada una.
+    struct DibujoEntidad {
+
+        /// @brief Elemento dibujable de la entidad.
+        Dibujable * dibujo {};
+
+    };
+
+
+    /// @brief Actor que contiene un almacén de Entidades y los sistemas que las actualizan.
+    /// @details Permite programar una parte del juego con entidades y componentes sin abandonar 
+    /// el modelo de actores: el actor se agrega al juego como cualquier otro, y en cada ciclo 
+    /// ejecuta sus sistemas en el orden en que se agregaron. Un sistema es una función que recibe 
+    /// el almacén y el tiempo, y que normalmente usa Entidades#recorre.<p>
+    /// Los demás actores pueden guardar identificadores de Entidad y consultar sus componentes 
+    /// mediante el método ActorEntidades#entidades.
+    class ActorEntidades : public ActorBase {
+    public:
+
+        /// @brief Función que actualiza las entidades.
+        using Sistema = std::function <void (Entidades & entidades, double tiempo_seg)>;
+
+        /// @brief Constructor.
+        explicit ActorEntidades ();
+
+        /// @brief Destructor.
+        ~ActorEntidades () = default;
+
+        /// @brief Obtiene el almacén de entidades del actor.
+        /// @return Almacén de entidades.
+        Entidades & entidades ();
+
+        /// @brief Agrega un sistema, que se ejecuta después de los agregados anteriormente.
+        /// @param sistema Función del sistema.
+        void agregaSistema (Sistema sistema);
+
+    protected:
+
+        /// @brief Ejecuta los sistemas en orden.
+        /// @details Las clases derivadas que sustituyan este método deben llamar al de esta clase.
+        /// @param tiempo_seg: tiempo en segundos desde el inicio de la ejecución del juego. 
+        void actualiza (double tiempo_seg) override;
+
+        /// @brief Destruye todas las entidades.
+        /// @details Las clases derivadas que sustituyan este método deben llamar al de esta clase.
+        void termina () override;
+
+    private:
+
+        Entidades m_entidades {};
+        std::vector <Sistema> sistemas {};
+
+        // dibujos de los componentes quitados mientras se ejecutan los sistemas
+        bool en_sistemas {};
+        std::vector <Dibujable *> extraidos {};
+
+        void aplicaExtraidos ();
+
+    };
+
+
+    inline Entidades & ActorEntidades::entidades () {
+        return m_entidades;
+    }
+
+
+}
+
+
+/// @class unir2d::ActorEntidades
+/// 
+/// Ejemplo de uso:
+/// @code
+/// struct Velocidad { Vector valor; };
+/// 
+/// class ActorLluvia : public ActorEntidades {
+/// protected:
+///     void inicia () override {
+///         for (Circulo & gota : gotas) {
+///             Entidad entidad = entidades ().crea ();
+///             entidades ().agrega <DibujoEntidad> (entidad, & gota);
+///             entidades ().agrega <Velocidad> (entidad, Vector {0, 200});
+///         }
+///         agregaSistema ([] (Entidades & entidades, double tiempo_seg) {
+///             entidades.recorre <Velocidad, DibujoEntidad> (
+///                     [] (Entidad, Velocidad & velocidad, DibujoEntidad & dibujo) {
+///                 dibujo.dibujo->ponPosicion (dibujo.dibujo->posicion () + velocidad.valor / 60);
+///             });
+///         });
+///     }
+/// private:
+///     std::array <Circulo, 500> gotas {};
+/// };
+/// @endcode
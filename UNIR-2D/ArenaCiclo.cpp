@@ -0,0 +1,62 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: ArenaCiclo.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+#include "UNIR-2D.h"
+
+using namespace unir2d;
+
+
+/// @cond
+
+
+void * ArenaCiclo::desborda (size_t bytes, size_t alineacion) {
+    // el primer bloque es el principal; los siguientes son desbordes
+    size_t tamano = bloques.empty () ? capacidadInicial : bloques.back ().tamano * 2;
+    tamano = std::max (tamano, bytes + alineacion);
+    if (! bloques.empty ()) {
+        cuenta_desbordes ++;
+        ocupados_ciclo += bloques.back ().tamano - usados_bloque;
+    }
+    bloques.push_back (Bloque {std::make_unique <std::byte []> (tamano), tamano});
+    usados_bloque = 0;
+    return reserva (bytes, alineacion);
+}
+
+
+void ArenaCiclo::reinicia () {
+    maximo_ocupados = std::max (maximo_ocupados, ocupados_ciclo);
+    if (bloques.size () > 1) {
+        // un único bloque principal que cubre la mayor ocupación
+        size_t tamano = std::bit_ceil (maximo_ocupados);
+        bloques.clear ();
+        bloques.push_back (Bloque {std::make_unique <std::byte []> (tamano), tamano});
+    }
+    usados_bloque  = 0;
+    ocupados_ciclo = 0;
+}
+
+
+void ArenaCiclo::libera () {
+    bloques.clear ();
+    bloques.shrink_to_fit ();
+    usados_bloque  = 0;
+    ocupados_ciclo = 0;
+}
+
+
+/// @endcond
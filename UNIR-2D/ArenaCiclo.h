@@ -0,0 +1,166 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: ArenaCiclo.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    /// @brief Memoria temporal de un ciclo del bucle del juego.
+    /// @details Las reservas de memoria se sirven avanzando un puntero dentro de un bloque; no 
+    /// se liberan de una en una, sino todas juntas cuando la clase Motor termina cada ciclo. Así, 
+    /// los contenedores temporales de un ciclo no usan la memoria dinámica general.<p>
+    /// Si el bloque se agota durante un ciclo, se reservan bloques adicionales. Al terminar el 
+    /// ciclo, el bloque principal crece hasta la mayor ocupación medida, de modo que en los 
+    /// ciclos siguientes no hacen falta más bloques.<p>
+    /// Los contenedores que usan esta memoria (véase AsignadorCiclo, VectorCiclo y CadenaCiclo) 
+    /// no deben sobrevivir al ciclo en que se crean. La clase solo se puede usar desde el hilo del 
+    /// bucle del juego.
+    class ArenaCiclo {
+    public:
+
+        /// @brief Capacidad inicial del bloque principal, en bytes.
+        static constexpr size_t capacidadInicial = 256 * 1024;
+
+        /// @brief Reserva memoria que se libera al terminar el ciclo.
+        /// @param bytes Tamaño de la reserva.
+        /// @param alineacion Alineación de la reserva; debe ser una potencia de 2.
+        /// @return Dirección de la memoria reservada.
+        static void * reserva (size_t bytes, size_t alineacion = alignof (std::max_align_t));
+
+        /// @brief Bytes reservados durante el ciclo en curso.
+        /// @return Bytes reservados.
+        static size_t ocupados ();
+
+        /// @brief Mayor número de bytes reservados en un ciclo.
+        /// @return Bytes reservados.
+        static size_t maximoOcupados ();
+
+        /// @brief Capacidad del bloque principal, en bytes.
+        /// @return Capacidad del bloque.
+        static size_t capacidad ();
+
+        /// @brief Número de bloques adicionales reservados desde el inicio de la ejecución.
+        /// @return Bloques adicionales.
+        static int desbordes ();
+
+    private:
+
+        struct Bloque {
+            std::unique_ptr <std::byte []> datos {};
+            size_t tamano {};
+        };
+
+        // El primer bloque es el principal; los demás se reservan al agotarse el anterior.
+        inline static std::vector <Bloque> bloques {};
+        inline static size_t usados_bloque {};
+        inline static size_t ocupados_ciclo {};
+        inline static size_t maximo_ocupados {};
+        inline static int    cuenta_desbordes {};
+
+        static void * desborda (size_t bytes, size_t alineacion);
+        static void reinicia ();
+        static void libera ();
+
+        friend class Motor;
+
+    };
+
+
+    /// @brief Asignador de memoria compatible con los contenedores de la biblioteca estándar que 
+    /// reserva la memoria en ArenaCiclo.
+    /// @details La liberación de memoria no tiene efecto; la memoria se libera al terminar el 
+    /// ciclo.
+    /// @tparam T Tipo de los elementos.
+    template <typename T>
+    class AsignadorCiclo {
+    public:
+
+        /// @brief Tipo de los elementos.
+        using value_type = T;
+
+        /// @brief Constructor por defecto.
+        AsignadorCiclo () noexcept = default;
+
+        /// @brief Constructor de conversión desde el asignador de otro tipo.
+        template <typename U> 
+        AsignadorCiclo (const AsignadorCiclo <U> & ) noexcept {}
+
+        /// @brief Reserva memoria para 'cuenta' elementos.
+        /// @param cuenta Número de elementos.
+        /// @return Dirección de la memoria reservada.
+        T * allocate (size_t cuenta);
+
+        /// @brief No tiene efecto.
+        void deallocate (T * , size_t ) noexcept {}
+
+        /// @brief Todos los asignadores son intercambiables.
+        template <typename U> 
+        bool operator == (const AsignadorCiclo <U> & ) const noexcept { return true; }
+
+    };
+
+
+    /// @brief Vector con los elementos en la memoria temporal del ciclo.
+    template <typename T>
+    using VectorCiclo = std::vector <T, AsignadorCiclo <T>>;
+
+    /// @brief Cadena de caracteres en la memoria temporal del ciclo.
+    using CadenaCiclo = std::basic_string <char, std::char_traits <char>, AsignadorCiclo <char>>;
+
+    /// @brief Cadena de caracteres anchos en la memoria temporal del ciclo.
+    using CadenaAnchaCiclo = std::basic_string <wchar_t, std::char_traits <wchar_t>, AsignadorCiclo <wchar_t>>;
+
+
+    inline void * ArenaCiclo::reserva (size_t bytes, size_t alineacion) {
+        assert (std::has_single_bit (alineacion));
+        if (! bloques.empty ()) {
+            Bloque & bloque = bloques.back ();
+            size_t inicio = (usados_bloque + alineacion - 1) & ~(alineacion - 1);
+            if (inicio + bytes <= bloque.tamano) {
+                ocupados_ciclo += inicio + bytes - usados_bloque;
+                usados_bloque = inicio + bytes;
+                return bloque.datos.get () + inicio;
+            }
+        }
+        return desborda (bytes, alineacion);
+    }
+
+    inline size_t ArenaCiclo::ocupados () {
+        return ocupados_ciclo;
+    }
+
+    inline size_t ArenaCiclo::maximoOcupados () {
+        return maximo_ocupados;
+    }
+
+    inline size_t ArenaCiclo::capacidad () {
+        return bloques.empty () ? 0 : bloques.front ().tamano;
+    }
+
+    inline int ArenaCiclo::desbordes () {
+        return cuenta_desbordes;
+    }
+
+    template <typename T>
+    inline T * AsignadorCiclo <T>::allocate (size_t cuenta) {
+        return static_cast <T *> (ArenaCiclo::reserva (cuenta * sizeof (T), alignof (T)));
+    }
+
+
+}
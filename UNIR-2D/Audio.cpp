@@ -0,0 +1,203 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: Audio.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+#include "UNIR-2D.h"
+
+using namespace unir2d;
+
+
+/// @cond
+
+
+int Audio::carga (const path & archivo) {
+    string clave = std::filesystem::weakly_canonical (archivo).string ();
+    auto encontrado = indices.find (clave);
+    if (encontrado != indices.end ()) {
+        cargas [encontrado->second]->usos ++;
+        return encontrado->second;
+    }
+    //
+    // se reutiliza el hueco de una carga descargada
+    int sonido = 0;
+    while (sonido < cargas.size () && cargas [sonido] != nullptr) {
+        ++ sonido;
+    }
+    if (sonido == cargas.size ()) {
+        cargas.emplace_back ();
+    }
+    std::unique_ptr <Carga> nueva = std::make_unique <Carga> ();
+    if (! nueva->datos.loadFromFile (archivo.string ())) {
+        throw std::runtime_error {"archivo de carga de Sonido no encontrado: " + archivo.string ()};
+    }
+    nueva->archivo = clave;
+    nueva->usos    = 1;
+    RegistroRecursos::Recurso recurso {};
+    recurso.clase  = ClaseRecurso::sonido;
+    recurso.nombre = archivo.string ();
+    recurso.bytes  = nueva->datos.getSampleCount () * sizeof (sf::Int16);
+    RegistroRecursos::registra (nueva.get (), recurso);
+    cargas [sonido] = std::move (nueva);
+    indices [clave] = sonido;
+    return sonido;
+}
+
+
+void Audio::descarga (int sonido) {
+    assert (sonido >= 0 && sonido < cargas.size () && cargas [sonido] != nullptr);
+    Carga & carga = * cargas [sonido];
+    carga.usos --;
+    if (carga.usos > 0) {
+        return;
+    }
+    if (voces != nullptr) {
+        for (Voz & voz : * voces) {
+            if (voz.carga == sonido) {
+                voz.sonido.stop ();
+                voz.sonido.resetBuffer ();
+                voz.carga = -1;
+            }
+        }
+    }
+    indices.erase (carga.archivo);
+    RegistroRecursos::retira (cargas [sonido].get ());
+    cargas [sonido].reset ();
+}
+
+
+bool Audio::suena (int sonido, int volumen, int prioridad) {
+    assert (sonido >= 0 && sonido < cargas.size () && cargas [sonido] != nullptr);
+    if (voces == nullptr) {
+        voces = std::make_unique <std::array <Voz, totalVoces>> ();
+    }
+    Voz * voz = eligeVoz (sonido, prioridad);
+    if (voz == nullptr) {
+        return false;
+    }
+    voz->sonido.stop ();
+    if (voz->carga != sonido) {
+        voz->sonido.setBuffer (cargas [sonido]->datos);
+        voz->carga = sonido;
+    }
+    voz->prioridad = prioridad;
+    voz->orden     = ++ reproducciones;
+    voz->sonido.setVolume (static_cast <float> (volumen));
+    voz->sonido.play ();
+    return true;
+}
+
+
+Audio::Voz * Audio::eligeVoz (int sonido, int prioridad) {
+    // voz libre; si el sonido ya ocupa 'maxRepeticiones' voces, la más antigua de ellas
+    Voz * libre   = nullptr;
+    Voz * antigua = nullptr;
+    int repeticiones = 0;
+    for (Voz & voz : * voces) {
+        if (voz.sonido.getStatus () != sf::SoundSource::Playing) {
+            // mejor una voz libre que ya tenga el sonido
+            if (libre == nullptr || (voz.carga == sonido && libre->carga != sonido)) {
+                libre = & voz;
+            }
+            continue;
+        }
+        if (voz.carga == sonido) {
+            repeticiones ++;
+            if (antigua == nullptr || voz.orden < antigua->orden) {
+                antigua = & voz;
+            }
+        }
+    }
+    if (repeticiones >= maxRepeticiones) {
+        return antigua;
+    }
+    if (libre != nullptr) {
+        return libre;
+    }
+    //
+    // la reproducción más antigua de menor prioridad
+    Voz * sustituida = nullptr;
+    for (Voz & voz : * voces) {
+        if (voz.prioridad > prioridad) {
+            continue;
+        }
+        if (sustituida == nullptr || voz.prioridad < sustituida->prioridad || 
+            (voz.prioridad == sustituida->prioridad && voz.orden < sustituida->orden)) {
+            sustituida = & voz;
+        }
+    }
+    return sustituida;
+}
+
+
+void Audio::para (int sonido) {
+    if (voces == nullptr) {
+        return;
+    }
+    for (Voz & voz : * voces) {
+        if (voz.carga == sonido) {
+            voz.sonido.stop ();
+        }
+    }
+}
+
+
+void Audio::paraTodo () {
+    if (voces == nullptr) {
+        return;
+    }
+    for (Voz & voz : * voces) {
+        voz.sonido.stop ();
+    }
+}
+
+
+int Audio::vocesOcupadas () {
+    if (voces == nullptr) {
+        return 0;
+    }
+    int ocupadas = 0;
+    for (const Voz & voz : * voces) {
+        if (voz.sonido.getStatus () == sf::SoundSource::Playing) {
+            ocupadas ++;
+        }
+    }
+    return ocupadas;
+}
+
+
+int Audio::sonidosCargados () {
+    return static_cast <int> (indices.size ());
+}
+
+
+size_t Audio::bytesCargados () {
+    size_t bytes = 0;
+    for (const std::unique_ptr <Carga> & carga : cargas) {
+        if (carga != nullptr) {
+            bytes += carga->datos.getSampleCount () * sizeof (sf::Int16);
+        }
+    }
+    return bytes;
+}
+
+
+void Audio::cierra () {
+    voces.reset ();
+}
+
+
+/// @endcond
@@ -0,0 +1,112 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: Audio.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    /// @brief Reproduce los sonidos cortos del juego con un número fijo de voces.
+    /// @details Los archivos de sonido se decodifican una sola vez: todas las cargas del mismo 
+    /// archivo comparten los datos decodificados, que se liberan cuando se descarga la última. 
+    /// Cada reproducción ocupa una de las 'totalVoces' voces, de modo que varias reproducciones 
+    /// del mismo sonido se superponen sin cortarse.<p>
+    /// Si no hay ninguna voz libre, la reproducción sustituye a la reproducción más antigua de 
+    /// menor prioridad. Si todas las voces tienen mayor prioridad, la reproducción no se realiza. 
+    /// Además, un mismo sonido no ocupa más de 'maxRepeticiones' voces; la reproducción más 
+    /// antigua del sonido deja su voz a la nueva.<p>
+    /// La clase Sonido usa esta clase para los sonidos almacenados con Sonido::carga.
+    class Audio {
+    public:
+
+        /// @brief Número de voces.
+        static constexpr int totalVoces = 24;
+
+        /// @brief Número máximo de voces que reproducen a la vez un mismo sonido.
+        static constexpr int maxRepeticiones = 4;
+
+        /// @brief Carga un archivo de sonido, o comparte su carga previa.
+        /// @details No se pueden cargar archivos de tipo mp3. Cada llamada se debe corresponder 
+        /// con una llamada a Audio::descarga.
+        /// @param archivo Archivo de sonido.
+        /// @return Identificador del sonido.
+        static int carga (const path & archivo);
+
+        /// @brief Descarga un sonido.
+        /// @details Con la última descarga de un archivo se detienen sus reproducciones y se 
+        /// liberan sus datos.
+        /// @param sonido Identificador del sonido.
+        static void descarga (int sonido);
+
+        /// @brief Inicia una reproducción del sonido y vuelve inmediatamente.
+        /// @param sonido Identificador del sonido.
+        /// @param volumen Volumen entre 0 y 100.
+        /// @param prioridad Prioridad de la reproducción para ocupar una voz.
+        /// @return Si la reproducción se ha iniciado.
+        static bool suena (int sonido, int volumen = 100, int prioridad = 0);
+
+        /// @brief Detiene todas las reproducciones del sonido.
+        /// @param sonido Identificador del sonido.
+        static void para (int sonido);
+
+        /// @brief Detiene todas las reproducciones.
+        static void paraTodo ();
+
+        /// @brief Número de voces que están reproduciendo.
+        /// @return Voces ocupadas.
+        static int vocesOcupadas ();
+
+        /// @brief Número de archivos de sonido cargados.
+        /// @return Archivos cargados.
+        static int sonidosCargados ();
+
+        /// @brief Memoria ocupada por los datos decodificados de los sonidos.
+        /// @return Bytes de los datos.
+        static size_t bytesCargados ();
+
+    private:
+
+        struct Carga {
+            string          archivo {};
+            sf::SoundBuffer datos {};
+            int             usos {};
+        };
+
+        struct Voz {
+            sf::Sound sonido {};
+            int       carga {-1};
+            int       prioridad {};
+            uint64_t  orden {};
+        };
+
+        // Las cargas se conservan en memoria dinámica porque las voces guardan su dirección.
+        inline static std::vector <std::unique_ptr <Carga>> cargas {};
+        inline static std::unordered_map <string, int> indices {};
+        // Las voces se crean con la primera reproducción y se eliminan con Audio::cierra. 
+        inline static std::unique_ptr <std::array <Voz, totalVoces>> voces {};
+        inline static uint64_t reproducciones {};
+
+        static Voz * eligeVoz (int sonido, int prioridad);
+        static void cierra ();
+
+        friend class Motor;
+
+    };
+
+
+}
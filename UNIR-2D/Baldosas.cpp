@@ -54,10 +54,46 @@ void Baldosas::defineSuperficie (int filas, int columnas) {
 }
 
 
+// Sombreador de fragmentos del modo sombreado. 
+// Las coordenadas de textura del rectángulo están en unidades de baldosa: la parte entera es la
+// posición en la cuadricula de la pantalla y la parte fraccionaria es la posición dentro de la 
+// estampa. El índice de la estampa se codifica en los canales rojo (byte bajo) y verde (byte 
+// alto) de la textura de índices.
+static const char * const fuente_sombreador = R"(
+uniform sampler2D indices;
+uniform sampler2D estampas;
+uniform vec2 superficie;
+uniform vec2 cuadricula;
+void main () {
+    vec2 baldosa = floor (gl_TexCoord[0].xy);
+    vec2 interior = gl_TexCoord[0].xy - baldosa;
+    vec4 codigo = texture2D (indices, (baldosa + 0.5) / superficie);
+    float indice = floor (codigo.r * 255.0 + 0.5) + floor (codigo.g * 255.0 + 0.5) * 256.0;
+    float fila = floor ((indice + 0.5) / cuadricula.x);
+    float coln = indice - fila * cuadricula.x;
+    vec2 texel = (vec2 (coln, fila) + interior) / cuadricula;
+    gl_FragColor = gl_Color * texture2D (estampas, texel);
+}
+)";
+
+
 void Baldosas::mapea (const std::vector <uint32_t> & tabla_indices) {
     int total_superf = filas_baldosas * colns_baldosas;
     assert (tabla_indices.size () == total_superf);
     //
+    this->con_sombreado = false;
+    if (this->solicita_sombreado) {
+        this->con_sombreado = mapeaSombreado (tabla_indices);
+    }
+    if (! this->con_sombreado) {
+        mapeaVertices (tabla_indices);
+    }
+    //
+    this->preparado = true;
+}
+
+
+void Baldosas::mapeaVertices (const std::vector <uint32_t> & tabla_indices) {
     int ancho_estmp = textura->rectg_textura.x / this->colns_estampas;
     int alto__estmp = textura->rectg_textura.y / this->filas_estampas; 
     //
@@ -68,10 +104,6 @@ void Baldosas::mapea (const std::vector <uint32_t> & tabla_indices) {
         for (int j = 0; j < this->colns_baldosas; ++ j) {
             //
             int index_balds = i * colns_baldosas + j;
-            int index_estmp = tabla_indices [index_balds];
-            int coln__estmp = index_estmp % colns_estampas;  // faltaría sumar 1
-            int fila__estmp = index_estmp / colns_estampas;  // faltaría sumar 1
-            //
             int index_vertc = index_balds * 4;
             float izqrd, derch, arrba, abajo; 
             //
@@ -84,32 +116,130 @@ void Baldosas::mapea (const std::vector <uint32_t> & tabla_indices) {
             this->vertices [index_vertc + 2].position = sf::Vector2f (derch, abajo); 
             this->vertices [index_vertc + 3].position = sf::Vector2f (izqrd, abajo); 
             //
-            izqrd = (float) ( coln__estmp      * ancho_estmp);
-            derch = (float) ((coln__estmp + 1) * ancho_estmp); 
-            arrba = (float) ( fila__estmp      * alto__estmp);
-            abajo = (float) ((fila__estmp + 1) * alto__estmp); 
-            this->vertices [index_vertc    ].texCoords = sf::Vector2f (izqrd, arrba);
-            this->vertices [index_vertc + 1].texCoords = sf::Vector2f (derch, arrba);
-            this->vertices [index_vertc + 2].texCoords = sf::Vector2f (derch, abajo);
-            this->vertices [index_vertc + 3].texCoords = sf::Vector2f (izqrd, abajo);
+            colocaEstampa (index_balds, tabla_indices [index_balds]);
         }
     }
+}
+
+
+void Baldosas::colocaEstampa (int index_balds, uint32_t index_estmp) {
+    int ancho_estmp = textura->rectg_textura.x / this->colns_estampas;
+    int alto__estmp = textura->rectg_textura.y / this->filas_estampas; 
+    int coln__estmp = index_estmp % colns_estampas;  // faltaría sumar 1
+    int fila__estmp = index_estmp / colns_estampas;  // faltaría sumar 1
     //
-    this->preparado = true;
+    int index_vertc = index_balds * 4;
+    float izqrd, derch, arrba, abajo; 
+    izqrd = (float) ( coln__estmp      * ancho_estmp);
+    derch = (float) ((coln__estmp + 1) * ancho_estmp); 
+    arrba = (float) ( fila__estmp      * alto__estmp);
+    abajo = (float) ((fila__estmp + 1) * alto__estmp); 
+    this->vertices [index_vertc    ].texCoords = sf::Vector2f (izqrd, arrba);
+    this->vertices [index_vertc + 1].texCoords = sf::Vector2f (derch, arrba);
+    this->vertices [index_vertc + 2].texCoords = sf::Vector2f (derch, abajo);
+    this->vertices [index_vertc + 3].texCoords = sf::Vector2f (izqrd, abajo);
+}
+
+
+bool Baldosas::mapeaSombreado (const std::vector <uint32_t> & tabla_indices) {
+    if (! sf::Shader::isAvailable ()) {
+        return false;
+    }
+    unsigned int maximo = sf::Texture::getMaximumSize ();
+    if ((unsigned int) colns_baldosas > maximo || (unsigned int) filas_baldosas > maximo) {
+        return false;
+    }
+    if (! sombreador_cargado) {
+        sombreador_cargado = sombreador.loadFromMemory (fuente_sombreador, sf::Shader::Fragment);
+        if (! sombreador_cargado) {
+            return false;
+        }
+    }
+    //
+    // la textura de índices tiene un texel para cada elemento de la superficie
+    if (! textura_indices.create (colns_baldosas, filas_baldosas)) {
+        return false;
+    }
+    std::vector <sf::Uint8> texels {};
+    texels.resize (tabla_indices.size () * 4);
+    for (size_t indc = 0; indc < tabla_indices.size (); ++ indc) {
+        assert (tabla_indices [indc] < 0x10000);
+        texels [indc * 4    ] = static_cast <sf::Uint8> (tabla_indices [indc]      & 0xFF);
+        texels [indc * 4 + 1] = static_cast <sf::Uint8> (tabla_indices [indc] >> 8 & 0xFF);
+        texels [indc * 4 + 2] = 0;
+        texels [indc * 4 + 3] = 0xFF;
+    }
+    textura_indices.update (texels.data ());
+    //
+    // un único rectángulo cubre toda la superficie
+    float ancho = (float) (textura->rectg_textura.x / this->colns_estampas * colns_baldosas);
+    float alto  = (float) (textura->rectg_textura.y / this->filas_estampas * filas_baldosas);
+    float colns = (float) colns_baldosas;
+    float filas = (float) filas_baldosas;
+    this->vertices.setPrimitiveType (sf::Quads);
+    this->vertices.resize (4);
+    this->vertices [0] = sf::Vertex {sf::Vector2f (0,     0),    sf::Vector2f (0,     0)};
+    this->vertices [1] = sf::Vertex {sf::Vector2f (ancho, 0),    sf::Vector2f (colns, 0)};
+    this->vertices [2] = sf::Vertex {sf::Vector2f (ancho, alto), sf::Vector2f (colns, filas)};
+    this->vertices [3] = sf::Vertex {sf::Vector2f (0,     alto), sf::Vector2f (0,     filas)};
+    //
+    sombreador.setUniform ("indices",    textura_indices);
+    sombreador.setUniform ("superficie", sf::Glsl::Vec2 {colns, filas});
+    sombreador.setUniform ("cuadricula", sf::Glsl::Vec2 {(float) colns_estampas, (float) filas_estampas});
+    return true;
+}
+
+
+void Baldosas::remapea (int fila, int columna, uint32_t indice) {
+    assert (this->preparado);
+    assert (0 <= fila    && fila    < filas_baldosas);
+    assert (0 <= columna && columna < colns_baldosas);
+    //
+    if (this->con_sombreado) {
+        assert (indice < 0x10000);
+        sf::Uint8 texel [4] {
+                static_cast <sf::Uint8> (indice      & 0xFF), 
+                static_cast <sf::Uint8> (indice >> 8 & 0xFF), 
+                0, 0xFF };
+        textura_indices.update (texel, 1, 1, columna, fila);
+    } else {
+        colocaEstampa (fila * colns_baldosas + columna, indice);
+    }
 }
 
 
 void Baldosas::dibuja (const Transforma & contenedor, Rendidor * rendidor) {
     assert (this->preparado);
 	//
-    sf::Transformable objeto {};
-	Dibujable::situa (objeto, contenedor, this->m_transforma);
-	//
     sf::RenderStates states {};
-    states.transform = objeto.getTransform ();
-    states.texture = & textura->entidad ();
+    states.transform = situa (contenedor);
+    if (this->con_sombreado) {
+        // sin textura en 'states' las coordenadas de textura llegan sin normalizar al sombreador
+        sombreador.setUniform ("estampas", textura->entidad ());
+        states.shader = & sombreador;
+    } else {
+        states.texture = & textura->entidad ();
+    }
     //
-	rendidor->window->draw (this->vertices, states);
+    const sf::Texture * estampas = this->con_sombreado ? & textura->entidad () : states.texture;
+	rendidor->dibuja (this->vertices, states, "Baldosas", this->vertices.getVertexCount (), estampas);
 }
 
 
+Dibujable::ClaveEstado Baldosas::claveEstado () const {
+    if (this->con_sombreado) {
+        return ClaveEstado {this->textura, & this->sombreador, sf::Quads};
+    }
+    return ClaveEstado {this->textura, nullptr, sf::Quads};
+}
+
+
+bool Baldosas::limitesPantalla (const Transforma & contenedor, sf::FloatRect & limites) {
+    if (this->textura == nullptr) {
+        return false;
+    }
+    float ancho = (float) (textura->rectg_textura.x / this->colns_estampas * colns_baldosas);
+    float alto  = (float) (textura->rectg_textura.y / this->filas_estampas * filas_baldosas);
+    limites = situa (contenedor).transformRect (sf::FloatRect {0, 0, ancho, alto});
+    return true;
+}
@@ -25,7 +25,12 @@ namespace unir2d {
 	/// parte de un actor del juego (usando una clase derivada de ActorBase).<p>
     /// El conjunto de imágenes debe estar cargado en memoria mediante una instancia de la clase 
     /// Textura. Esta clase establece un mapeo entre las posiciones de la superficie a cubrir y las 
-    /// subimágenes (o estampas) de la textura.
+    /// subimágenes (o estampas) de la textura.<p>
+    /// Por defecto, las baldosas se presentan con cuatro vértices para cada elemento de la 
+    /// superficie. Si se activa el modo sombreado (véase ponSombreado()), la superficie se 
+    /// presenta con un único rectángulo y un sombreador de fragmentos toma la estampa de cada 
+    /// elemento de una pequeña textura de índices. En ese modo el coste de presentación no depende 
+    /// del tamaño de la superficie.
     class Baldosas : public Dibujable {
     public:
 
@@ -74,6 +79,26 @@ namespace unir2d {
         /// posición de destino.
         void mapea (const std::vector <uint32_t> & tabla_indices);
 
+        /// @brief Cambia la estampa colocada en una posición de la superficie cubierta.
+        /// @details Debe haberse llamado antes al método mapea(). En el modo sombreado solo se 
+        /// actualiza un texel de la textura de índices.
+        /// @param fila Fila en la cuadricula de la pantalla, a partir de 0.
+        /// @param columna Columna en la cuadricula de la pantalla, a partir de 0.
+        /// @param indice Posición de la estampa en la cuadricula de estampas, con el mismo valor 
+        /// que los elementos de 'tabla_indices' en el método mapea().
+        void remapea (int fila, int columna, uint32_t indice);
+
+        /// @brief Indica si se ha solicitado el modo sombreado.
+        /// @return Si se ha solicitado el modo sombreado.
+        bool sombreado () const;
+
+        /// @brief Solicita el modo sombreado o el modo por vértices.
+        /// @details El modo se aplica en la siguiente llamada al método mapea(). Si el sistema 
+        /// no admite sombreadores, o la superficie es demasiado grande para la textura de índices, 
+        /// se usa el modo por vértices.
+        /// @param valor Si se usa el modo sombreado.
+        void ponSombreado (bool valor);
+
     private:
 
         Textura * textura {};
@@ -87,15 +112,38 @@ namespace unir2d {
         bool preparado {};
         sf::VertexArray vertices {};
 
+        // modo sombreado
+        bool solicita_sombreado {false};
+        bool con_sombreado {false};
+        sf::Texture textura_indices {};
+        sf::Shader  sombreador {};
+        bool        sombreador_cargado {false};
+
         // las baldosas no se pueden copiar ni mover       
         Baldosas (const Baldosas & )              = delete;
         Baldosas (Baldosas && )                   = delete;
         Baldosas & operator = (const Baldosas & ) = delete;
         Baldosas & operator = (Baldosas && )      = delete;
         
+        void mapeaVertices   (const std::vector <uint32_t> & tabla_indices);
+        bool mapeaSombreado  (const std::vector <uint32_t> & tabla_indices);
+        void colocaEstampa   (int index_balds, uint32_t index_estmp);
+
         void dibuja (const Transforma & contenedor, Rendidor * rendidor) override;
+        ClaveEstado claveEstado () const override;
+        bool limitesPantalla (const Transforma & contenedor, sf::FloatRect & limites) override;
 
     };
 
 
+    inline bool Baldosas::sombreado () const {
+        return solicita_sombreado;
+    }
+
+    inline void Baldosas::ponSombreado (bool valor) {
+        solicita_sombreado = valor;
+        preparado = false;
+    }
+
+
 }
\ No newline at end of file
@@ -0,0 +1,204 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: CapturaFotogramas.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+#include "UNIR-2D.h"
+
+using namespace unir2d;
+
+
+/// @cond
+
+
+CapturaFotogramas::CapturaFotogramas (
+        const std::filesystem::path & directorio, FormatoCaptura formato, int ciclos_captura) {
+    assert (ciclos_captura >= 1);
+    this->directorio     = directorio;
+    this->formato        = formato;
+    this->ciclos_captura = ciclos_captura;
+    std::filesystem::create_directories (directorio);
+    escritor = std::thread {& CapturaFotogramas::escribe, this};
+}
+
+
+CapturaFotogramas::~CapturaFotogramas () {
+    // las texturas pendientes de leer se leen antes de terminar el hilo de escritura
+    for (int indice = 0; indice < texturas; ++ indice) {
+        Pendiente & pendiente = anillo [(siguiente_textura + indice) % texturas];
+        if (pendiente.ocupada) {
+            lee (pendiente);
+        }
+    }
+    {
+        std::lock_guard <std::mutex> bloqueo {cerrojo};
+        terminar = true;
+    }
+    aviso.notify_one ();
+    escritor.join ();
+    if (descartadas > 0) {
+        std::cout << "Captura: " << descartadas << " ciclos descartados.\n";
+    }
+}
+
+
+void CapturaFotogramas::toma (sf::RenderWindow * window) {
+    ciclo ++;
+    //
+    // lee las texturas copiadas hace 'retraso' ciclos o más
+    for (Pendiente & pendiente : anillo) {
+        if (pendiente.ocupada && ciclo - pendiente.ciclo >= retraso) {
+            lee (pendiente);
+        }
+    }
+    if ((ciclo - 1) % ciclos_captura != 0) {
+        return;
+    }
+    //
+    // copia la ventana en la siguiente textura del anillo; si está ocupada, se lee antes
+    Pendiente & pendiente = anillo [siguiente_textura];
+    siguiente_textura = (siguiente_textura + 1) % texturas;
+    if (pendiente.ocupada) {
+        lee (pendiente);
+    }
+    sf::Vector2u tamano = window->getSize ();
+    if (pendiente.textura.getSize () != tamano) {
+        if (! pendiente.textura.create (tamano.x, tamano.y)) {
+            descartadas ++;
+            return;
+        }
+    }
+    pendiente.textura.update (* window);
+    pendiente.ciclo   = ciclo;
+    pendiente.ocupada = true;
+}
+
+
+void CapturaFotogramas::lee (Pendiente & pendiente) {
+    pendiente.ocupada = false;
+    {
+        std::lock_guard <std::mutex> bloqueo {cerrojo};
+        if (cola.size () >= max_cola) {
+            descartadas ++;
+            return;
+        }
+    }
+    Encargo encargo {numero_captura ++, pendiente.textura.copyToImage ()};
+    {
+        std::lock_guard <std::mutex> bloqueo {cerrojo};
+        cola.push_back (std::move (encargo));
+    }
+    aviso.notify_one ();
+}
+
+
+void CapturaFotogramas::escribe () {
+    const char * extension = formato == FormatoCaptura::png ? ".png" : ".qoi";
+    while (true) {
+        Encargo encargo {};
+        {
+            std::unique_lock <std::mutex> bloqueo {cerrojo};
+            aviso.wait (bloqueo, [this] () { return terminar || ! cola.empty (); });
+            if (cola.empty ()) {
+                return;
+            }
+            encargo = std::move (cola.front ());
+            cola.pop_front ();
+        }
+        char nombre [32];
+        std::snprintf (nombre, sizeof (nombre), "ciclo_%06d%s", encargo.numero, extension);
+        std::filesystem::path camino = directorio / nombre;
+        bool escrito = formato == FormatoCaptura::png ? 
+                encargo.imagen.saveToFile (camino.string ()) : 
+                escribeQoi (camino, encargo.imagen);
+        if (! escrito) {
+            std::cerr << "Captura: no se ha podido escribir " << camino.string () << "\n";
+        }
+    }
+}
+
+
+// Formato QOI: https://qoiformat.org/qoi-specification.pdf
+bool CapturaFotogramas::escribeQoi (const std::filesystem::path & camino, const sf::Image & imagen) {
+    sf::Vector2u tamano = imagen.getSize ();
+    const uint8_t * pixeles = imagen.getPixelsPtr ();
+    size_t cuenta = (size_t)tamano.x * tamano.y;
+    //
+    std::vector <uint8_t> datos {};
+    datos.reserve (14 + cuenta * 5 + 8);
+    auto escribe32 = [& datos] (uint32_t valor) {
+        datos.push_back ((uint8_t)(valor >> 24));
+        datos.push_back ((uint8_t)(valor >> 16));
+        datos.push_back ((uint8_t)(valor >> 8));
+        datos.push_back ((uint8_t)valor);
+    };
+    datos.insert (datos.end (), {'q', 'o', 'i', 'f'});
+    escribe32 (tamano.x);
+    escribe32 (tamano.y);
+    datos.push_back (4);    // RGBA
+    datos.push_back (0);    // sRGB
+    //
+    uint8_t vistos [64][4] {};
+    uint8_t previo [4] {0, 0, 0, 255};
+    int repeticiones = 0;
+    for (size_t indice = 0; indice < cuenta; ++ indice) {
+        const uint8_t * pixel = pixeles + indice * 4;
+        if (std::memcmp (pixel, previo, 4) == 0) {
+            repeticiones ++;
+            if (repeticiones == 62 || indice == cuenta - 1) {
+                datos.push_back ((uint8_t)(0xC0 | (repeticiones - 1)));
+                repeticiones = 0;
+            }
+            continue;
+        }
+        if (repeticiones > 0) {
+            datos.push_back ((uint8_t)(0xC0 | (repeticiones - 1)));
+            repeticiones = 0;
+        }
+        int posicion = (pixel [0] * 3 + pixel [1] * 5 + pixel [2] * 7 + pixel [3] * 11) % 64;
+        if (std::memcmp (vistos [posicion], pixel, 4) == 0) {
+            datos.push_back ((uint8_t)posicion);
+        } else {
+            std::memcpy (vistos [posicion], pixel, 4);
+            if (pixel [3] == previo [3]) {
+                int8_t dr = (int8_t)(pixel [0] - previo [0]);
+                int8_t dg = (int8_t)(pixel [1] - previo [1]);
+                int8_t db = (int8_t)(pixel [2] - previo [2]);
+                int8_t dr_dg = (int8_t)(dr - dg);
+                int8_t db_dg = (int8_t)(db - dg);
+                if (dr > -3 && dr < 2 && dg > -3 && dg < 2 && db > -3 && db < 2) {
+                    datos.push_back ((uint8_t)(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2)));
+                } else if (dg > -33 && dg < 32 && dr_dg > -9 && dr_dg < 8 && db_dg > -9 && db_dg < 8) {
+                    datos.push_back ((uint8_t)(0x80 | (dg + 32)));
+                    datos.push_back ((uint8_t)((dr_dg + 8) << 4 | (db_dg + 8)));
+                } else {
+                    datos.insert (datos.end (), {0xFE, pixel [0], pixel [1], pixel [2]});
+                }
+            } else {
+                datos.insert (datos.end (), {0xFF, pixel [0], pixel [1], pixel [2], pixel [3]});
+            }
+        }
+        std::memcpy (previo, pixel, 4);
+    }
+    datos.insert (datos.end (), {0, 0, 0, 0, 0, 0, 0, 1});
+    //
+    std::ofstream archivo {camino, std::ios::binary};
+    archivo.write ((const char *)datos.data (), (std::streamsize)datos.size ());
+    return (bool)archivo;
+}
+
+
+/// @endcond
@@ -0,0 +1,102 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: CapturaFotogramas.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    /// @enum FormatoCaptura
+    /// @brief Formato de los archivos de imagen escritos al capturar la ejecución del juego.
+    /// @details Véase Motor::iniciaCaptura.
+    enum class FormatoCaptura {
+        /// @brief Archivos PNG, con compresión, más lentos de escribir.
+        png,
+        /// @brief Archivos QOI (Quite OK Image), con compresión sencilla, rápidos de escribir.
+        qoi
+    };
+
+
+    /// @cond
+
+
+    // Captura los ciclos del juego en una secuencia de archivos de imagen numerados sin detener 
+    // el bucle de juego. Cada ciclo capturado se copia de la ventana a una textura de un anillo, 
+    // en la tarjeta gráfica; la textura se lee 'retraso' ciclos después, cuando la tarjeta ya ha 
+    // terminado de dibujar, y la imagen leída pasa a un hilo que escribe los archivos. Si el hilo 
+    // no da abasto, se descartan las capturas que no caben en la cola.
+    class CapturaFotogramas {
+    private:
+
+        static constexpr int texturas = 3;
+        static constexpr int retraso  = 2;
+        static constexpr int max_cola = 8;
+
+        struct Pendiente {
+            sf::Texture textura {};
+            long        ciclo {};
+            bool        ocupada {};
+        };
+
+        struct Encargo {
+            int       numero {};
+            sf::Image imagen {};
+        };
+
+        std::filesystem::path directorio {};
+        FormatoCaptura        formato {};
+        int                   ciclos_captura {};
+
+        long ciclo {};
+        int  siguiente_textura {};
+        int  numero_captura {};
+        int  descartadas {};
+        std::array <Pendiente, texturas> anillo;
+
+        std::mutex              cerrojo {};
+        std::condition_variable aviso {};
+        std::deque <Encargo>    cola {};
+        bool                    terminar {};
+        std::thread             escritor {};
+
+        explicit CapturaFotogramas (
+                const std::filesystem::path & directorio, FormatoCaptura formato, int ciclos_captura);
+        ~CapturaFotogramas ();
+
+        // No se pueden copiar ni mover las instancias de esta clase      
+        CapturaFotogramas (const CapturaFotogramas & )              = delete;
+        CapturaFotogramas (CapturaFotogramas && )                   = delete;
+        CapturaFotogramas & operator = (const CapturaFotogramas & ) = delete;
+        CapturaFotogramas & operator = (CapturaFotogramas && )      = delete;
+
+        void toma (sf::RenderWindow * window);
+        void lee (Pendiente & pendiente);
+        void escribe ();
+
+        static bool escribeQoi (const std::filesystem::path & camino, const sf::Image & imagen);
+
+        friend class Motor;
+        friend class Rendidor;
+
+    };
+
+
+    /// @endcond
+
+
+}
@@ -21,8 +21,20 @@ using namespace unir2d;
 
 
 void Circulo::dibuja (const Transforma & contenedor, Rendidor * rendidor) {
-	Dibujable::situa (this->shape, contenedor, this->m_transforma);
-	rendidor->window->draw (this->shape);
+	sf::RenderStates states {};
+	states.transform = situa (contenedor);
+	rendidor->dibuja (this->shape, states, "Circulo", verticesFigura (this->shape), nullptr);
 }
 
-	
\ No newline at end of file
+	
+
+
+Dibujable::ClaveEstado Circulo::claveEstado () const {
+	return ClaveEstado {nullptr, nullptr, sf::TriangleFan};
+}
+
+
+bool Circulo::limitesPantalla (const Transforma & contenedor, sf::FloatRect & limites) {
+	limites = situa (contenedor).transformRect (this->shape.getLocalBounds ());
+	return true;
+}
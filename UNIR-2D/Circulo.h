@@ -74,6 +74,8 @@ namespace unir2d {
 		void prepara ();
 
 		void dibuja (const Transforma & contenedor, Rendidor * rendidor) override;
+		ClaveEstado claveEstado () const override;
+		bool limitesPantalla (const Transforma & contenedor, sf::FloatRect & limites) override;
 
 	};
 
@@ -93,6 +95,7 @@ namespace unir2d {
 	inline void Circulo::ponRadio (float valor) {
 		m_radio = valor;
 		shape.setRadius (m_radio);
+		Estadisticas::cuentaReconstruccion ("Circulo");
 	}
 
 	inline RellenoFigura Circulo::relleno () {
@@ -125,6 +128,8 @@ namespace unir2d {
 			shape.setFillColor    (sf::Color {m_color.entero ()});
 			break;
 		}
+		// en los dos casos SFML escribe de nuevo los vértices de la figura
+		Estadisticas::cuentaReconstruccion ("Circulo");
 	}
 
 }
\ No newline at end of file
@@ -0,0 +1,401 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: Colisiones.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+#include "UNIR-2D.h"
+
+using namespace unir2d;
+
+
+/// @cond
+
+
+Colisiones::Colisiones (float tamano_celda) {
+    assert (tamano_celda > 0.0f);
+    inverso_celda = 1.0f / tamano_celda;
+}
+
+
+int Colisiones::agregaCirculo (Vector centro, float radio, uint32_t capa, uint32_t mascara) {
+    assert (radio >= 0.0f);
+    Cuerpo cuerpo {};
+    cuerpo.forma     = FormaColision::circulo;
+    cuerpo.capa      = capa;
+    cuerpo.mascara   = mascara;
+    cuerpo.centro_x  = centro.x ();
+    cuerpo.centro_y  = centro.y ();
+    cuerpo.semieje_x = radio;
+    cuerpo.semieje_y = radio;
+    return agrega (cuerpo);
+}
+
+
+int Colisiones::agregaCaja (Vector centro, Vector tamano, uint32_t capa, uint32_t mascara) {
+    Cuerpo cuerpo {};
+    cuerpo.forma     = FormaColision::caja;
+    cuerpo.capa      = capa;
+    cuerpo.mascara   = mascara;
+    cuerpo.centro_x  = centro.x ();
+    cuerpo.centro_y  = centro.y ();
+    cuerpo.semieje_x = 0.5f * std::abs (tamano.x ());
+    cuerpo.semieje_y = 0.5f * std::abs (tamano.y ());
+    return agrega (cuerpo);
+}
+
+
+int Colisiones::agregaRectangulo (
+        Vector centro, Vector tamano, float rotacion, uint32_t capa, uint32_t mascara) {
+    Cuerpo cuerpo {};
+    cuerpo.forma     = FormaColision::rectangulo;
+    cuerpo.capa      = capa;
+    cuerpo.mascara   = mascara;
+    cuerpo.centro_x  = centro.x ();
+    cuerpo.centro_y  = centro.y ();
+    cuerpo.semieje_x = 0.5f * std::abs (tamano.x ());
+    cuerpo.semieje_y = 0.5f * std::abs (tamano.y ());
+    cuerpo.eje_x     = std::cos (rotacion);
+    cuerpo.eje_y     = std::sin (rotacion);
+    return agrega (cuerpo);
+}
+
+
+int Colisiones::agregaSegmento (Vector extremo_1, Vector extremo_2, uint32_t capa, uint32_t mascara) {
+    Cuerpo cuerpo {};
+    cuerpo.forma   = FormaColision::segmento;
+    cuerpo.capa    = capa;
+    cuerpo.mascara = mascara;
+    int indice = agrega (cuerpo);
+    ponExtremos (indice, extremo_1, extremo_2);
+    return indice;
+}
+
+
+int Colisiones::agrega (const Cuerpo & cuerpo) {
+    int indice;
+    if (libres.empty ()) {
+        indice = static_cast <int> (cuerpos.size ());
+        cuerpos.push_back (cuerpo);
+    } else {
+        indice = libres.back ();
+        libres.pop_back ();
+        cuerpos [indice] = cuerpo;
+    }
+    cuerpos [indice].vivo = true;
+    limita (cuerpos [indice]);
+    cuenta_vivos ++;
+    return indice;
+}
+
+
+void Colisiones::retira (int cuerpo) {
+    assert (cuerpo >= 0 && cuerpo < cuerpos.size () && cuerpos [cuerpo].vivo);
+    cuerpos [cuerpo].vivo = false;
+    libres.push_back (cuerpo);
+    cuenta_vivos --;
+}
+
+
+void Colisiones::vacia () {
+    cuerpos.clear ();
+    libres.clear ();
+    lista_contactos.clear ();
+    cuenta_vivos = 0;
+}
+
+
+void Colisiones::mueve (int cuerpo, Vector centro) {
+    assert (cuerpo >= 0 && cuerpo < cuerpos.size () && cuerpos [cuerpo].vivo);
+    Cuerpo & datos = cuerpos [cuerpo];
+    datos.centro_x = centro.x ();
+    datos.centro_y = centro.y ();
+    limita (datos);
+}
+
+
+void Colisiones::gira (int cuerpo, float rotacion) {
+    assert (cuerpo >= 0 && cuerpo < cuerpos.size () && cuerpos [cuerpo].vivo);
+    Cuerpo & datos = cuerpos [cuerpo];
+    assert (datos.forma == FormaColision::rectangulo || datos.forma == FormaColision::segmento);
+    datos.eje_x = std::cos (rotacion);
+    datos.eje_y = std::sin (rotacion);
+    limita (datos);
+}
+
+
+void Colisiones::ponExtremos (int cuerpo, Vector extremo_1, Vector extremo_2) {
+    assert (cuerpo >= 0 && cuerpo < cuerpos.size () && cuerpos [cuerpo].vivo);
+    Cuerpo & datos = cuerpos [cuerpo];
+    assert (datos.forma == FormaColision::segmento);
+    Vector medio = 0.5f * (extremo_1 + extremo_2);
+    Vector direccion = extremo_2 - extremo_1;
+    float longitud = norma (direccion);
+    datos.centro_x  = medio.x ();
+    datos.centro_y  = medio.y ();
+    datos.semieje_x = 0.5f * longitud;
+    datos.semieje_y = 0.0f;
+    datos.eje_x     = longitud > 0.0f ? direccion.x () / longitud : 1.0f;
+    datos.eje_y     = longitud > 0.0f ? direccion.y () / longitud : 0.0f;
+    limita (datos);
+}
+
+
+void Colisiones::ponCapas (int cuerpo, uint32_t capa, uint32_t mascara) {
+    assert (cuerpo >= 0 && cuerpo < cuerpos.size () && cuerpos [cuerpo].vivo);
+    cuerpos [cuerpo].capa    = capa;
+    cuerpos [cuerpo].mascara = mascara;
+}
+
+
+void Colisiones::limita (Cuerpo & cuerpo) {
+    // proyección de los semiejes sobre los ejes de la pantalla
+    float extension_x = cuerpo.semieje_x * std::abs (cuerpo.eje_x) + cuerpo.semieje_y * std::abs (cuerpo.eje_y);
+    float extension_y = cuerpo.semieje_x * std::abs (cuerpo.eje_y) + cuerpo.semieje_y * std::abs (cuerpo.eje_x);
+    cuerpo.min_x = cuerpo.centro_x - extension_x;
+    cuerpo.max_x = cuerpo.centro_x + extension_x;
+    cuerpo.min_y = cuerpo.centro_y - extension_y;
+    cuerpo.max_y = cuerpo.centro_y + extension_y;
+}
+
+
+int32_t Colisiones::celda (float coordenada) const {
+    // redondeo hacia abajo, sin llamar a 'std::floor'
+    float escalada = coordenada * inverso_celda;
+    int32_t truncada = static_cast <int32_t> (escalada);
+    return escalada < static_cast <float> (truncada) ? truncada - 1 : truncada;
+}
+
+
+uint32_t Colisiones::cubeta (int32_t celda_x, int32_t celda_y) const {
+    uint32_t clave = static_cast <uint32_t> (celda_x) * 73856093u ^ static_cast <uint32_t> (celda_y) * 19349663u;
+    return clave & static_cast <uint32_t> (inicios.size () - 2);
+}
+
+
+void Colisiones::calcula () {
+    lista_contactos.clear ();
+    //
+    // Cuenta las celdas ocupadas por cada cuerpo. El número de cubetas es una potencia de 2, 
+    // al menos el doble que el de celdas ocupadas.
+    size_t total = 0;
+    for (const Cuerpo & cuerpo : cuerpos) {
+        if (cuerpo.vivo) {
+            size_t ancho = static_cast <size_t> (celda (cuerpo.max_x) - celda (cuerpo.min_x)) + 1;
+            size_t alto  = static_cast <size_t> (celda (cuerpo.max_y) - celda (cuerpo.min_y)) + 1;
+            total += ancho * alto;
+        }
+    }
+    size_t cuenta_cubetas = std::bit_ceil (std::max (total * 2, size_t {64}));
+    inicios.assign (cuenta_cubetas + 1, 0);
+    sin_ordenar.resize (total);
+    cubetas.resize (total);
+    entradas.resize (total);
+    //
+    // Ordena las celdas ocupadas por cubetas, contando las entradas de cada cubeta.
+    size_t siguiente = 0;
+    for (int indice = 0; indice < cuerpos.size (); ++ indice) {
+        const Cuerpo & cuerpo = cuerpos [indice];
+        if (! cuerpo.vivo) {
+            continue;
+        }
+        int32_t celda_x_0 = celda (cuerpo.min_x);
+        int32_t celda_x_1 = celda (cuerpo.max_x);
+        int32_t celda_y_0 = celda (cuerpo.min_y);
+        int32_t celda_y_1 = celda (cuerpo.max_y);
+        for (int32_t celda_y = celda_y_0; celda_y <= celda_y_1; ++ celda_y) {
+            for (int32_t celda_x = celda_x_0; celda_x <= celda_x_1; ++ celda_x) {
+                uint32_t indice_cubeta = cubeta (celda_x, celda_y);
+                cubetas [siguiente] = indice_cubeta;
+                inicios [indice_cubeta + 1] ++;
+                sin_ordenar [siguiente] = Entrada {celda_x, celda_y, indice, cuerpo.capa, cuerpo.mascara, 
+                                                   cuerpo.min_x, cuerpo.min_y, cuerpo.max_x, cuerpo.max_y};
+                siguiente ++;
+            }
+        }
+    }
+    for (size_t indc = 1; indc <= cuenta_cubetas; ++ indc) {
+        inicios [indc] += inicios [indc - 1];
+    }
+    posiciones.assign (inicios.begin (), inicios.end () - 1);
+    for (size_t indc = 0; indc < total; ++ indc) {
+        entradas [posiciones [cubetas [indc]] ++] = sin_ordenar [indc];
+    }
+    //
+    // Compara los cuerpos de cada celda. Una pareja que comparte varias celdas se compara solo en
+    // la celda que contiene la esquina superior izquierda de la intersección de sus límites.
+    for (size_t indice_cubeta = 0; indice_cubeta < cuenta_cubetas; ++ indice_cubeta) {
+        uint32_t inicio = inicios [indice_cubeta];
+        uint32_t final  = inicios [indice_cubeta + 1];
+        for (uint32_t indc_1 = inicio; indc_1 < final; ++ indc_1) {
+            const Entrada & entrada_1 = entradas [indc_1];
+            for (uint32_t indc_2 = indc_1 + 1; indc_2 < final; ++ indc_2) {
+                const Entrada & entrada_2 = entradas [indc_2];
+                if (entrada_1.celda_x != entrada_2.celda_x || entrada_1.celda_y != entrada_2.celda_y) {
+                    continue;
+                }
+                // sin evaluación en cortocircuito: una sola bifurcación, más fácil de predecir
+                bool descartada = ((entrada_1.capa & entrada_2.mascara) == 0) | 
+                                  ((entrada_2.capa & entrada_1.mascara) == 0) |
+                                  (entrada_1.max_x < entrada_2.min_x) | (entrada_2.max_x < entrada_1.min_x) | 
+                                  (entrada_1.max_y < entrada_2.min_y) | (entrada_2.max_y < entrada_1.min_y);
+                if (descartada) {
+                    continue;
+                }
+                if (celda (std::max (entrada_1.min_x, entrada_2.min_x)) != entrada_1.celda_x ||
+                    celda (std::max (entrada_1.min_y, entrada_2.min_y)) != entrada_1.celda_y   ) {
+                    continue;
+                }
+                compara (std::min (entrada_1.cuerpo, entrada_2.cuerpo), 
+                         std::max (entrada_1.cuerpo, entrada_2.cuerpo));
+            }
+        }
+    }
+}
+
+
+namespace {
+
+    struct Forma {
+        float centro_x, centro_y;
+        float semieje_x, semieje_y;
+        float eje_x, eje_y;
+    };
+
+    // Círculo contra círculo. La normal va del primero al segundo.
+    bool circulos (const Forma & a, const Forma & b, float & normal_x, float & normal_y, float & penetracion) {
+        float dx = b.centro_x - a.centro_x;
+        float dy = b.centro_y - a.centro_y;
+        float radios = a.semieje_x + b.semieje_x;
+        float distancia2 = dx * dx + dy * dy;
+        if (distancia2 > radios * radios) {
+            return false;
+        }
+        float distancia = std::sqrt (distancia2);
+        if (distancia > 0.0f) {
+            normal_x = dx / distancia;
+            normal_y = dy / distancia;
+        } else {
+            normal_x = 1.0f;
+            normal_y = 0.0f;
+        }
+        penetracion = radios - distancia;
+        return true;
+    }
+
+    // Círculo contra rectángulo o segmento. La normal va del círculo al rectángulo.
+    bool circuloRectangulo (const Forma & circulo, const Forma & rectangulo, 
+                            float & normal_x, float & normal_y, float & penetracion) {
+        // el centro del círculo en los ejes propios del rectángulo
+        float dx = circulo.centro_x - rectangulo.centro_x;
+        float dy = circulo.centro_y - rectangulo.centro_y;
+        float local_x =   dx * rectangulo.eje_x + dy * rectangulo.eje_y;
+        float local_y = - dx * rectangulo.eje_y + dy * rectangulo.eje_x;
+        float cercano_x = std::clamp (local_x, - rectangulo.semieje_x, rectangulo.semieje_x);
+        float cercano_y = std::clamp (local_y, - rectangulo.semieje_y, rectangulo.semieje_y);
+        float fuera_x = local_x - cercano_x;
+        float fuera_y = local_y - cercano_y;
+        float radio = circulo.semieje_x;
+        float distancia2 = fuera_x * fuera_x + fuera_y * fuera_y;
+        if (distancia2 > radio * radio) {
+            return false;
+        }
+        // 'local' es la dirección del rectángulo al círculo, en los ejes del rectángulo
+        float normal_local_x, normal_local_y;
+        if (distancia2 > 0.0f) {
+            float distancia = std::sqrt (distancia2);
+            normal_local_x = fuera_x / distancia;
+            normal_local_y = fuera_y / distancia;
+            penetracion = radio - distancia;
+        } else {
+            // el centro está dentro; sale por el lado más cercano
+            float hueco_x = rectangulo.semieje_x - std::abs (local_x);
+            float hueco_y = rectangulo.semieje_y - std::abs (local_y);
+            if (hueco_x < hueco_y) {
+                normal_local_x = local_x < 0.0f ? -1.0f : 1.0f;
+                normal_local_y = 0.0f;
+                penetracion = hueco_x + radio;
+            } else {
+                normal_local_x = 0.0f;
+                normal_local_y = local_y < 0.0f ? -1.0f : 1.0f;
+                penetracion = hueco_y + radio;
+            }
+        }
+        normal_x = - (normal_local_x * rectangulo.eje_x - normal_local_y * rectangulo.eje_y);
+        normal_y = - (normal_local_x * rectangulo.eje_y + normal_local_y * rectangulo.eje_x);
+        return true;
+    }
+
+    // Rectángulo o segmento contra rectángulo o segmento, por separación de ejes. La normal va 
+    // del primero al segundo.
+    bool rectangulos (const Forma & a, const Forma & b, float & normal_x, float & normal_y, float & penetracion) {
+        float dx = b.centro_x - a.centro_x;
+        float dy = b.centro_y - a.centro_y;
+        const float ejes [4][2] = {
+            {  a.eje_x, a.eje_y }, { - a.eje_y, a.eje_x },
+            {  b.eje_x, b.eje_y }, { - b.eje_y, b.eje_x }
+        };
+        penetracion = std::numeric_limits <float>::max ();
+        for (const float (& eje) [2] : ejes) {
+            float radio_a = a.semieje_x * std::abs (a.eje_x * eje [0] + a.eje_y * eje [1]) + 
+                            a.semieje_y * std::abs (a.eje_x * eje [1] - a.eje_y * eje [0]);
+            float radio_b = b.semieje_x * std::abs (b.eje_x * eje [0] + b.eje_y * eje [1]) + 
+                            b.semieje_y * std::abs (b.eje_x * eje [1] - b.eje_y * eje [0]);
+            float proyeccion = dx * eje [0] + dy * eje [1];
+            float solape = radio_a + radio_b - std::abs (proyeccion);
+            if (solape < 0.0f) {
+                return false;
+            }
+            if (solape < penetracion) {
+                penetracion = solape;
+                normal_x = proyeccion < 0.0f ? - eje [0] : eje [0];
+                normal_y = proyeccion < 0.0f ? - eje [1] : eje [1];
+            }
+        }
+        return true;
+    }
+
+}
+
+
+void Colisiones::compara (int indice_1, int indice_2) {
+    const Cuerpo & cuerpo_1 = cuerpos [indice_1];
+    const Cuerpo & cuerpo_2 = cuerpos [indice_2];
+    Forma forma_1 {cuerpo_1.centro_x, cuerpo_1.centro_y, cuerpo_1.semieje_x, cuerpo_1.semieje_y, 
+                   cuerpo_1.eje_x, cuerpo_1.eje_y};
+    Forma forma_2 {cuerpo_2.centro_x, cuerpo_2.centro_y, cuerpo_2.semieje_x, cuerpo_2.semieje_y, 
+                   cuerpo_2.eje_x, cuerpo_2.eje_y};
+    bool circulo_1 = cuerpo_1.forma == FormaColision::circulo;
+    bool circulo_2 = cuerpo_2.forma == FormaColision::circulo;
+    float normal_x {}, normal_y {}, penetracion {};
+    bool toca;
+    if (circulo_1 && circulo_2) {
+        toca = circulos (forma_1, forma_2, normal_x, normal_y, penetracion);
+    } else if (circulo_1) {
+        toca = circuloRectangulo (forma_1, forma_2, normal_x, normal_y, penetracion);
+    } else if (circulo_2) {
+        toca = circuloRectangulo (forma_2, forma_1, normal_x, normal_y, penetracion);
+        normal_x = - normal_x;
+        normal_y = - normal_y;
+    } else {
+        toca = rectangulos (forma_1, forma_2, normal_x, normal_y, penetracion);
+    }
+    if (toca) {
+        lista_contactos.push_back (Contacto {indice_1, indice_2, Vector {normal_x, normal_y}, penetracion});
+    }
+}
+
+
+/// @endcond
@@ -0,0 +1,255 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: Colisiones.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    /// @brief Formas de los cuerpos de Colisiones.
+    enum class FormaColision {
+        /// @brief Círculo.
+        circulo,
+        /// @brief Rectángulo alineado con los ejes de la pantalla.
+        caja,
+        /// @brief Rectángulo girado.
+        rectangulo,
+        /// @brief Segmento de recta.
+        segmento
+    };
+
+
+    /// @brief Contacto entre dos cuerpos de Colisiones.
+    struct Contacto {
+
+        /// @brief Cuerpo de menor identificador.
+        int cuerpo_1 {};
+
+        /// @brief Cuerpo de mayor identificador.
+        int cuerpo_2 {};
+
+        /// @brief Dirección, de longitud 1, en la que hay que desplazar 'cuerpo_2' para separarlo 
+        /// de 'cuerpo_1'.
+        Vector normal {};
+
+        /// @brief Distancia que hay que desplazar 'cuerpo_2' en la dirección 'normal' para 
+        /// separarlo de 'cuerpo_1'.
+        float penetracion {};
+
+    };
+
+
+    /// @brief Detección de los contactos entre cuerpos con forma de círculo, rectángulo o 
+    /// segmento.
+    /// @details Los cuerpos se agregan con los métodos 'agrega' y se identifican por un entero. El
+    /// juego los desplaza y gira en cada ciclo, en coordenadas de la pantalla, y llama al método 
+    /// 'calcula', que obtiene la lista de los contactos.<p>
+    /// Para no comparar todos los cuerpos entre sí, el plano se divide en celdas cuadradas del 
+    /// tamaño indicado al construir la instancia, y solo se comparan los cuerpos que comparten 
+    /// alguna celda. El tamaño de celda conveniente es algo mayor que el de la mayoría de los 
+    /// cuerpos.<p>
+    /// Cada cuerpo pertenece a las capas indicadas por los bits de 'capa' y solo se compara con 
+    /// los cuerpos de las capas indicadas por los bits de 'mascara'. Dos cuerpos se comparan si 
+    /// cada uno está en alguna de las capas de la máscara del otro.
+    class Colisiones {
+    public:
+
+        /// @brief Capas y máscara por defecto: todas.
+        static constexpr uint32_t todasCapas = 0xFFFFFFFF;
+
+        /// @brief Constructor.
+        /// @param tamano_celda Lado de las celdas en que se divide el plano.
+        explicit Colisiones (float tamano_celda = 64.0f);
+
+        /// @brief Agrega un círculo.
+        /// @param centro Centro del círculo.
+        /// @param radio Radio del círculo.
+        /// @param capa Capas del cuerpo.
+        /// @param mascara Capas con las que se compara el cuerpo.
+        /// @return Identificador del cuerpo.
+        int agregaCirculo (Vector centro, float radio, 
+                           uint32_t capa = todasCapas, uint32_t mascara = todasCapas);
+
+        /// @brief Agrega un rectángulo alineado con los ejes de la pantalla.
+        /// @param centro Centro del rectángulo.
+        /// @param tamano Anchura y altura del rectángulo.
+        /// @param capa Capas del cuerpo.
+        /// @param mascara Capas con las que se compara el cuerpo.
+        /// @return Identificador del cuerpo.
+        int agregaCaja (Vector centro, Vector tamano, 
+                        uint32_t capa = todasCapas, uint32_t mascara = todasCapas);
+
+        /// @brief Agrega un rectángulo girado.
+        /// @param centro Centro del rectángulo.
+        /// @param tamano Anchura y altura del rectángulo antes de girarlo.
+        /// @param rotacion Rotación del rectángulo alrededor de su centro, en radianes.
+        /// @param capa Capas del cuerpo.
+        /// @param mascara Capas con las que se compara el cuerpo.
+        /// @return Identificador del cuerpo.
+        int agregaRectangulo (Vector centro, Vector tamano, float rotacion, 
+                              uint32_t capa = todasCapas, uint32_t mascara = todasCapas);
+
+        /// @brief Agrega un segmento.
+        /// @param extremo_1 Un extremo del segmento.
+        /// @param extremo_2 El otro extremo del segmento.
+        /// @param capa Capas del cuerpo.
+        /// @param mascara Capas con las que se compara el cuerpo.
+        /// @return Identificador del cuerpo.
+        int agregaSegmento (Vector extremo_1, Vector extremo_2, 
+                            uint32_t capa = todasCapas, uint32_t mascara = todasCapas);
+
+        /// @brief Retira un cuerpo. Su identificador se puede reutilizar.
+        /// @param cuerpo Identificador del cuerpo.
+        void retira (int cuerpo);
+
+        /// @brief Retira todos los cuerpos.
+        void vacia ();
+
+        /// @brief Número de cuerpos.
+        /// @return Número de cuerpos.
+        int cuentaCuerpos () const;
+
+        /// @brief Forma de un cuerpo.
+        /// @param cuerpo Identificador del cuerpo.
+        /// @return La forma del cuerpo.
+        FormaColision forma (int cuerpo) const;
+
+        /// @brief Centro de un cuerpo; el punto medio en un segmento.
+        /// @param cuerpo Identificador del cuerpo.
+        /// @return Centro del cuerpo.
+        Vector centro (int cuerpo) const;
+
+        /// @brief Desplaza un cuerpo.
+        /// @param cuerpo Identificador del cuerpo.
+        /// @param centro Nuevo centro del cuerpo; el punto medio en un segmento.
+        void mueve (int cuerpo, Vector centro);
+
+        /// @brief Gira un rectángulo o un segmento alrededor de su centro.
+        /// @param cuerpo Identificador del cuerpo.
+        /// @param rotacion Nueva rotación del cuerpo, en radianes. En un segmento, es el ángulo 
+        /// del primer extremo al segundo.
+        void gira (int cuerpo, float rotacion);
+
+        /// @brief Cambia los extremos de un segmento.
+        /// @param cuerpo Identificador del cuerpo.
+        /// @param extremo_1 Un extremo del segmento.
+        /// @param extremo_2 El otro extremo del segmento.
+        void ponExtremos (int cuerpo, Vector extremo_1, Vector extremo_2);
+
+        /// @brief Cambia las capas y la máscara de un cuerpo.
+        /// @param cuerpo Identificador del cuerpo.
+        /// @param capa Capas del cuerpo.
+        /// @param mascara Capas con las que se compara el cuerpo.
+        void ponCapas (int cuerpo, uint32_t capa, uint32_t mascara);
+
+        /// @brief Obtiene los contactos entre los cuerpos en su situación actual.
+        /// @details La lista anterior de contactos se sustituye.
+        void calcula ();
+
+        /// @brief Contactos obtenidos en la última llamada a 'calcula'.
+        /// @details Cada pareja de cuerpos aparece una sola vez.
+        /// @return Lista de contactos.
+        const std::vector <Contacto> & contactos () const;
+
+    private:
+
+        struct Cuerpo {
+            FormaColision forma {};
+            bool     vivo {};
+            uint32_t capa {};
+            uint32_t mascara {};
+            // centro y semiejes; en el círculo, el radio; en el segmento, la semilongitud y 0
+            float    centro_x {}, centro_y {};
+            float    semieje_x {}, semieje_y {};
+            // dirección del eje x propio del cuerpo
+            float    eje_x {1.0f}, eje_y {};
+            // rectángulo alineado que contiene al cuerpo
+            float    min_x {}, min_y {}, max_x {}, max_y {};
+        };
+
+        // Las entradas copian los límites y las capas del cuerpo para compararlos sin acceder a 
+        // 'cuerpos'.
+        struct Entrada {
+            int32_t  celda_x;
+            int32_t  celda_y;
+            int      cuerpo;
+            uint32_t capa;
+            uint32_t mascara;
+            float    min_x, min_y, max_x, max_y;
+        };
+
+        float inverso_celda;
+        int   cuenta_vivos {};
+        std::vector <Cuerpo>   cuerpos {};
+        std::vector <int>      libres {};
+        // celdas ocupadas, ordenadas por cubetas; se conservan para no reservar memoria en cada
+        // llamada a 'calcula'
+        std::vector <Entrada>  entradas {};
+        std::vector <Entrada>  sin_ordenar {};
+        std::vector <uint32_t> cubetas {};
+        std::vector <uint32_t> inicios {};
+        std::vector <uint32_t> posiciones {};
+        std::vector <Contacto> lista_contactos {};
+
+        int agrega (const Cuerpo & cuerpo);
+        static void limita (Cuerpo & cuerpo);
+        int32_t celda (float coordenada) const;
+        uint32_t cubeta (int32_t celda_x, int32_t celda_y) const;
+        void compara (int indice_1, int indice_2);
+
+    };
+
+
+    inline int Colisiones::cuentaCuerpos () const {
+        return cuenta_vivos;
+    }
+
+    inline FormaColision Colisiones::forma (int cuerpo) const {
+        assert (cuerpo >= 0 && cuerpo < cuerpos.size () && cuerpos [cuerpo].vivo);
+        return cuerpos [cuerpo].forma;
+    }
+
+    inline Vector Colisiones::centro (int cuerpo) const {
+        assert (cuerpo >= 0 && cuerpo < cuerpos.size () && cuerpos [cuerpo].vivo);
+        return Vector {cuerpos [cuerpo].centro_x, cuerpos [cuerpo].centro_y};
+    }
+
+    inline const std::vector <Contacto> & Colisiones::contactos () const {
+        return lista_contactos;
+    }
+
+
+}
+
+
+/// @class unir2d::Colisiones
+/// 
+/// Ejemplo de uso:
+/// @code
+/// // Las balas (capa 2) chocan con los enemigos (capa 1), pero no entre ellas.
+/// Colisiones colisiones {32.0f};
+/// int enemigo = colisiones.agregaCirculo (Vector {100, 100}, 12, 1, 2);
+/// int bala    = colisiones.agregaSegmento (Vector {90, 80}, Vector {90, 96}, 2, 1);
+/// 
+/// // En cada ciclo se sitúan los cuerpos y se calculan los contactos.
+/// colisiones.mueve (bala, Vector {95, 92});
+/// colisiones.calcula ();
+/// for (const Contacto & contacto : colisiones.contactos ()) {
+///     // 'contacto.cuerpo_1' y 'contacto.cuerpo_2' se tocan.
+/// }
+/// @endcode
@@ -23,13 +23,22 @@ using namespace unir2d;
 /// @cond
 
 
-void Dibujable::situa (sf::Transformable & objeto, const Transforma & contenedor, const Transforma & transforma) {
-    Vector poscn = contenedor.aplicaAPosicion (transforma.posicion ());
-    float  rotcn = contenedor.aplicaARotacion (transforma.rotacion ());
-    objeto.setOrigin   (transforma.origen ().x (), transforma.origen ().y ());
-    objeto.setPosition (poscn.x (), poscn.y ());
-    objeto.setRotation (rotcn * Transforma::radianes_a_grados);
-    objeto.setScale    (transforma.escala ().x (), transforma.escala ().y ());
+Dibujable::~Dibujable () {
+    cuenta_instancias --;
+    // el nodo no puede conservar un puntero a un dibujable destruido
+    if (m_nodo != nullptr) {
+        m_nodo->extraeDibujo (this);
+    }
+}
+
+
+const sf::Transform & Dibujable::situa (const Transforma & contenedor) {
+    if (contenedor.version () != version_contenedor || m_transforma.version () != version_propia) {
+        m_situacion = contenedor.matrizContenedor () * m_transforma.matriz ();
+        version_contenedor = contenedor.version ();
+        version_propia = m_transforma.version ();
+    }
+    return m_situacion;
 }
 
 
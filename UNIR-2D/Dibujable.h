@@ -22,6 +22,7 @@ namespace unir2d {
 
 
 	class Rendidor;
+	class Nodo;
 
 
 	/// @brief Clase base de los objetos que se presentan en la pantalla del juego.
@@ -41,8 +42,19 @@ namespace unir2d {
 	public:
 
 		/// @brief Destructor virtual.
+		/// @details Si el dibujable está en un Nodo, se extrae de él y de la lista de su actor.
 		virtual ~Dibujable ();
 
+		/// @brief Reserva la memoria de una instancia en ReservaDibujos.
+		/// @param bytes Tamaño de la instancia.
+		/// @return Dirección de la memoria reservada.
+		static void * operator new (size_t bytes);
+
+		/// @brief Devuelve a ReservaDibujos la memoria de una instancia.
+		/// @param objeto Dirección de la instancia.
+		/// @param bytes Tamaño de la instancia.
+		static void operator delete (void * objeto, size_t bytes);
+
 		/// @brief Obtiene la posición considerada origen de la instancia.
 		/// @details El origen es un punto que se toma como referencia para establecer la posición 
 		/// de la instancia y para realizar las rotaciones de la instancia.
@@ -102,22 +114,64 @@ namespace unir2d {
 
 	protected:
 
+		/// @brief Estado de presentación que comparten los dibujables que pueden presentarse 
+		/// seguidos sin cambiar el estado de la tarjeta gráfica.
+		struct ClaveEstado {
+			const void * textura    {};
+			const void * sombreador {};
+			int          primitiva  {};
+			friend bool operator == (const ClaveEstado & , const ClaveEstado & ) = default;
+		};
+
 		Transforma m_transforma {};
 		int indice_z {};
 		bool m_visible {true};
 
 		explicit Dibujable ();
 
-		static void situa (sf::Transformable & objeto, const Transforma & contenedor, const Transforma & transforma);
+		/// @brief Obtiene la matriz que sitúa la instancia en la pantalla.
+		/// @details La matriz es el producto de la matriz del contenedor y la de la instancia. Se 
+		/// guarda y solo se calcula de nuevo cuando cambia la versión de alguna de ellas.
+		/// @param contenedor Transformación del actor contenedor.
+		/// @return Matriz de situación.
+		const sf::Transform & situa (const Transforma & contenedor);
 
 		virtual void dibuja (const Transforma & contenedor, Rendidor * rendidor) = 0;
 
+		/// @brief Número de vértices que envía a la tarjeta gráfica una figura de SFML.
+		/// @param figura La figura.
+		/// @return El número de vértices del interior y, si lo tiene, del contorno.
+		static size_t verticesFigura (const sf::Shape & figura);
+
+		/// @brief Obtiene el estado de presentación de la instancia.
+		/// @details Dentro de un mismo índice Z, los dibujables con el mismo estado se agrupan 
+		/// para presentarse seguidos (véase JuegoBase::ponOrdenaEstados).
+		/// @return El estado de presentación; por defecto, sin textura ni sombreador.
+		virtual ClaveEstado claveEstado () const;
+
+		/// @brief Obtiene el rectángulo de la pantalla que ocupa la instancia.
+		/// @details Dos dibujables con un mismo índice Z cuyos rectángulos se cortan se presentan 
+		/// siempre en su orden original. 
+		/// @param contenedor Transformación del actor contenedor.
+		/// @param limites Recibe el rectángulo ocupado.
+		/// @return Si se conoce el rectángulo; por defecto, falso, y la instancia se presenta en 
+		/// su orden original respecto a todas las demás.
+		virtual bool limitesPantalla (const Transforma & contenedor, sf::FloatRect & limites);
+
 	private:
 
+		sf::Transform m_situacion {};
+		uint64_t version_contenedor {};
+		uint64_t version_propia {};
+		// nodo que sitúa la instancia, si está en una jerarquía
+		Nodo * m_nodo {};
+
 		inline static int cuenta_instancias {};
 
 		friend class ActorBase;
         friend class JuegoBase;
+        friend class PanelRendimiento;
+        friend class Nodo;
 
 	};
 	
@@ -126,8 +180,29 @@ namespace unir2d {
 		cuenta_instancias ++;
 	}
 
-    inline Dibujable::~Dibujable () {
-		cuenta_instancias --;
+	inline void * Dibujable::operator new (size_t bytes) {
+		return ReservaDibujos::reserva (bytes);
+	}
+
+	inline void Dibujable::operator delete (void * objeto, size_t bytes) {
+		ReservaDibujos::devuelve (objeto, bytes);
+	}
+
+	inline size_t Dibujable::verticesFigura (const sf::Shape & figura) {
+		size_t puntos = figura.getPointCount ();
+		size_t vertices = puntos + 2;
+		if (figura.getOutlineThickness () != 0) {
+			vertices += puntos * 2 + 2;
+		}
+		return vertices;
+	}
+
+	inline Dibujable::ClaveEstado Dibujable::claveEstado () const {
+		return ClaveEstado {};
+	}
+
+	inline bool Dibujable::limitesPantalla (const Transforma & contenedor, sf::FloatRect & limites) {
+		return false;
 	}
 
 	inline Vector Dibujable::origen () const {
@@ -0,0 +1,68 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: Entidades.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+
+#include "UNIR-2D.h"
+
+using namespace unir2d;
+
+
+/// @cond
+
+Entidad Entidades::crea () {
+    Entidad entidad {};
+    if (! libres.empty ()) {
+        entidad.indice = libres.back ();
+        libres.pop_back ();
+    } else {
+        entidad.indice = static_cast <uint32_t> (generaciones.size ());
+        generaciones.push_back (0);
+        vivas.push_back (0);
+    }
+    entidad.generacion = generaciones [entidad.indice];
+    vivas [entidad.indice] = 1;
+    cuenta_vivas ++;
+    return entidad;
+}
+
+
+void Entidades::destruye (Entidad entidad) {
+    assert (viva (entidad));
+    for (std::unique_ptr <AlmacenBase> & almacen : almacenes) {
+        if (almacen != nullptr && almacen->tiene (entidad.indice)) {
+            almacen->quita (entidad);
+        }
+    }
+    //
+    // la generación cambia para que el identificador antiguo deje de ser válido
+    generaciones [entidad.indice] ++;
+    vivas [entidad.indice] = 0;
+    libres.push_back (entidad.indice);
+    cuenta_vivas --;
+}
+
+
+void Entidades::vacia () {
+    for (uint32_t indice = 0; indice < generaciones.size (); indice ++) {
+        if (vivas [indice] != 0) {
+            destruye (Entidad {indice, generaciones [indice]});
+        }
+    }
+}
+
+/// @endcond
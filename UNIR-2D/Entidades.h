@@ -0,0 +1,375 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: Entidades.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    /// @brief Identificador de una entidad de Entidades.
+    /// @details Se compone del índice de la entidad y de su generación. El índice de una entidad 
+    /// destruida se reutiliza con una generación distinta, de modo que los identificadores 
+    /// antiguos dejan de ser válidos.
+    struct Entidad {
+
+        /// @brief Índice de la entidad.
+        uint32_t indice {std::numeric_limits <uint32_t>::max ()};
+
+        /// @brief Generación de la entidad.
+        uint32_t generacion {};
+
+    };
+
+    /// @brief Compara dos identificadores de entidad.
+    inline constexpr bool operator == (const Entidad & entidad_1, const Entidad & entidad_2) {
+        return entidad_1.indice == entidad_2.indice && entidad_1.generacion == entidad_2.generacion;
+    }
+
+    /// @brief Compara dos identificadores de entidad.
+    inline constexpr bool operator != (const Entidad & entidad_1, const Entidad & entidad_2) {
+        return ! (entidad_1 == entidad_2);
+    }
+
+
+    /// @brief Almacén de entidades y de sus componentes.
+    /// @details Una entidad es solo un identificador; sus datos son los componentes que se le 
+    /// agregan. Un componente es una instancia de cualquier clase o estructura que se pueda mover, 
+    /// y cada entidad puede tener un componente de cada tipo.<p>
+    /// Los componentes de un mismo tipo se guardan seguidos en un vector, sin huecos, junto con 
+    /// las entidades a las que pertenecen. Un segundo vector, indexado por el índice de la entidad, 
+    /// da la posición de su componente. Al quitar un componente, el último del vector ocupa su 
+    /// lugar. Así, los sistemas del juego recorren los componentes en memoria contigua, sin 
+    /// seguir punteros ni llamar a métodos virtuales.<p>
+    /// Las referencias y los punteros a los componentes dejan de ser válidos al agregar o quitar 
+    /// componentes del mismo tipo. Las entidades se guardan por su identificador.<p>
+    /// La clase ActorEntidades integra un almacén en la lista de actores del juego.
+    class Entidades {
+    public:
+
+        /// @brief Constructor.
+        explicit Entidades () = default;
+
+        /// @brief Destructor. No llama a las funciones de 'alQuitar'.
+        ~Entidades () = default;
+
+        /// @brief Crea una entidad sin componentes.
+        /// @return Identificador de la entidad.
+        Entidad crea ();
+
+        /// @brief Destruye una entidad y quita sus componentes.
+        /// @param entidad Entidad que se destruye.
+        void destruye (Entidad entidad);
+
+        /// @brief Destruye todas las entidades.
+        void vacia ();
+
+        /// @brief Indica si una entidad existe.
+        /// @param entidad Identificador de la entidad.
+        /// @return Si la entidad existe y no ha sido destruida.
+        bool viva (Entidad entidad) const;
+
+        /// @brief Número de entidades.
+        /// @return Número de entidades.
+        int cuenta () const;
+
+        /// @brief Agrega un componente a una entidad.
+        /// @details La entidad no debe tener ya un componente del mismo tipo. 
+        /// @param entidad Entidad a la que se agrega el componente.
+        /// @param argumentos Argumentos con los que se construye el componente.
+        /// @return El componente agregado.
+        template <typename C, typename... A>
+        C & agrega (Entidad entidad, A &&... argumentos);
+
+        /// @brief Quita un componente de una entidad.
+        /// @param entidad Entidad que tiene el componente.
+        template <typename C>
+        void quita (Entidad entidad);
+
+        /// @brief Indica si una entidad tiene un componente.
+        /// @param entidad Entidad que se consulta.
+        /// @return Si la entidad existe y tiene el componente.
+        template <typename C>
+        bool tiene (Entidad entidad) const;
+
+        /// @brief Obtiene un componente de una entidad, que lo debe tener.
+        /// @param entidad Entidad que tiene el componente.
+        /// @return El componente.
+        template <typename C>
+        C & obtiene (Entidad entidad);
+
+        /// @brief Busca un componente de una entidad.
+        /// @param entidad Entidad que se consulta.
+        /// @return El componente, o nulo si la entidad no lo tiene.
+        template <typename C>
+        C * busca (Entidad entidad);
+
+        /// @brief Obtiene todos los componentes de un tipo, seguidos en memoria.
+        /// @return Los componentes.
+        template <typename C>
+        std::span <C> componentes ();
+
+        /// @brief Obtiene las entidades que tienen un componente, en el mismo orden que 
+        /// 'componentes'.
+        /// @return Las entidades.
+        template <typename C>
+        std::span <const Entidad> entidadesCon ();
+
+        /// @brief Llama a una función para cada entidad que tiene todos los componentes indicados.
+        /// @details La función recibe la entidad y una referencia a cada componente, en el orden 
+        /// de los tipos. Se recorren los componentes del primer tipo, de modo que conviene que sea 
+        /// el menos frecuente. Se recorren del último al primero: la función puede quitar el 
+        /// componente del primer tipo de la entidad que recibe, o destruirla, pero no debe agregar 
+        /// componentes de los tipos recorridos.
+        /// @param funcion Función que recibe la entidad y sus componentes.
+        template <typename C, typename... R, typename F>
+        void recorre (F && funcion);
+
+        /// @brief Establece una función a la que se llama al agregar un componente de un tipo.
+        /// @param funcion Función que recibe la entidad y el componente agregado.
+        template <typename C>
+        void alAgregar (std::function <void (Entidad, C &)> funcion);
+
+        /// @brief Establece una función a la que se llama antes de quitar un componente de un 
+        /// tipo, también al destruir la entidad.
+        /// @param funcion Función que recibe la entidad y el componente que se quita.
+        template <typename C>
+        void alQuitar (std::function <void (Entidad, C &)> funcion);
+
+    private:
+
+        struct AlmacenBase {
+            virtual ~AlmacenBase () = default;
+            virtual bool tiene (uint32_t indice) const = 0;
+            virtual void quita (Entidad entidad) = 0;
+        };
+
+        template <typename C>
+        struct Almacen : AlmacenBase {
+            // posición más uno del componente en 'datos', por índice de entidad; cero si no tiene
+            std::vector <uint32_t> dispersos {};
+            std::vector <Entidad>  entidades {};
+            std::vector <C>        datos {};
+            std::function <void (Entidad, C &)> al_agregar {};
+            std::function <void (Entidad, C &)> al_quitar {};
+
+            bool tiene (uint32_t indice) const override;
+            void quita (Entidad entidad) override;
+        };
+
+        std::vector <uint32_t> generaciones {};
+        std::vector <uint8_t>  vivas {};
+        std::vector <uint32_t> libres {};
+        int cuenta_vivas {};
+        std::vector <std::unique_ptr <AlmacenBase>> almacenes {};
+
+        inline static std::atomic <int> total_tipos {};
+
+        template <typename C>
+        static int tipo ();
+
+        template <typename C>
+        Almacen <C> & almacen ();
+
+        template <typename C>
+        Almacen <C> * almacenExistente () const;
+
+        // no se pueden copiar ni mover: los almacenes se enlazan con sus funciones
+        Entidades (const Entidades & )              = delete;
+        Entidades (Entidades && )                   = delete;
+        Entidades & operator = (const Entidades & ) = delete;
+        Entidades & operator = (Entidades && )      = delete;
+
+    };
+
+
+    inline bool Entidades::viva (Entidad entidad) const {
+        return entidad.indice < generaciones.size () && 
+               vivas [entidad.indice] != 0 && 
+               generaciones [entidad.indice] == entidad.generacion;
+    }
+
+    inline int Entidades::cuenta () const {
+        return cuenta_vivas;
+    }
+
+    template <typename C>
+    inline int Entidades::tipo () {
+        // cada tipo de componente recibe un número la primera vez que se usa
+        static const int numero = total_tipos ++;
+        return numero;
+    }
+
+    template <typename C>
+    inline Entidades::Almacen <C> & Entidades::almacen () {
+        int numero = tipo <C> ();
+        if (static_cast <size_t> (numero) >= almacenes.size ()) {
+            almacenes.resize (numero + 1);
+        }
+        if (almacenes [numero] == nullptr) {
+            almacenes [numero] = std::make_unique <Almacen <C>> ();
+        }
+        return static_cast <Almacen <C> &> (* almacenes [numero]);
+    }
+
+    template <typename C>
+    inline Entidades::Almacen <C> * Entidades::almacenExistente () const {
+        int numero = tipo <C> ();
+        if (static_cast <size_t> (numero) >= almacenes.size ()) {
+            return nullptr;
+        }
+        return static_cast <Almacen <C> *> (almacenes [numero].get ());
+    }
+
+    template <typename C>
+    inline bool Entidades::Almacen <C>::tiene (uint32_t indice) const {
+        return indice < dispersos.size () && dispersos [indice] != 0;
+    }
+
+    template <typename C>
+    inline void Entidades::Almacen <C>::quita (Entidad entidad) {
+        if (al_quitar) {
+            al_quitar (entidad, datos [dispersos [entidad.indice] - 1]);
+        }
+        uint32_t posicion = dispersos [entidad.indice] - 1;
+        uint32_t ultima   = static_cast <uint32_t> (datos.size ()) - 1;
+        if (posicion != ultima) {
+            datos     [posicion] = std::move (datos [ultima]);
+            entidades [posicion] = entidades [ultima];
+            dispersos [entidades [posicion].indice] = posicion + 1;
+        }
+        datos    .pop_back ();
+        entidades.pop_back ();
+        dispersos [entidad.indice] = 0;
+    }
+
+    template <typename C, typename... A>
+    inline C & Entidades::agrega (Entidad entidad, A &&... argumentos) {
+        assert (viva (entidad));
+        Almacen <C> & datos = almacen <C> ();
+        assert (! datos.tiene (entidad.indice));
+        if (entidad.indice >= datos.dispersos.size ()) {
+            datos.dispersos.resize (generaciones.size (), 0);
+        }
+        datos.datos.emplace_back (std::forward <A> (argumentos)...);
+        datos.entidades.push_back (entidad);
+        datos.dispersos [entidad.indice] = static_cast <uint32_t> (datos.datos.size ());
+        if (datos.al_agregar) {
+            datos.al_agregar (entidad, datos.datos.back ());
+        }
+        // la función de 'alAgregar' puede haber agregado o quitado otros componentes del tipo: el 
+        // componente se busca de nuevo por el índice de la entidad
+        assert (datos.tiene (entidad.indice));
+        return datos.datos [datos.dispersos [entidad.indice] - 1];
+    }
+
+    template <typename C>
+    inline void Entidades::quita (Entidad entidad) {
+        assert (tiene <C> (entidad));
+        almacen <C> ().quita (entidad);
+    }
+
+    template <typename C>
+    inline bool Entidades::tiene (Entidad entidad) const {
+        Almacen <C> * datos = almacenExistente <C> ();
+        return datos != nullptr && viva (entidad) && datos->tiene (entidad.indice);
+    }
+
+    template <typename C>
+    inline C & Entidades::obtiene (Entidad entidad) {
+        assert (tiene <C> (entidad));
+        Almacen <C> & datos = almacen <C> ();
+        return datos.datos [datos.dispersos [entidad.indice] - 1];
+    }
+
+    template <typename C>
+    inline C * Entidades::busca (Entidad entidad) {
+        if (! tiene <C> (entidad)) {
+            return nullptr;
+        }
+        Almacen <C> & datos = almacen <C> ();
+        return & datos.datos [datos.dispersos [entidad.indice] - 1];
+    }
+
+    template <typename C>
+    inline std::span <C> Entidades::componentes () {
+        Almacen <C> & datos = almacen <C> ();
+        return std::span <C> {datos.datos};
+    }
+
+    template <typename C>
+    inline std::span <const Entidad> Entidades::entidadesCon () {
+        Almacen <C> & datos = almacen <C> ();
+        return std::span <const Entidad> {datos.entidades};
+    }
+
+    template <typename C, typename... R, typename F>
+    inline void Entidades::recorre (F && funcion) {
+        Almacen <C> * principal = almacenExistente <C> ();
+        std::tuple <Almacen <R> *...> otros {almacenExistente <R> ()...};
+        if (principal == nullptr || ((std::get <Almacen <R> *> (otros) == nullptr) || ...)) {
+            return;
+        }
+        for (size_t posicion = principal->datos.size (); posicion -- > 0; ) {
+            // la función anterior puede haber quitado más de un componente
+            if (posicion >= principal->datos.size ()) {
+                continue;
+            }
+            Entidad entidad = principal->entidades [posicion];
+            if ((std::get <Almacen <R> *> (otros)->tiene (entidad.indice) && ...)) {
+                funcion (entidad, principal->datos [posicion], 
+                         std::get <Almacen <R> *> (otros)->datos [
+                                 std::get <Almacen <R> *> (otros)->dispersos [entidad.indice] - 1]...);
+            }
+        }
+    }
+
+    template <typename C>
+    inline void Entidades::alAgregar (std::function <void (Entidad, C &)> funcion) {
+        almacen <C> ().al_agregar = std::move (funcion);
+    }
+
+    template <typename C>
+    inline void Entidades::alQuitar (std::function <void (Entidad, C &)> funcion) {
+        almacen <C> ().al_quitar = std::move (funcion);
+    }
+
+
+}
+
+
+/// @class unir2d::Entidades
+/// 
+/// Ejemplo de uso:
+/// @code
+/// struct Velocidad { Vector valor; };
+/// struct Vida      { int puntos; };
+/// 
+/// Entidades entidades {};
+/// Entidad bala = entidades.crea ();
+/// entidades.agrega <Velocidad> (bala, Vector {0, -300});
+/// 
+/// // Un sistema recorre solo las entidades con los componentes que usa.
+/// entidades.recorre <Velocidad, DibujoEntidad> (
+///         [&] (Entidad entidad, Velocidad & velocidad, DibujoEntidad & dibujo) {
+///     dibujo.dibujo->ponPosicion (dibujo.dibujo->posicion () + segundos * velocidad.valor);
+/// });
+/// 
+/// // El identificador deja de ser válido al destruir la entidad.
+/// entidades.destruye (bala);
+/// assert (! entidades.viva (bala));
+/// @endcode
@@ -0,0 +1,123 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: Estadisticas.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+#include "UNIR-2D.h"
+
+using namespace unir2d;
+
+
+/// @cond
+
+
+double Estadisticas::media (long CuentaPresentacion::* contador) {
+    long medidos = std::min <long> (m_ciclos, ciclos_media);
+    if (medidos == 0) {
+        return 0.0;
+    }
+    long suma = 0;
+    for (long indice = 0; indice < medidos; ++ indice) {
+        suma += recientes [indice].*contador;
+    }
+    return (double) suma / medidos;
+}
+
+
+void Estadisticas::escribe (std::ostream & salida) {
+    salida << "  presentación (media de " << std::min <long> (m_ciclos, ciclos_media) << " ciclos):\n";
+    salida << "    " << media (& CuentaPresentacion::dibujos)          << " dibujos, "
+                     << media (& CuentaPresentacion::vertices)         << " vértices, "
+                     << media (& CuentaPresentacion::cambios_textura)  << " cambios de textura, "
+                     << media (& CuentaPresentacion::cambios_destino)  << " cambios de destino, "
+                     << media (& CuentaPresentacion::reconstrucciones) << " reconstrucciones\n";
+    if (m_ciclos == 0) {
+        return;
+    }
+    salida << "  presentación por clase (media de la ejecución):\n";
+    for (const CuentaClase & cuenta : m_clases) {
+        salida << "    " << cuenta.clase << ": " 
+               << (double) cuenta.acumulado.dibujos          / m_ciclos << " dibujos, "
+               << (double) cuenta.acumulado.vertices         / m_ciclos << " vértices, "
+               << (double) cuenta.acumulado.cambios_textura  / m_ciclos << " cambios de textura, "
+               << (double) cuenta.acumulado.cambios_destino  / m_ciclos << " cambios de destino, "
+               << (double) cuenta.acumulado.reconstrucciones / m_ciclos << " reconstrucciones\n";
+    }
+}
+
+
+CuentaPresentacion & Estadisticas::cuentaClase (const char * clase) {
+    // las clases son pocas; casi siempre coincide la dirección del nombre
+    for (CuentaClase & cuenta : m_clases) {
+        if (cuenta.clase == clase || std::strcmp (cuenta.clase, clase) == 0) {
+            return cuenta.en_curso;
+        }
+    }
+    m_clases.push_back (CuentaClase {clase});
+    return m_clases.back ().en_curso;
+}
+
+
+void Estadisticas::iniciaCiclo () {
+    en_curso = CuentaPresentacion {};
+    for (CuentaClase & cuenta : m_clases) {
+        cuenta.en_curso = CuentaPresentacion {};
+    }
+}
+
+
+void Estadisticas::terminaCiclo () {
+    m_ultimo = en_curso;
+    m_acumulado += en_curso;
+    recientes [m_ciclos % ciclos_media] = en_curso;
+    for (CuentaClase & cuenta : m_clases) {
+        cuenta.ultimo_ciclo = cuenta.en_curso;
+        cuenta.acumulado += cuenta.en_curso;
+    }
+    m_ciclos ++;
+    //
+    // las reconstrucciones que se producen entre ciclos se cuentan en el siguiente
+    iniciaCiclo ();
+}
+
+
+void Estadisticas::cuentaDibujo (const char * clase, size_t vertices, const sf::Texture * textura, const void * destino) {
+    CuentaPresentacion cuenta {};
+    cuenta.dibujos  = 1;
+    cuenta.vertices = (long) vertices;
+    // al cambiar de destino, SFML vuelve a asignar la textura
+    if (destino != ultimo_destino) {
+        cuenta.cambios_destino = 1;
+        ultimo_destino = destino;
+        ultima_textura = nullptr;
+    }
+    if (textura != nullptr && textura != ultima_textura) {
+        cuenta.cambios_textura = 1;
+    }
+    ultima_textura = textura;
+    //
+    en_curso += cuenta;
+    cuentaClase (clase) += cuenta;
+}
+
+
+void Estadisticas::cuentaReconstruccion (const char * clase) {
+    en_curso.reconstrucciones ++;
+    cuentaClase (clase).reconstrucciones ++;
+}
+
+
+/// @endcond
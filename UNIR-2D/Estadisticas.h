@@ -0,0 +1,157 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: Estadisticas.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    /// @brief Contadores del trabajo de presentación en pantalla.
+    struct CuentaPresentacion {
+
+        /// @brief Llamadas de dibujo enviadas a la tarjeta gráfica.
+        long dibujos {};
+
+        /// @brief Vértices enviados en las llamadas de dibujo.
+        long vertices {};
+
+        /// @brief Llamadas de dibujo con una textura distinta a la de la llamada anterior.
+        long cambios_textura {};
+
+        /// @brief Llamadas de dibujo con un destino (la ventana o una Textura creada) distinto 
+        /// al de la llamada anterior.
+        long cambios_destino {};
+
+        /// @brief Geometrías de textos y figuras calculadas de nuevo tras un cambio.
+        long reconstrucciones {};
+
+        /// @brief Suma los contadores indicados a los de la instancia.
+        /// @param otra Contadores sumados.
+        /// @return Referencia a la instancia.
+        CuentaPresentacion & operator += (const CuentaPresentacion & otra);
+
+    };
+
+
+    /// @brief Estadísticas de la presentación en pantalla del juego.
+    /// @details Todos los dibujos del motor se cuentan por ciclo de ejecución y por clase de 
+    /// dibujable (Imagen, Texto, Baldosas, etc.). Se mantienen los contadores del último ciclo 
+    /// terminado, la media de los últimos 'ciclos_media' ciclos y los totales de la ejecución.<p>
+    /// Al terminar la ejecución, la clase Motor escribe un resumen en la consola.
+    class Estadisticas {
+    public:
+
+        /// @brief Contadores de una clase de dibujable.
+        struct CuentaClase {
+
+            /// @brief Nombre de la clase.
+            const char * clase {};
+
+            /// @brief Contadores en el último ciclo terminado.
+            CuentaPresentacion ultimo_ciclo {};
+
+            /// @brief Contadores acumulados desde el inicio de la ejecución.
+            CuentaPresentacion acumulado {};
+
+            // Contadores del ciclo en curso.
+            CuentaPresentacion en_curso {};
+
+        };
+
+        /// @brief Número de ciclos usados para calcular la media.
+        static constexpr int ciclos_media = 60;
+
+        /// @brief Ciclos de ejecución terminados.
+        static long ciclos ();
+
+        /// @brief Contadores del último ciclo terminado.
+        static const CuentaPresentacion & ultimoCiclo ();
+
+        /// @brief Contadores acumulados desde el inicio de la ejecución.
+        static const CuentaPresentacion & acumulado ();
+
+        /// @brief Media de un contador en los últimos ciclos terminados.
+        /// @details Ejemplo: Estadisticas::media (& CuentaPresentacion::dibujos).
+        /// @param contador Contador del que se calcula la media.
+        /// @return La media por ciclo.
+        static double media (long CuentaPresentacion::* contador);
+
+        /// @brief Contadores de cada clase de dibujable, en el orden en el que se dibujaron por 
+        /// primera vez.
+        static const std::vector <CuentaClase> & clases ();
+
+        /// @brief Escribe un resumen de las estadísticas.
+        /// @param salida Flujo en el que se escribe.
+        static void escribe (std::ostream & salida);
+
+    private:
+
+        inline static long m_ciclos {};
+        inline static CuentaPresentacion en_curso {};
+        inline static CuentaPresentacion m_ultimo {};
+        inline static CuentaPresentacion m_acumulado {};
+        inline static std::array <CuentaPresentacion, ciclos_media> recientes {};
+        inline static std::vector <CuentaClase> m_clases {};
+
+        inline static const void * ultimo_destino {};
+        inline static const void * ultima_textura {};
+
+        static CuentaPresentacion & cuentaClase (const char * clase);
+
+        static void iniciaCiclo ();
+        static void terminaCiclo ();
+        static void cuentaDibujo (const char * clase, size_t vertices, const sf::Texture * textura, const void * destino);
+        static void cuentaReconstruccion (const char * clase);
+
+        friend class Motor;
+        friend class Rendidor;
+        friend class Imagen;
+        friend class Texto;
+        friend class Circulo;
+        friend class Rectangulo;
+
+    };
+
+
+    inline CuentaPresentacion & CuentaPresentacion::operator += (const CuentaPresentacion & otra) {
+        dibujos          += otra.dibujos;
+        vertices         += otra.vertices;
+        cambios_textura  += otra.cambios_textura;
+        cambios_destino  += otra.cambios_destino;
+        reconstrucciones += otra.reconstrucciones;
+        return * this;
+    }
+
+    inline long Estadisticas::ciclos () {
+        return m_ciclos;
+    }
+
+    inline const CuentaPresentacion & Estadisticas::ultimoCiclo () {
+        return m_ultimo;
+    }
+
+    inline const CuentaPresentacion & Estadisticas::acumulado () {
+        return m_acumulado;
+    }
+
+    inline const std::vector <Estadisticas::CuentaClase> & Estadisticas::clases () {
+        return m_clases;
+    }
+
+
+}
@@ -33,6 +33,10 @@ void Fuentes::carga (const std::string & nombre) {
 	}
 	this->tabla_fuentes.insert (std::pair {nombre, fuente});
 	fuentes_cargadas ++;
+	RegistroRecursos::Recurso recurso {};
+	recurso.clase  = ClaseRecurso::fuente;
+	recurso.nombre = camino.string ();
+	RegistroRecursos::registra (fuente, recurso);
 }
 
 
@@ -40,6 +44,7 @@ void Fuentes::descarga () {
 	fuentes_cargadas -= static_cast <int> (this->tabla_fuentes.size ());
 	// no estoy seguro que esto sea necesario:
 	for (const std::pair <string, sf::Font *> & pareja : this->tabla_fuentes) {
+		RegistroRecursos::retira (pareja.second);
 		delete pareja.second;
 	}
 	this->tabla_fuentes.clear ();
@@ -49,6 +49,7 @@ namespace unir2d {
 
 		friend class Texto;
         friend class JuegoBase;
+        friend class PanelRendimiento;
 
 	};
 
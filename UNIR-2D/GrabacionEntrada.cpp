@@ -0,0 +1,226 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: GrabacionEntrada.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+#include "UNIR-2D.h"
+
+using namespace unir2d;
+
+
+/// @cond
+
+
+GrabacionEntrada::GrabacionEntrada (const std::filesystem::path & archivo, bool grabando, bool rapida) {
+    this->grabando = grabando;
+    this->rapida   = rapida;
+    if (grabando) {
+        salida.open (archivo, std::ios::binary | std::ios::trunc);
+        if (! salida) {
+            throw std::runtime_error {"No se puede crear la grabación de la entrada: " + archivo.string ()};
+        }
+    } else {
+        entrada.open (archivo, std::ios::binary);
+        if (! entrada) {
+            throw std::runtime_error {"No se puede abrir la grabación de la entrada: " + archivo.string ()};
+        }
+    }
+    sucesos.reserve (256);
+}
+
+
+GrabacionEntrada::~GrabacionEntrada () {
+    Tiempo::reloj_simulado = false;
+}
+
+
+void GrabacionEntrada::inicia (uint32_t & semilla, sf::Vector2i & raton) {
+    if (grabando) {
+        sucesos.clear ();
+        sucesos.insert (sucesos.end (), {'U', '2', 'G', 'E'});
+        escribe (version);
+        escribe (semilla);
+        escribe ((int16_t) raton.x);
+        escribe ((int16_t) raton.y);
+        salida.write ((const char *) sucesos.data (), (std::streamsize) sucesos.size ());
+        sucesos.clear ();
+    } else {
+        char firma [4] {};
+        uint32_t version_leida {};
+        int16_t x {};
+        int16_t y {};
+        entrada.read (firma, 4);
+        if (! entrada || std::memcmp (firma, "U2GE", 4) != 0 || 
+            ! lee (version_leida) || version_leida != version || ! lee (semilla) || 
+            ! lee (x) || ! lee (y)) {
+            throw std::runtime_error {"La grabación de la entrada no es válida."};
+        }
+        // el ratón parte de la posición grabada, no de la real
+        raton = sf::Vector2i {x, y};
+        // la medición global del tiempo sigue los tiempos grabados
+        inicio = Momento {};
+        Tiempo::reloj_simulado   = true;
+        Tiempo::momento_simulado = inicio;
+    }
+    ultimo_suceso = inicio;
+}
+
+
+void GrabacionEntrada::ponOrigen (const Tiempo & tiempo) {
+    // Los lapsos de los sucesos se miden desde el inicio de la medición global del tiempo, del 
+    // que se miden también los segundos de cada ciclo. Al reproducir, es el momento simulado 
+    // inicial.
+    inicio        = tiempo.inicio_tiempo;
+    ultimo_suceso = inicio;
+}
+
+
+void GrabacionEntrada::registra (const sf::Event & suceso, Momento momento) {
+    TipoSuceso tipo;
+    switch (suceso.type) {
+    case sf::Event::KeyPressed:          tipo = TipoSuceso::pulsaTecla;  break;
+    case sf::Event::KeyReleased:         tipo = TipoSuceso::sueltaTecla; break;
+    case sf::Event::MouseButtonPressed:  tipo = TipoSuceso::pulsaBoton;  break;
+    case sf::Event::MouseButtonReleased: tipo = TipoSuceso::sueltaBoton; break;
+    case sf::Event::MouseMoved:          tipo = TipoSuceso::mueveRaton;  break;
+    case sf::Event::LostFocus:           tipo = TipoSuceso::pierdeFoco;  break;
+    case sf::Event::GainedFocus:         tipo = TipoSuceso::ganaFoco;    break;
+    default:
+        return;
+    }
+    uint32_t lapso = (uint32_t) std::chrono::duration_cast <std::chrono::microseconds> (
+            momento - ultimo_suceso).count ();
+    ultimo_suceso = momento;
+    //
+    // solo cuenta la última posición de una serie de movimientos del ratón
+    if (tipo == TipoSuceso::mueveRaton && ultimo_movimiento != SIZE_MAX) {
+        uint32_t lapso_previo {};
+        std::memcpy (& lapso_previo, & sucesos [ultimo_movimiento + 1], sizeof (lapso_previo));
+        lapso += lapso_previo;
+        sucesos.resize (ultimo_movimiento);
+        cuenta_sucesos --;
+    }
+    ultimo_movimiento = tipo == TipoSuceso::mueveRaton ? sucesos.size () : SIZE_MAX;
+    //
+    escribe ((uint8_t) tipo);
+    escribe (lapso);
+    switch (tipo) {
+    case TipoSuceso::pulsaTecla:
+    case TipoSuceso::sueltaTecla:
+        escribe ((uint8_t) suceso.key.code);
+        break;
+    case TipoSuceso::pulsaBoton:
+    case TipoSuceso::sueltaBoton:
+        escribe ((uint8_t) suceso.mouseButton.button);
+        escribe ((int16_t) suceso.mouseButton.x);
+        escribe ((int16_t) suceso.mouseButton.y);
+        break;
+    case TipoSuceso::mueveRaton:
+        escribe ((int16_t) suceso.mouseMove.x);
+        escribe ((int16_t) suceso.mouseMove.y);
+        break;
+    default:
+        break;
+    }
+    cuenta_sucesos ++;
+}
+
+
+void GrabacionEntrada::cierraCiclo (int ciclo, double segundos) {
+    if (! grabando) {
+        return;
+    }
+    uint32_t numero = (uint32_t) ciclo;
+    salida.write ((const char *) & numero, sizeof (numero));
+    salida.write ((const char *) & segundos, sizeof (double));
+    salida.write ((const char *) & cuenta_sucesos, sizeof (uint16_t));
+    salida.write ((const char *) sucesos.data (), (std::streamsize) sucesos.size ());
+    sucesos.clear ();
+    cuenta_sucesos = 0;
+    ultimo_movimiento = SIZE_MAX;
+}
+
+
+bool GrabacionEntrada::reproduce (int ciclo) {
+    // al terminar la grabación termina la reproducción
+    uint32_t ciclo_leido {};
+    double   segundos {};
+    uint16_t cuenta {};
+    if (! lee (ciclo_leido) || ! lee (segundos) || ! lee (cuenta)) {
+        return false;
+    }
+    if (ciclo_leido != (uint32_t) ciclo) {
+        throw std::runtime_error {"La grabación de la entrada no corresponde a la ejecución."};
+    }
+    for (int indice = 0; indice < cuenta; ++ indice) {
+        uint8_t  tipo {};
+        uint32_t lapso {};
+        if (! lee (tipo) || ! lee (lapso)) {
+            return false;
+        }
+        ultimo_suceso += std::chrono::microseconds {lapso};
+        sf::Event suceso {};
+        uint8_t dato {};
+        int16_t x {}; 
+        int16_t y {};
+        switch ((TipoSuceso) tipo) {
+        case TipoSuceso::pulsaTecla:
+        case TipoSuceso::sueltaTecla:
+            lee (dato);
+            suceso.type = (TipoSuceso) tipo == TipoSuceso::pulsaTecla ? 
+                    sf::Event::KeyPressed : sf::Event::KeyReleased;
+            suceso.key.code = (sf::Keyboard::Key) dato;
+            break;
+        case TipoSuceso::pulsaBoton:
+        case TipoSuceso::sueltaBoton:
+            lee (dato);
+            lee (x);
+            lee (y);
+            suceso.type = (TipoSuceso) tipo == TipoSuceso::pulsaBoton ? 
+                    sf::Event::MouseButtonPressed : sf::Event::MouseButtonReleased;
+            suceso.mouseButton.button = (sf::Mouse::Button) dato;
+            suceso.mouseButton.x = x;
+            suceso.mouseButton.y = y;
+            break;
+        case TipoSuceso::mueveRaton:
+            lee (x);
+            lee (y);
+            suceso.type = sf::Event::MouseMoved;
+            suceso.mouseMove.x = x;
+            suceso.mouseMove.y = y;
+            break;
+        case TipoSuceso::pierdeFoco:
+            suceso.type = sf::Event::LostFocus;
+            break;
+        case TipoSuceso::ganaFoco:
+            suceso.type = sf::Event::GainedFocus;
+            break;
+        default:
+            throw std::runtime_error {"La grabación de la entrada no es válida."};
+        }
+        if (! entrada) {
+            return false;
+        }
+        Teclado::procesa (suceso, ultimo_suceso);
+        Raton  ::procesa (suceso, ultimo_suceso);
+    }
+    Tiempo::momento_simulado = inicio + std::chrono::duration_cast <std::chrono::nanoseconds> (
+            std::chrono::duration <double> {segundos});
+    return true;
+}
+
+
+/// @endcond
@@ -0,0 +1,113 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: GrabacionEntrada.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    /// @cond
+
+
+    // Graba la entrada del jugador (teclado, ratón y foco de la ventana) ciclo a ciclo en un 
+    // archivo binario, o la reproduce desde el archivo en lugar de la entrada real. Junto con la 
+    // semilla de los números aleatorios y el tiempo de cada ciclo, que también se graban, la 
+    // reproducción repite la ejecución del juego.
+    //
+    // Formato del archivo:
+    //   cabecera: "U2GE", versión (uint32), semilla (uint32), posición inicial del ratón x, y (int16)
+    //   ciclo:    número de ciclo (uint32), segundos (double), número de sucesos (uint16)
+    //   suceso:   tipo (uint8), microsegundos desde el suceso anterior o, el primero, desde el 
+    //             inicio de la medición global del tiempo (uint32), datos:
+    //             tecla: código (uint8); botón: botón (uint8), x, y (int16); movimiento: x, y (int16)
+    class GrabacionEntrada {
+    private:
+
+        using Momento = std::chrono::time_point <std::chrono::steady_clock>;
+
+        static constexpr uint32_t version = 3;
+
+        enum class TipoSuceso : uint8_t {
+            pulsaTecla, sueltaTecla, pulsaBoton, sueltaBoton, mueveRaton, pierdeFoco, ganaFoco
+        };
+
+        bool grabando {};
+        bool rapida {};
+        std::ofstream salida {};
+        std::ifstream entrada {};
+
+        Momento inicio {};
+        Momento ultimo_suceso {};
+        // sucesos del ciclo en curso, codificados
+        std::vector <uint8_t> sucesos {};
+        uint16_t cuenta_sucesos {};
+        // posición del último movimiento del ratón en 'sucesos', para reemplazarlo por el siguiente
+        size_t ultimo_movimiento {SIZE_MAX};
+
+        explicit GrabacionEntrada (const std::filesystem::path & archivo, bool grabando, bool rapida);
+        ~GrabacionEntrada ();
+
+        // No se pueden copiar ni mover las instancias de esta clase      
+        GrabacionEntrada (const GrabacionEntrada & )              = delete;
+        GrabacionEntrada (GrabacionEntrada && )                   = delete;
+        GrabacionEntrada & operator = (const GrabacionEntrada & ) = delete;
+        GrabacionEntrada & operator = (GrabacionEntrada && )      = delete;
+
+        bool reproduciendo () const;
+        bool tiempoReal () const;
+
+        void inicia (uint32_t & semilla, sf::Vector2i & raton);
+        void ponOrigen (const Tiempo & tiempo);
+        void registra (const sf::Event & suceso, Momento momento);
+        void cierraCiclo (int ciclo, double segundos);
+        bool reproduce (int ciclo);
+
+        template <typename T> void escribe (T valor);
+        template <typename T> bool lee (T & valor);
+
+        friend class Motor;
+        friend class Rendidor;
+
+    };
+
+
+    inline bool GrabacionEntrada::reproduciendo () const {
+        return ! grabando;
+    }
+
+    inline bool GrabacionEntrada::tiempoReal () const {
+        return ! rapida;
+    }
+
+    template <typename T> 
+    inline void GrabacionEntrada::escribe (T valor) {
+        const uint8_t * bytes = reinterpret_cast <const uint8_t *> (& valor);
+        sucesos.insert (sucesos.end (), bytes, bytes + sizeof (T));
+    }
+
+    template <typename T> 
+    inline bool GrabacionEntrada::lee (T & valor) {
+        entrada.read (reinterpret_cast <char *> (& valor), sizeof (T));
+        return (bool) entrada;
+    }
+
+
+    /// @endcond
+
+
+}
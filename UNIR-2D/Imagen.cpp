@@ -63,7 +63,6 @@ void Imagen::dibuja (const Transforma & contenedor, Rendidor * rendidor) {
         int y = alto  * (this->fila_seleccion - 1);
         this->sprite.setTextureRect (sf::IntRect (x, y, ancho, alto));    
     }
-    Dibujable::situa (this->sprite, contenedor, this->m_transforma);
     if (this->coloreado) {
         this->sprite.setColor (sf::Color (
                 this->color.rojo (),
@@ -72,7 +71,9 @@ void Imagen::dibuja (const Transforma & contenedor, Rendidor * rendidor) {
                 this->color.alfa ()  ));
     }
     //
-    rendidor->window->draw (this->sprite);
+    sf::RenderStates states {};
+    states.transform = situa (contenedor);
+    rendidor->dibuja (this->sprite, states, "Imagen", 4, this->sprite.getTexture ());
 }
 
 
@@ -84,7 +85,6 @@ void Imagen::dibuja (Textura * textura) {
         int y = alto  * (fila_seleccion - 1);
         this->sprite.setTextureRect (sf::IntRect (x, y, ancho, alto));    
     }
-    sprite.setPosition (this->m_transforma.posicion ().x (), this->m_transforma.posicion ().y ());
     if (this->coloreado) {
         this->sprite.setColor (sf::Color (
                 this->color.rojo (),
@@ -93,7 +93,25 @@ void Imagen::dibuja (Textura * textura) {
                 this->color.alfa ()  ));
     }
     //
-    textura->rendible.draw (this->sprite);
+    // el sprite no guarda la situación; se aplica la transformación propia, sin contenedor
+    sf::RenderStates states {};
+    states.transform = m_transforma.matriz ();
+    Estadisticas::cuentaDibujo ("Imagen", 4, this->sprite.getTexture (), & textura->rendible);
+    textura->rendible.draw (this->sprite, states);
 }
 
 
+Dibujable::ClaveEstado Imagen::claveEstado () const {
+    return ClaveEstado {this->textura, nullptr, sf::TriangleStrip};
+}
+
+
+bool Imagen::limitesPantalla (const Transforma & contenedor, sf::FloatRect & limites) {
+    if (this->textura == nullptr) {
+        return false;
+    }
+    float ancho = (float) (this->textura->rectg_textura.x / colns_estampas);
+    float alto  = (float) (this->textura->rectg_textura.y / filas_estampas); 
+    limites = situa (contenedor).transformRect (sf::FloatRect {0, 0, ancho, alto});
+    return true;
+}
@@ -91,6 +91,8 @@ namespace unir2d {
         
         void dibuja (const Transforma & contenedor, Rendidor * rendidor) override;
         void dibuja (Textura * textura);
+        ClaveEstado claveEstado () const override;
+        bool limitesPantalla (const Transforma & contenedor, sf::FloatRect & limites) override;
 
         friend class Textura;
 
@@ -27,6 +27,7 @@ void JuegoBase::agregaActor (ActorBase * actor) {
     }
     //
     m_actores.push_back (actor);
+    plan_paralelo.vigente = false;
     actor->inicia ();
 }
 
@@ -40,6 +41,7 @@ void JuegoBase::extraeActor (ActorBase * actor) {
     actor->termina ();
     std::vector<ActorBase *>::iterator r =  std::find (m_actores.begin (), m_actores.end (), actor);
     m_actores.erase (r);
+    plan_paralelo.vigente = false;
 }
 
 
@@ -52,15 +54,140 @@ void JuegoBase::extraeActores () {
         actor->termina ();
     }
     m_actores.clear ();
+    plan_paralelo.vigente = false;
 }
 
 
 void JuegoBase::actualizaActores (double segundos_tiempo) {
+    if (! plan_paralelo.vigente || plan_paralelo.cambios != ActorBase::cambios_paralelo.load ()) {
+        planificaParalelo ();
+    }
+    //
     permiso_actores = false;
-    for (ActorBase * actor : m_actores) {
-        actor->actualiza (segundos_tiempo);
+    if (plan_paralelo.actores.empty ()) {
+        for (ActorBase * actor : m_actores) {
+            actor->actualiza (segundos_tiempo);
+        }
+    } else {
+        actualizaFases (true, segundos_tiempo);
+        // la declaración de un actor puede cambiar durante el ciclo; vale la del plan
+        for (ActorBase * actor : m_actores) {
+            if (! actor->planificado) {
+                actor->actualiza (segundos_tiempo);
+            }
+        }
+        actualizaFases (false, segundos_tiempo);
     }
     permiso_actores = true;
+    //
+    ejecutaAplazadas ();
+}
+
+
+void JuegoBase::planificaParalelo () {
+    PlanParalelo & plan = plan_paralelo;
+    plan.actores.clear ();
+    plan.fases  .clear ();
+    plan.inicios.clear ();
+    for (ActorBase * actor : m_actores) {
+        actor->planificado = actor->paralelo;
+        if (actor->paralelo) {
+            plan.actores.push_back (actor);
+        }
+    }
+    std::stable_sort (plan.actores.begin (), plan.actores.end (), 
+            [] (const ActorBase * actor_1, const ActorBase * actor_2) {
+                return actor_1->fase < actor_2->fase;
+            });
+    //
+    // Dentro de cada fase, cada actor va en el lote siguiente al último lote con el que está en 
+    // conflicto, de modo que los actores en conflicto se actualizan en el orden de la lista.
+    size_t inicio = 0;
+    while (inicio < plan.actores.size ()) {
+        int fase = plan.actores [inicio]->fase;
+        size_t fin = inicio;
+        plan.lotes     .clear ();
+        plan.lecturas  .clear ();
+        plan.escrituras.clear ();
+        while (fin < plan.actores.size () && plan.actores [fin]->fase == fase) {
+            ActorBase * actor = plan.actores [fin];
+            int lote = 0;
+            for (int previo = static_cast <int> (plan.lecturas.size ()) - 1; previo >= 0; -- previo) {
+                if ((actor->escribe & (plan.lecturas [previo] | plan.escrituras [previo])) != 0 ||
+                    (actor->lee     & plan.escrituras [previo]) != 0                          ) {
+                    lote = previo + 1;
+                    break;
+                }
+            }
+            if (lote == plan.lecturas.size ()) {
+                plan.lecturas  .push_back (0);
+                plan.escrituras.push_back (0);
+            }
+            plan.lecturas   [lote] |= actor->lee;
+            plan.escrituras [lote] |= actor->escribe;
+            plan.lotes.push_back ({lote, actor});
+            fin ++;
+        }
+        std::stable_sort (plan.lotes.begin (), plan.lotes.end (), 
+                [] (const std::pair <int, ActorBase *> & par_1, const std::pair <int, ActorBase *> & par_2) {
+                    return par_1.first < par_2.first;
+                });
+        for (size_t indice = 0; indice < plan.lotes.size (); ++ indice) {
+            if (indice == 0 || plan.lotes [indice].first != plan.lotes [indice - 1].first) {
+                plan.fases  .push_back (fase);
+                plan.inicios.push_back (static_cast <int> (inicio + indice));
+            }
+            plan.actores [inicio + indice] = plan.lotes [indice].second;
+        }
+        inicio = fin;
+    }
+    plan.inicios.push_back (static_cast <int> (plan.actores.size ()));
+    //
+    plan.cambios = ActorBase::cambios_paralelo.load ();
+    plan.vigente = true;
+}
+
+
+void JuegoBase::actualizaFases (bool negativas, double segundos_tiempo) {
+    PlanParalelo & plan = plan_paralelo;
+    // la función solo captura 'this' y el tiempo, para que quepa en std::function sin reservar 
+    // memoria
+    std::function <void (int, int)> actualiza = [this, segundos_tiempo] (int desde, int hasta) {
+        for (int indice = desde; indice < hasta; ++ indice) {
+            plan_paralelo.actores [indice]->actualiza (segundos_tiempo);
+        }
+    };
+    int hilos = std::max (Tareas::hilos (), 1);
+    for (size_t tramo = 0; tramo < plan.fases.size (); ++ tramo) {
+        if ((plan.fases [tramo] < 0) != negativas) {
+            continue;
+        }
+        int desde = plan.inicios [tramo];
+        int hasta = plan.inicios [tramo + 1];
+        // unos cuatro trozos por hilo, para repartir bien los actores de coste desigual
+        int trozo = std::max ((hasta - desde) / (4 * hilos), 1);
+        Tareas::paraCada (desde, hasta, trozo, actualiza);
+    }
+}
+
+
+void JuegoBase::ejecutaAplazadas () {
+    //
+    // Las acciones se recogen antes de ejecutarlas porque pueden agregar y extraer actores.
+    for (ActorBase * actor : m_actores) {
+        for (std::function <void ()> & accion : actor->aplazadas) {
+            aplazadas.push_back (std::move (accion));
+        }
+        actor->aplazadas.clear ();
+    }
+    if (aplazadas.empty ()) {
+        return;
+    }
+    for (size_t indice = 0; indice < aplazadas.size (); ++ indice) {
+        std::function <void ()> accion = std::move (aplazadas [indice]);
+        accion ();
+    }
+    aplazadas.clear ();
 }
 
 
@@ -76,14 +203,19 @@ void JuegoBase::presentaActores (Rendidor * rendidor) {
             }
         }
         actor->presentados = 0;
+        actor->validaNodos ();
     }
     //
     while (true) {
         bool presentar_agotado = true;
-        for (ActorBase * actor : m_actores) {
-            actor->presenta (rendidor, indice_z_minimo);
-            if (actor->presentados < actor->m_dibujos.size ()) {
-                presentar_agotado = false;
+        if (ordena_estados) {
+            presentar_agotado = presentaNivel (rendidor, indice_z_minimo);
+        } else {
+            for (ActorBase * actor : m_actores) {
+                actor->presenta (rendidor, indice_z_minimo);
+                if (actor->presentados < actor->m_dibujos.size ()) {
+                    presentar_agotado = false;
+                }
             }
         }
         if (presentar_agotado) {
@@ -96,11 +228,118 @@ void JuegoBase::presentaActores (Rendidor * rendidor) {
 }
 
 
+bool JuegoBase::presentaNivel (Rendidor * rendidor, int indice_z) {
+    NivelZ & nivel = this->nivel_z;
+    nivel.dibujos.clear ();
+    nivel.actores.clear ();
+    bool agotado = true;
+    for (ActorBase * actor : m_actores) {
+        if (! actor->recoge (indice_z, nivel.dibujos)) {
+            agotado = false;
+        }
+        nivel.actores.resize (nivel.dibujos.size (), actor);
+    }
+    //
+    ordenaNivel ();
+    for (int indice : nivel.orden) {
+        nivel.dibujos [indice]->dibuja (nivel.actores [indice]->contenedor (nivel.dibujos [indice]), rendidor);
+    }
+    for (ActorBase * actor : m_actores) {
+        if (actor->diana && actor->presentados == actor->m_dibujos.size ()) {
+            actor->dibujaDiana (rendidor);
+        }
+    }
+    return agotado;
+}
+
+
+void JuegoBase::ordenaNivel () {
+    NivelZ & nivel = this->nivel_z;
+    int total = (int) nivel.dibujos.size ();
+    nivel.orden.clear ();
+    nivel.claves.resize (total);
+    bool iguales = true;
+    for (int indice = 0; indice < total; ++ indice) {
+        nivel.claves [indice] = nivel.dibujos [indice]->claveEstado ();
+        iguales = iguales && nivel.claves [indice] == nivel.claves [0];
+    }
+    if (iguales) {
+        for (int indice = 0; indice < total; ++ indice) {
+            nivel.orden.push_back (indice);
+        }
+        return;
+    }
+    //
+    // cada dibujo debe presentarse después de los anteriores con los que se solapa
+    nivel.limites.resize (total);
+    nivel.limitados.resize (total);
+    nivel.previos.assign (total, 0);
+    if (nivel.siguientes.size () < total) {
+        nivel.siguientes.resize (total);
+    }
+    for (int posterior = 0; posterior < total; ++ posterior) {
+        nivel.limitados [posterior] = nivel.dibujos [posterior]->limitesPantalla (
+                nivel.actores [posterior]->contenedor (nivel.dibujos [posterior]), 
+                nivel.limites [posterior]);
+        nivel.siguientes [posterior].clear ();
+        for (int anterior = 0; anterior < posterior; ++ anterior) {
+            bool solapa = ! nivel.limitados [anterior] || ! nivel.limitados [posterior] || 
+                          nivel.limites [anterior].intersects (nivel.limites [posterior]);
+            if (solapa) {
+                nivel.siguientes [anterior].push_back (posterior);
+                nivel.previos [posterior] ++;
+            }
+        }
+    }
+    //
+    // de los dibujos listos, se elige el primero con el estado actual o, si no hay ninguno, el 
+    // primero de todos, que pasa a establecer el estado actual
+    nivel.listos.clear ();
+    for (int indice = 0; indice < total; ++ indice) {
+        if (nivel.previos [indice] == 0) {
+            nivel.listos.push_back (indice);
+        }
+    }
+    Dibujable::ClaveEstado actual = nivel.claves [0];
+    while (! nivel.listos.empty ()) {
+        int elegido = -1;
+        int primero = -1;
+        for (int posicion = 0; posicion < nivel.listos.size (); ++ posicion) {
+            int candidato = nivel.listos [posicion];
+            if (primero < 0 || candidato < nivel.listos [primero]) {
+                primero = posicion;
+            }
+            if (nivel.claves [candidato] == actual && (elegido < 0 || candidato < nivel.listos [elegido])) {
+                elegido = posicion;
+            }
+        }
+        if (elegido < 0) {
+            elegido = primero;
+        }
+        int indice = nivel.listos [elegido];
+        nivel.listos [elegido] = nivel.listos.back ();
+        nivel.listos.pop_back ();
+        //
+        actual = nivel.claves [indice];
+        nivel.orden.push_back (indice);
+        for (int siguiente : nivel.siguientes [indice]) {
+            nivel.previos [siguiente] --;
+            if (nivel.previos [siguiente] == 0) {
+                nivel.listos.push_back (siguiente);
+            }
+        }
+    }
+    assert (nivel.orden.size () == total);
+}
+
+
 void JuegoBase::validaVacio () {
+    RegistroRecursos::escribeFugas (std::cout);
     assert (ActorBase  ::cuenta_instancias == 0);
     assert (Textura    ::cuenta_instancias == 0);
     assert (Fuentes    ::fuentes_cargadas  == 0);
     assert (Dibujable  ::cuenta_instancias == 0);
 //    assert (BuzonSonido::cuenta_instancias == 0);
     assert (Sonido     ::cuenta_instancias == 0);
+    assert (Audio      ::sonidosCargados () == 0);
 }
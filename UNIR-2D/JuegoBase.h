@@ -79,6 +79,31 @@ namespace unir2d {
         /// @param valor Estado de ejecución del juego.
         void ponEjecucion (EjecucionJuego valor);
 
+        /// @brief Indica si los dibujables con el mismo índice Z se agrupan por estado de 
+        /// presentación.
+        /// @return Si se agrupan los dibujables.
+        bool ordenaEstados () const;
+
+        /// @brief Establece si los dibujables con el mismo índice Z se agrupan por estado de 
+        /// presentación.
+        /// @details Si se agrupan, los dibujables de un mismo índice Z que usan la misma textura, 
+        /// el mismo sombreador y el mismo tipo de primitiva se presentan seguidos, lo que reduce 
+        /// los cambios de estado de la tarjeta gráfica. Los dibujables cuyos rectángulos en 
+        /// pantalla se cortan conservan su orden, por lo que el resultado en pantalla no cambia.
+        /// La comprobación de los cortes compara cada par de dibujables del mismo índice Z, así que 
+        /// conviene en escenas con pocos dibujables por índice Z y muchos cambios de textura. Por 
+        /// defecto, no se agrupan.
+        /// @param valor Si se agrupan los dibujables.
+        void ponOrdenaEstados (bool valor);
+
+        /// @brief Obtiene la semilla de los números aleatorios del juego.
+        /// @details La clase Motor elige una semilla distinta en cada ejecución, antes de llamar 
+        /// al método JuegoBase::inicia. Si se graba la entrada del jugador, la semilla se graba con 
+        /// ella, y si se reproduce una grabación, la semilla es la grabada (véase 
+        /// Motor::reproduceEntrada).
+        /// @return La semilla.
+        uint32_t semilla () const;
+
     protected:
 
         /// @brief Constructor por defecto.
@@ -130,6 +155,12 @@ namespace unir2d {
 	    /// @param tiempo_seg: tiempo en segundos desde el inicio de la ejecución del juego. 
         virtual void posactualiza (double tiempo_seg);
 
+        /// @brief Obtiene el nombre del estado actual del juego.
+        /// @details El nombre aparece en el panel de rendimiento (véase Motor::ponPanelRendimiento). 
+        /// Por defecto, devuelve una cadena vacía.
+        /// @return Nombre del estado del juego.
+        virtual string nombreEstado () const;
+
         /// @brief Comprueba que todas las referencias mantenidas por esta instancia han quedado 
         /// anuladas. 
         /// @details Se usa para validar que, al final de la ejecución del juego, no quedan 
@@ -146,6 +177,41 @@ namespace unir2d {
 
         bool permiso_actores {true};
 
+        // Dibujos de un mismo índice Z pendientes de presentar. Se conservan entre ciclos para no 
+        // reservar memoria en cada presentación.
+        struct NivelZ {
+            std::vector <Dibujable *>            dibujos    {};
+            std::vector <ActorBase *>            actores    {};
+            std::vector <Dibujable::ClaveEstado> claves     {};
+            std::vector <sf::FloatRect>          limites    {};
+            std::vector <bool>                   limitados  {};
+            std::vector <int>                    previos    {};
+            std::vector <std::vector <int>>      siguientes {};
+            std::vector <int>                    listos     {};
+            std::vector <int>                    orden      {};
+        };
+
+        bool ordena_estados {false};
+        uint32_t m_semilla {};
+        NivelZ nivel_z {};
+
+        // Actores que se actualizan en paralelo, ordenados por fase y por lote. Los actores de un 
+        // lote no están en conflicto entre sí; cada tramo de 'actores' es un lote. Se rehace al 
+        // cambiar la lista de actores o la declaración de alguno de ellos.
+        struct PlanParalelo {
+            bool                      vigente {};
+            int                       cambios {};
+            std::vector <ActorBase *> actores  {};
+            std::vector <int>         fases    {};
+            std::vector <int>         inicios  {};
+            // temporales de la planificación
+            std::vector <std::pair <int, ActorBase *>> lotes      {};
+            std::vector <uint32_t>                     lecturas   {};
+            std::vector <uint32_t>                     escrituras {};
+        };
+        PlanParalelo plan_paralelo {};
+        std::vector <std::function <void ()>> aplazadas {};
+
         // los juegos no se pueden copiar ni mover       
         JuegoBase (const JuegoBase & )              = delete;
         JuegoBase (JuegoBase && )                   = delete;
@@ -153,12 +219,18 @@ namespace unir2d {
         JuegoBase & operator = (JuegoBase && )      = delete;
 
         void actualizaActores (double segundos_tiempo);
+        void planificaParalelo ();
+        void actualizaFases (bool negativas, double segundos_tiempo);
+        void ejecutaAplazadas ();
         void presentaActores (Rendidor * rendidor);
+        bool presentaNivel (Rendidor * rendidor, int indice_z);
+        void ordenaNivel ();
 
     private:
 
         friend class Motor;
         friend class Rendidor;
+        friend class PanelRendimiento;
 
     };
 
@@ -171,6 +243,14 @@ namespace unir2d {
         m_ejecucion = valor;
     }
 
+    inline bool JuegoBase::ordenaEstados () const {
+        return ordena_estados;
+    }
+
+    inline void JuegoBase::ponOrdenaEstados (bool valor) {
+        ordena_estados = valor;
+    }
+
     inline void JuegoBase::inicia () {
     }
 
@@ -183,6 +263,14 @@ namespace unir2d {
     inline void JuegoBase::posactualiza (double tiempo_seg) {
     }
 
+    inline uint32_t JuegoBase::semilla () const {
+        return m_semilla;
+    }
+
+    inline string JuegoBase::nombreEstado () const {
+        return string {};
+    }
+
     inline const std::vector<ActorBase *> & JuegoBase::actores () const {
         return m_actores;
     }
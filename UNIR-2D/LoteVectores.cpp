@@ -0,0 +1,250 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: LoteVectores.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+#include "UNIR-2D.h"
+
+// La versión AVX2 usa también FMA, que GCC y Clang habilitan aparte (-mfma); /arch:AVX2 de 
+// MSVC habilita las dos.
+#if defined (__AVX2__) && (defined (__FMA__) || defined (_MSC_VER))
+    #define UNIR2D_LOTE_AVX2
+    #include <immintrin.h>
+#elif defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define UNIR2D_LOTE_SSE2
+    #include <emmintrin.h>
+#endif
+
+using namespace unir2d;
+
+
+/// @cond
+
+
+// Cada operación recorre primero los bloques completos con instrucciones vectoriales y después
+// los vectores restantes con instrucciones escalares.
+#if defined (UNIR2D_LOTE_AVX2)
+    static constexpr size_t ancho_bloque = 8;
+#elif defined (UNIR2D_LOTE_SSE2)
+    static constexpr size_t ancho_bloque = 4;
+#else
+    static constexpr size_t ancho_bloque = 1;
+#endif
+
+
+void LoteVectores::transforma (Vector eje_x, Vector eje_y, Vector traslacion) {
+    float * px = comps_x.data ();
+    float * py = comps_y.data ();
+    size_t total  = cuenta ();
+    size_t indice = 0;
+#if defined (UNIR2D_LOTE_AVX2)
+    __m256 a00 = _mm256_set1_ps (eje_x.x ());
+    __m256 a10 = _mm256_set1_ps (eje_x.y ());
+    __m256 a01 = _mm256_set1_ps (eje_y.x ());
+    __m256 a11 = _mm256_set1_ps (eje_y.y ());
+    __m256 tx  = _mm256_set1_ps (traslacion.x ());
+    __m256 ty  = _mm256_set1_ps (traslacion.y ());
+    for (; indice + ancho_bloque <= total; indice += ancho_bloque) {
+        __m256 x = _mm256_loadu_ps (px + indice);
+        __m256 y = _mm256_loadu_ps (py + indice);
+        __m256 rx = _mm256_fmadd_ps (a00, x, _mm256_fmadd_ps (a01, y, tx));
+        __m256 ry = _mm256_fmadd_ps (a10, x, _mm256_fmadd_ps (a11, y, ty));
+        _mm256_storeu_ps (px + indice, rx);
+        _mm256_storeu_ps (py + indice, ry);
+    }
+#elif defined (UNIR2D_LOTE_SSE2)
+    __m128 a00 = _mm_set1_ps (eje_x.x ());
+    __m128 a10 = _mm_set1_ps (eje_x.y ());
+    __m128 a01 = _mm_set1_ps (eje_y.x ());
+    __m128 a11 = _mm_set1_ps (eje_y.y ());
+    __m128 tx  = _mm_set1_ps (traslacion.x ());
+    __m128 ty  = _mm_set1_ps (traslacion.y ());
+    for (; indice + ancho_bloque <= total; indice += ancho_bloque) {
+        __m128 x = _mm_loadu_ps (px + indice);
+        __m128 y = _mm_loadu_ps (py + indice);
+        __m128 rx = _mm_add_ps (_mm_add_ps (_mm_mul_ps (a00, x), _mm_mul_ps (a01, y)), tx);
+        __m128 ry = _mm_add_ps (_mm_add_ps (_mm_mul_ps (a10, x), _mm_mul_ps (a11, y)), ty);
+        _mm_storeu_ps (px + indice, rx);
+        _mm_storeu_ps (py + indice, ry);
+    }
+#endif
+    for (; indice < total; ++ indice) {
+        float x = px [indice];
+        float y = py [indice];
+        px [indice] = eje_x.x () * x + eje_y.x () * y + traslacion.x ();
+        py [indice] = eje_x.y () * x + eje_y.y () * y + traslacion.y ();
+    }
+}
+
+
+void LoteVectores::transforma (const Transforma & transformacion) {
+    const float * m = transformacion.matriz ().getMatrix ();
+    // matriz de 4x4 de SFML, por columnas
+    transforma (Vector {m [0], m [1]}, Vector {m [4], m [5]}, Vector {m [12], m [13]});
+}
+
+
+void LoteVectores::traslada (Vector desplazamiento) {
+    float * px = comps_x.data ();
+    float * py = comps_y.data ();
+    size_t total  = cuenta ();
+    size_t indice = 0;
+#if defined (UNIR2D_LOTE_AVX2)
+    __m256 dx = _mm256_set1_ps (desplazamiento.x ());
+    __m256 dy = _mm256_set1_ps (desplazamiento.y ());
+    for (; indice + ancho_bloque <= total; indice += ancho_bloque) {
+        _mm256_storeu_ps (px + indice, _mm256_add_ps (_mm256_loadu_ps (px + indice), dx));
+        _mm256_storeu_ps (py + indice, _mm256_add_ps (_mm256_loadu_ps (py + indice), dy));
+    }
+#elif defined (UNIR2D_LOTE_SSE2)
+    __m128 dx = _mm_set1_ps (desplazamiento.x ());
+    __m128 dy = _mm_set1_ps (desplazamiento.y ());
+    for (; indice + ancho_bloque <= total; indice += ancho_bloque) {
+        _mm_storeu_ps (px + indice, _mm_add_ps (_mm_loadu_ps (px + indice), dx));
+        _mm_storeu_ps (py + indice, _mm_add_ps (_mm_loadu_ps (py + indice), dy));
+    }
+#endif
+    for (; indice < total; ++ indice) {
+        px [indice] += desplazamiento.x ();
+        py [indice] += desplazamiento.y ();
+    }
+}
+
+
+void LoteVectores::normas (std::vector <float> & resultado) const {
+    distancias (Vector {}, resultado);
+}
+
+
+void LoteVectores::distancias (Vector punto, std::vector <float> & resultado) const {
+    const float * px = comps_x.data ();
+    const float * py = comps_y.data ();
+    size_t total  = cuenta ();
+    size_t indice = 0;
+    resultado.resize (total);
+    float * pr = resultado.data ();
+#if defined (UNIR2D_LOTE_AVX2)
+    __m256 cx = _mm256_set1_ps (punto.x ());
+    __m256 cy = _mm256_set1_ps (punto.y ());
+    for (; indice + ancho_bloque <= total; indice += ancho_bloque) {
+        __m256 x = _mm256_sub_ps (_mm256_loadu_ps (px + indice), cx);
+        __m256 y = _mm256_sub_ps (_mm256_loadu_ps (py + indice), cy);
+        __m256 c = _mm256_fmadd_ps (x, x, _mm256_mul_ps (y, y));
+        _mm256_storeu_ps (pr + indice, _mm256_sqrt_ps (c));
+    }
+#elif defined (UNIR2D_LOTE_SSE2)
+    __m128 cx = _mm_set1_ps (punto.x ());
+    __m128 cy = _mm_set1_ps (punto.y ());
+    for (; indice + ancho_bloque <= total; indice += ancho_bloque) {
+        __m128 x = _mm_sub_ps (_mm_loadu_ps (px + indice), cx);
+        __m128 y = _mm_sub_ps (_mm_loadu_ps (py + indice), cy);
+        __m128 c = _mm_add_ps (_mm_mul_ps (x, x), _mm_mul_ps (y, y));
+        _mm_storeu_ps (pr + indice, _mm_sqrt_ps (c));
+    }
+#endif
+    for (; indice < total; ++ indice) {
+        float x = px [indice] - punto.x ();
+        float y = py [indice] - punto.y ();
+        pr [indice] = std::sqrt (x * x + y * y);
+    }
+}
+
+
+Region LoteVectores::limites () const {
+    size_t total = cuenta ();
+    if (total == 0) {
+        return Region {};
+    }
+    const float * px = comps_x.data ();
+    const float * py = comps_y.data ();
+    float min_x = px [0];
+    float min_y = py [0];
+    float max_x = px [0];
+    float max_y = py [0];
+    size_t indice = 0;
+#if defined (UNIR2D_LOTE_AVX2)
+    if (total >= ancho_bloque) {
+        __m256 vmin_x = _mm256_loadu_ps (px);
+        __m256 vmin_y = _mm256_loadu_ps (py);
+        __m256 vmax_x = vmin_x;
+        __m256 vmax_y = vmin_y;
+        for (indice = ancho_bloque; indice + ancho_bloque <= total; indice += ancho_bloque) {
+            __m256 x = _mm256_loadu_ps (px + indice);
+            __m256 y = _mm256_loadu_ps (py + indice);
+            vmin_x = _mm256_min_ps (vmin_x, x);
+            vmin_y = _mm256_min_ps (vmin_y, y);
+            vmax_x = _mm256_max_ps (vmax_x, x);
+            vmax_y = _mm256_max_ps (vmax_y, y);
+        }
+        alignas (32) float tmin_x [8], tmin_y [8], tmax_x [8], tmax_y [8];
+        _mm256_store_ps (tmin_x, vmin_x);
+        _mm256_store_ps (tmin_y, vmin_y);
+        _mm256_store_ps (tmax_x, vmax_x);
+        _mm256_store_ps (tmax_y, vmax_y);
+        for (size_t carril = 0; carril < ancho_bloque; ++ carril) {
+            min_x = std::min (min_x, tmin_x [carril]);
+            min_y = std::min (min_y, tmin_y [carril]);
+            max_x = std::max (max_x, tmax_x [carril]);
+            max_y = std::max (max_y, tmax_y [carril]);
+        }
+    }
+#elif defined (UNIR2D_LOTE_SSE2)
+    if (total >= ancho_bloque) {
+        __m128 vmin_x = _mm_loadu_ps (px);
+        __m128 vmin_y = _mm_loadu_ps (py);
+        __m128 vmax_x = vmin_x;
+        __m128 vmax_y = vmin_y;
+        for (indice = ancho_bloque; indice + ancho_bloque <= total; indice += ancho_bloque) {
+            __m128 x = _mm_loadu_ps (px + indice);
+            __m128 y = _mm_loadu_ps (py + indice);
+            vmin_x = _mm_min_ps (vmin_x, x);
+            vmin_y = _mm_min_ps (vmin_y, y);
+            vmax_x = _mm_max_ps (vmax_x, x);
+            vmax_y = _mm_max_ps (vmax_y, y);
+        }
+        alignas (16) float tmin_x [4], tmin_y [4], tmax_x [4], tmax_y [4];
+        _mm_store_ps (tmin_x, vmin_x);
+        _mm_store_ps (tmin_y, vmin_y);
+        _mm_store_ps (tmax_x, vmax_x);
+        _mm_store_ps (tmax_y, vmax_y);
+        for (size_t carril = 0; carril < ancho_bloque; ++ carril) {
+            min_x = std::min (min_x, tmin_x [carril]);
+            min_y = std::min (min_y, tmin_y [carril]);
+            max_x = std::max (max_x, tmax_x [carril]);
+            max_y = std::max (max_y, tmax_y [carril]);
+        }
+    }
+#endif
+    for (; indice < total; ++ indice) {
+        min_x = std::min (min_x, px [indice]);
+        min_y = std::min (min_y, py [indice]);
+        max_x = std::max (max_x, px [indice]);
+        max_y = std::max (max_y, py [indice]);
+    }
+    return Region {min_x, min_y, max_x - min_x, max_y - min_y};
+}
+
+
+void LoteVectores::vierte (std::vector <Vector> & destino) const {
+    size_t total = cuenta ();
+    destino.resize (total);
+    for (size_t indice = 0; indice < total; ++ indice) {
+        destino [indice] = Vector {comps_x [indice], comps_y [indice]};
+    }
+}
+
+
+/// @endcond
@@ -0,0 +1,142 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: LoteVectores.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    /// @brief Conjunto de vectores almacenado para realizar cálculos en bloque.
+    /// @details Los componentes 'x' e 'y' de los vectores se almacenan en dos tablas separadas 
+    /// (estructura de tablas), de modo que las operaciones de esta clase se realizan con 
+    /// instrucciones vectoriales del procesador: AVX2 y FMA si el compilador las habilita 
+    /// (opción '/arch:AVX2'), SSE2 en los procesadores de 64 bits, o instrucciones escalares en 
+    /// otro caso.<p>
+    /// Esta clase es adecuada para generar geometría: por ejemplo, se cargan las coordenadas de 
+    /// las celdas, se transforman en las posiciones de los centros y se trasladan para obtener los 
+    /// vértices.
+    class LoteVectores {
+    public:
+
+        /// @brief Constructor de un lote vacío.
+        explicit LoteVectores () = default;
+
+        /// @brief Constructor de un lote con el número de vectores indicado, todos cero.
+        /// @param cuenta Número de vectores.
+        explicit LoteVectores (size_t cuenta);
+
+        /// @brief Número de vectores del lote.
+        size_t cuenta () const;
+
+        /// @brief Cambia el número de vectores del lote. Los vectores agregados son cero.
+        /// @param cuenta Número de vectores.
+        void redimensiona (size_t cuenta);
+
+        /// @brief Reserva memoria para el número de vectores indicado.
+        /// @param cuenta Número de vectores.
+        void reserva (size_t cuenta);
+
+        /// @brief Agrega un vector al final del lote.
+        /// @param vector El vector agregado.
+        void agrega (Vector vector);
+
+        /// @brief Obtiene un vector del lote.
+        /// @param indice Posición del vector, a partir de 0.
+        /// @return El vector.
+        Vector vector (size_t indice) const;
+
+        /// @brief Cambia un vector del lote.
+        /// @param indice Posición del vector, a partir de 0.
+        /// @param valor Valor del vector.
+        void ponVector (size_t indice, Vector valor);
+
+        /// @brief Aplica una transformación afín a todos los vectores del lote.
+        /// @details Cada vector 'v' se sustituye por 'v.x * eje_x + v.y * eje_y + traslacion'.
+        /// @param eje_x Imagen del vector (1, 0) sin traslación.
+        /// @param eje_y Imagen del vector (0, 1) sin traslación.
+        /// @param traslacion Vector sumado al resultado.
+        void transforma (Vector eje_x, Vector eje_y, Vector traslacion);
+
+        /// @brief Aplica a todos los vectores del lote la transformación de un dibujable.
+        /// @param transformacion Transformación aplicada (véase Transforma::matriz).
+        void transforma (const Transforma & transformacion);
+
+        /// @brief Suma el vector indicado a todos los vectores del lote.
+        /// @param desplazamiento Vector sumado.
+        void traslada (Vector desplazamiento);
+
+        /// @brief Calcula la norma de todos los vectores del lote.
+        /// @param resultado Recibe una norma para cada vector.
+        void normas (std::vector <float> & resultado) const;
+
+        /// @brief Calcula la distancia desde todos los vectores del lote hasta un punto.
+        /// @param punto El punto.
+        /// @param resultado Recibe una distancia para cada vector.
+        void distancias (Vector punto, std::vector <float> & resultado) const;
+
+        /// @brief Calcula la región mínima que contiene todos los vectores del lote.
+        /// @return La región; si el lote está vacío, la región cero.
+        Region limites () const;
+
+        /// @brief Copia los vectores del lote en un vector de la biblioteca estándar.
+        /// @param destino Recibe los vectores del lote.
+        void vierte (std::vector <Vector> & destino) const;
+
+    private:
+
+        std::vector <float> comps_x {};
+        std::vector <float> comps_y {};
+
+    };
+
+
+    inline LoteVectores::LoteVectores (size_t cuenta) :
+            comps_x (cuenta), 
+            comps_y (cuenta) {
+    }
+
+    inline size_t LoteVectores::cuenta () const {
+        return comps_x.size ();
+    }
+
+    inline void LoteVectores::redimensiona (size_t cuenta) {
+        comps_x.resize (cuenta);
+        comps_y.resize (cuenta);
+    }
+
+    inline void LoteVectores::reserva (size_t cuenta) {
+        comps_x.reserve (cuenta);
+        comps_y.reserve (cuenta);
+    }
+
+    inline void LoteVectores::agrega (Vector vector) {
+        comps_x.push_back (vector.x ());
+        comps_y.push_back (vector.y ());
+    }
+
+    inline Vector LoteVectores::vector (size_t indice) const {
+        return Vector {comps_x [indice], comps_y [indice]};
+    }
+
+    inline void LoteVectores::ponVector (size_t indice, Vector valor) {
+        comps_x [indice] = valor.x ();
+        comps_y [indice] = valor.y ();
+    }
+
+
+}
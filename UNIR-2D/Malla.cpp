@@ -24,6 +24,9 @@ Malla::~Malla () {
     if (textura != nullptr) {
         textura->cuenta_usos --;
     }
+    if (en_tarjeta) {
+        RegistroRecursos::retira (this);
+    }
 }
 
 
@@ -37,10 +40,25 @@ void Malla::asigna (Textura * textura) {
 void Malla::define (int triangulos) {
     this->total_vertices = triangulos;
     this->vertices.resize (triangulos * 3);
+    //
+    // deja de ser indexada: se descarta lo que construye() hubiera preparado
+    this->es_indexada = false;
+    this->desplegada  = false;
+    this->vertices_unicos.clear ();
+    this->indices.clear ();
+    if (this->en_tarjeta) {
+        RegistroRecursos::retira (this);
+        this->en_tarjeta = false;
+        this->desplegado = sf::VertexBuffer {};
+    }
+    this->vertices.setPrimitiveType (sf::Triangles);
 }
 
 
 void Malla::asigna (int indice, TrianguloMalla triangulo) {
+    if (this->es_indexada) {
+        throw std::runtime_error {"Malla::asigna: la malla es indexada; antes hay que llamar a define()"};
+    }
     assert (0 <= indice && indice < this->total_vertices);
     //
     for (int i = 0; i < 3; ++ i) {
@@ -53,16 +71,136 @@ void Malla::asigna (int indice, TrianguloMalla triangulo) {
 }
 
 
+void Malla::construye (const std::vector <Vector> & puntos, const std::vector <Vector> & texels) {
+    assert (puntos.size () == texels.size ());
+    assert (puntos.size () % 3 == 0);
+    //
+    suelda (puntos.data (), texels.data (), puntos.size ());
+}
+
+
+void Malla::construye (const std::vector <TrianguloMalla> & triangulos) {
+    std::vector <Vector> puntos {};
+    std::vector <Vector> texels {};
+    puntos.reserve (triangulos.size () * 3);
+    texels.reserve (triangulos.size () * 3);
+    for (const TrianguloMalla & triangulo : triangulos) {
+        puntos.insert (puntos.end (), triangulo.puntos.begin (), triangulo.puntos.end ());
+        texels.insert (texels.end (), triangulo.texels.begin (), triangulo.texels.end ());
+    }
+    suelda (puntos.data (), texels.data (), puntos.size ());
+}
+
+
+// Clave de soldadura de un vértice: los bits de sus cuatro componentes. Dos vértices se sueldan 
+// solo si son idénticos, no si son aproximadamente iguales.
+struct ClaveVertice {
+    std::array <uint32_t, 4> bits;
+    bool operator == (const ClaveVertice & otra) const = default;
+};
+
+
+struct DispersaVertice {
+    size_t operator () (const ClaveVertice & clave) const {
+        // FNV-1a sobre los cuatro componentes
+        uint64_t valor = 14695981039346656037ull;
+        for (uint32_t bits : clave.bits) {
+            valor ^= bits;
+            valor *= 1099511628211ull;
+        }
+        return static_cast <size_t> (valor);
+    }
+};
+
+
+static uint32_t bitsFlotante (float valor) {
+    // +0.0 y -0.0 son el mismo vértice
+    if (valor == 0.0f) {
+        return 0;
+    }
+    return std::bit_cast <uint32_t> (valor);
+}
+
+
+void Malla::suelda (const Vector * puntos, const Vector * texels, size_t cuenta) {
+    this->es_indexada = true;
+    this->desplegada  = false;
+    this->total_vertices = 0;
+    this->vertices.clear ();
+    //
+    this->vertices_unicos.clear ();
+    this->indices.clear ();
+    this->indices.reserve (cuenta);
+    //
+    std::unordered_map <ClaveVertice, uint32_t, DispersaVertice> soldados {};
+    soldados.reserve (cuenta);
+    for (size_t indc = 0; indc < cuenta; ++ indc) {
+        const Vector & punto = puntos [indc];
+        const Vector & texel = texels [indc];
+        ClaveVertice clave {
+                bitsFlotante (punto.x ()), bitsFlotante (punto.y ()), 
+                bitsFlotante (texel.x ()), bitsFlotante (texel.y ())  };
+        auto [posicion, nuevo] = soldados.try_emplace (clave, static_cast <uint32_t> (vertices_unicos.size ()));
+        if (nuevo) {
+            vertices_unicos.push_back (sf::Vertex {
+                    sf::Vector2f {punto.x (), punto.y ()}, 
+                    sf::Vector2f {texel.x (), texel.y ()}  });
+        }
+        this->indices.push_back (posicion->second);
+    }
+    this->vertices_unicos.shrink_to_fit ();
+}
+
+
+void Malla::despliega () {
+    // SFML 2.5 no presenta primitivas indexadas. Los triángulos se despliegan una sola vez: en el 
+    // búfer de vértices de la tarjeta gráfica si está disponible, y si no, en memoria.
+    std::vector <sf::Vertex> triangulos {};
+    triangulos.reserve (indices.size ());
+    for (uint32_t indice : indices) {
+        triangulos.push_back (vertices_unicos [indice]);
+    }
+    if (sf::VertexBuffer::isAvailable () && 
+        desplegado.create (triangulos.size ()) && 
+        desplegado.update (triangulos.data ())    ) {
+        this->en_tarjeta = true;
+        this->vertices.clear ();
+        RegistroRecursos::Recurso recurso {};
+        recurso.clase = ClaseRecurso::vertices;
+        recurso.bytes = triangulos.size () * sizeof (sf::Vertex);
+        RegistroRecursos::registra (this, recurso);
+    } else {
+        if (this->en_tarjeta) {
+            RegistroRecursos::retira (this);
+        }
+        this->en_tarjeta = false;
+        this->vertices.setPrimitiveType (sf::Triangles);
+        this->vertices.resize (triangulos.size ());
+        for (size_t indc = 0; indc < triangulos.size (); ++ indc) {
+            this->vertices [indc] = triangulos [indc];
+        }
+    }
+    this->desplegada = true;
+}
+
+
 void Malla::dibuja (const Transforma & contenedor, Rendidor * rendidor) {
-	//
-    sf::Transformable objeto {};
-	Dibujable::situa (objeto, contenedor, this->m_transforma);
+    if (this->es_indexada && ! this->desplegada) {
+        despliega ();
+    }
 	//
     sf::RenderStates states {};
-    states.transform = objeto.getTransform ();
+    states.transform = situa (contenedor);
     states.texture = & textura->entidad ();
     //
-	rendidor->window->draw (this->vertices, states);
+    if (this->es_indexada && this->en_tarjeta) {
+	    rendidor->dibuja (this->desplegado, states, "Malla", this->desplegado.getVertexCount (), states.texture);
+    } else {
+	    rendidor->dibuja (this->vertices, states, "Malla");
+    }
 }
 
 
+Dibujable::ClaveEstado Malla::claveEstado () const {
+    return ClaveEstado {this->textura, nullptr, sf::Triangles};
+}
@@ -25,7 +25,11 @@ namespace unir2d {
     /// @details Hereda de la clase Dibujable la capacidad de ser presentada en pantalla formando
 	/// parte de un actor del juego (usando una clase derivada de ActorBase).<p>
 	/// Para establecer los triángulos que se presentan en pantalla se usan instancias de la clase 
-    /// TrianguloMalla.
+    /// TrianguloMalla.<p>
+    /// Los triángulos también se pueden establecer todos a la vez mediante el método construye(). 
+    /// En ese caso la malla es 'indexada': los vértices que coinciden en posición y en texel se 
+    /// almacenan una sola vez, y los triángulos se forman con una lista de índices a esos 
+    /// vértices.
     class Malla : public Dibujable {
     public:
 
@@ -44,15 +48,48 @@ namespace unir2d {
         /// @brief Establece el número total de triangulos contenidos en esta instancia.
         /// @details Antes de estableder los triangulos (instancias de la clase TrianguloMalla) 
         /// contenidos en esta instancia, es necesario establecer cuantos habrá. 
+        /// Si la malla era indexada (ver construye()), deja de serlo.
         /// @param triangulos Número total de triangulos contenidos en esta instancia.
         void define (int triangulos);
 
         /// @brief Establece uno de los triangulos contenido en esta instancia. 
+        /// @details No se puede usar con una malla indexada sin llamar antes a define().
         /// @param indice Índice en la lista de esta instancia en el cual estará el triangulo.
         /// @param triangulo Instancia de la clase TrianguloMalla asignada a la lista de esta 
         /// instancia.
         void asigna (int indice, TrianguloMalla triangulo);
 
+        /// @brief Establece todos los triángulos contenidos en esta instancia de una sola vez.
+        /// @details Los vectores 'puntos' y 'texels' tienen el mismo número de elementos, que es 
+        /// un múltiplo de 3. Cada tres elementos consecutivos forman un triángulo, con el mismo 
+        /// significado que en TrianguloMalla.<p>
+        /// Los vértices repetidos (igual punto e igual texel) se sueldan en uno solo y la malla 
+        /// pasa a ser indexada. Sustituye a las llamadas a define() y a asigna().
+        /// @param puntos Posiciones en pantalla de los vértices de los triángulos.
+        /// @param texels Posiciones en la instancia de Textura de los vértices de los triángulos.
+        void construye (const std::vector <Vector> & puntos, const std::vector <Vector> & texels);
+
+        /// @brief Establece todos los triángulos contenidos en esta instancia de una sola vez.
+        /// @details Equivale al otro método construye(), tomando los puntos y los texels de las 
+        /// instancias de TrianguloMalla.
+        /// @param triangulos Triángulos de esta instancia.
+        void construye (const std::vector <TrianguloMalla> & triangulos);
+
+        /// @brief Indica si la malla es indexada.
+        /// @see construye()
+        /// @return Si la malla es indexada.
+        bool indexada () const;
+
+        /// @brief Número de vértices distintos almacenados en esta instancia.
+        /// @return Número de vértices.
+        int cuentaVertices () const;
+
+        /// @brief Número de índices almacenados en esta instancia. 
+        /// @details Es tres veces el número de triángulos si la malla es indexada y cero si no lo 
+        /// es.
+        /// @return Número de índices.
+        int cuentaIndices () const;
+
     private:
 
         Textura * textura {};
@@ -60,15 +97,44 @@ namespace unir2d {
         int total_vertices {0};
         sf::VertexArray vertices {};
 
+        // malla indexada
+        bool es_indexada {false};
+        std::vector <sf::Vertex> vertices_unicos {};
+        std::vector <uint32_t>   indices {};
+        // para presentar la malla indexada, SFML necesita los triángulos desplegados
+        bool desplegada {false};
+        bool en_tarjeta {false};
+        sf::VertexBuffer desplegado {sf::Triangles, sf::VertexBuffer::Static};
+
         // las mallas no se pueden copiar ni mover       
         Malla (const Malla & )              = delete;
         Malla (Malla && )                   = delete;
         Malla & operator = (const Malla & ) = delete;
         Malla & operator = (Malla && )      = delete;
         
+        void suelda (const Vector * puntos, const Vector * texels, size_t cuenta);
+        void despliega ();
+
         void dibuja (const Transforma & contenedor, Rendidor * rendidor) override;
+        ClaveEstado claveEstado () const override;
 
     };
 
 
+    inline bool Malla::indexada () const {
+        return es_indexada;
+    }
+
+    inline int Malla::cuentaVertices () const {
+        if (es_indexada) {
+            return static_cast <int> (vertices_unicos.size ());
+        }
+        return static_cast <int> (vertices.getVertexCount ());
+    }
+
+    inline int Malla::cuentaIndices () const {
+        return static_cast <int> (indices.size ());
+    }
+
+
 }
\ No newline at end of file
@@ -0,0 +1,429 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: MapaBaldosas.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+#include "UNIR-2D.h"
+
+using namespace unir2d;
+
+
+// Cabecera de los archivos de trozos.
+static constexpr char marca_trozo [4] {'U', '2', 'T', 'Z'};
+
+
+MapaBaldosas::MapaBaldosas (int filas, int columnas, Vector tamano_baldosa, int lado_trozo) {
+    assert (filas >= 1);
+    assert (columnas >= 1);
+    assert (lado_trozo >= 1);
+    assert (tamano_baldosa.x () > 0 && tamano_baldosa.y () > 0);
+    //
+    this->m_filas = filas;
+    this->m_colns = columnas;
+    this->lado_trozo = lado_trozo;
+    this->filas_trozos = (filas    + lado_trozo - 1) / lado_trozo;
+    this->colns_trozos = (columnas + lado_trozo - 1) / lado_trozo;
+    this->tamano_baldosa = tamano_baldosa;
+    cuenta_instancias ++;
+}
+
+
+MapaBaldosas::~MapaBaldosas () {
+    cuenta_instancias --;
+}
+
+
+CapaBaldosas * MapaBaldosas::agregaCapa (Textura * textura, int filas_estampas, int colns_estampas, int indice_z) {
+    assert (textura != nullptr);
+    assert (filas_estampas >= 1);
+    assert (colns_estampas >= 1);
+    //
+    int orden = (int) m_capas.size ();
+    CapaBaldosas * capa = new CapaBaldosas {this, orden, textura, filas_estampas, colns_estampas};
+    capa->ponIndiceZ (indice_z);
+    m_capas.emplace_back (capa);
+    return capa;
+}
+
+
+void MapaBaldosas::leeDirectorio (path directorio) {
+    int lado = this->lado_trozo;
+    this->proveedor = [directorio, lado] (int capa, int fila_trozo, int coln_trozo, std::vector <uint32_t> & indices) {
+        path archivo = directorio / ("capa" + std::to_string (capa) + "_" + std::to_string (fila_trozo) + "_" + 
+                                     std::to_string (coln_trozo) + ".trozo");
+        std::ifstream entrada {archivo, std::ios::binary};
+        if (! entrada) {
+            return false;
+        }
+        char marca [4] {};
+        int32_t lado_archivo {};
+        entrada.read (marca, sizeof (marca));
+        entrada.read (reinterpret_cast <char *> (& lado_archivo), sizeof (lado_archivo));
+        if (! entrada || std::memcmp (marca, marca_trozo, sizeof (marca)) != 0 || lado_archivo != lado) {
+            throw std::runtime_error {"El archivo del trozo no es válido: " + archivo.string ()};
+        }
+        indices.resize ((size_t) lado * lado);
+        entrada.read (reinterpret_cast <char *> (indices.data ()), indices.size () * sizeof (uint32_t));
+        if (! entrada) {
+            throw std::runtime_error {"El archivo del trozo está incompleto: " + archivo.string ()};
+        }
+        return true;
+    };
+}
+
+
+void MapaBaldosas::escribeTrozo (path archivo, int lado_trozo, const std::vector <uint32_t> & indices) {
+    assert (indices.size () == (size_t) lado_trozo * lado_trozo);
+    //
+    std::ofstream salida {archivo, std::ios::binary | std::ios::trunc};
+    if (! salida) {
+        throw std::runtime_error {"No se puede escribir el archivo del trozo: " + archivo.string ()};
+    }
+    int32_t lado = lado_trozo;
+    salida.write (marca_trozo, sizeof (marca_trozo));
+    salida.write (reinterpret_cast <const char *> (& lado), sizeof (lado));
+    salida.write (reinterpret_cast <const char *> (indices.data ()), indices.size () * sizeof (uint32_t));
+}
+
+
+void MapaBaldosas::ponMargen (int margen, int cargas_por_ciclo) {
+    assert (margen >= 0);
+    assert (cargas_por_ciclo >= 0);
+    //
+    this->margen = margen;
+    this->cargas_por_ciclo = cargas_por_ciclo;
+}
+
+
+void MapaBaldosas::actualiza (double tiempo_seg) {
+    for (std::unique_ptr <CapaBaldosas> & capa : m_capas) {
+        capa->anima (tiempo_seg);
+        capa->gestionaTrozos ();
+    }
+}
+
+
+CapaBaldosas::CapaBaldosas (MapaBaldosas * mapa, int orden, Textura * textura, int filas_estampas, int colns_estampas) {
+    this->m_mapa = mapa;
+    this->m_orden = orden;
+    this->textura = textura;
+    this->filas_estampas = filas_estampas;
+    this->colns_estampas = colns_estampas;
+    textura->cuenta_usos ++;
+}
+
+
+CapaBaldosas::~CapaBaldosas () {
+    // las lecturas en curso terminan, pero ya no se instalan
+    for (auto & [clave, carga] : cargas) {
+        carga->capa = nullptr;
+    }
+    textura->cuenta_usos --;
+}
+
+
+void CapaBaldosas::animaEstampa (uint32_t estampa, const AnimacionBaldosa & animacion) {
+    assert (! animacion.estampas.empty ());
+    assert (animacion.segundos_estampa > 0);
+    //
+    auto buscado = estampas_animadas.find (estampa);
+    if (buscado != estampas_animadas.end ()) {
+        animaciones [buscado->second].secuencia = animacion;
+        animaciones [buscado->second].actual = 0;
+    } else {
+        estampas_animadas [estampa] = (int) animaciones.size ();
+        animaciones.push_back (Animacion {estampa, animacion});
+    }
+    // los trozos construidos deben registrar las nuevas baldosas animadas
+    for (auto & [clave, trozo] : trozos) {
+        trozo->construido = false;
+    }
+}
+
+
+void CapaBaldosas::anima (double tiempo_seg) {
+    bool alguna = false;
+    for (Animacion & animacion : animaciones) {
+        size_t total = animacion.secuencia.estampas.size ();
+        size_t actual = (size_t) (tiempo_seg / animacion.secuencia.segundos_estampa) % total;
+        animacion.cambiada = (actual != animacion.actual);
+        animacion.actual = actual;
+        alguna = alguna || animacion.cambiada;
+    }
+    if (! alguna) {
+        return;
+    }
+    //
+    // solo se modifican las baldosas animadas cuya estampa ha cambiado
+    for (auto & [clave, trozo] : trozos) {
+        if (! trozo->construido) {
+            continue;
+        }
+        for (auto [vertice, index_anim] : trozo->animadas) {
+            const Animacion & animacion = animaciones [index_anim];
+            if (animacion.cambiada) {
+                colocaEstampa (& trozo->vertices [vertice], animacion.secuencia.estampas [animacion.actual]);
+            }
+        }
+    }
+}
+
+
+void CapaBaldosas::gestionaTrozos () {
+    if (! con_vista) {
+        return;
+    }
+    auto limita = [] (int valor, int maximo) {
+        return std::clamp (valor, 0, maximo - 1);
+    };
+    int margen = m_mapa->margen;
+    int filas_trozos = m_mapa->filas_trozos;
+    int colns_trozos = m_mapa->colns_trozos;
+    int fila_menor = vista_fila_menor;
+    int fila_mayor = vista_fila_mayor;
+    int coln_menor = vista_coln_menor;
+    int coln_mayor = vista_coln_mayor;
+    bool alguno = fila_mayor >= 0 && coln_mayor >= 0 && fila_menor < filas_trozos && coln_menor < colns_trozos;
+    //
+    // se descartan los trozos alejados, se leen los visibles y, poco a poco, los cercanos
+    descartaTrozos (limita (fila_menor - margen - 1, filas_trozos), limita (fila_mayor + margen + 1, filas_trozos), 
+                    limita (coln_menor - margen - 1, colns_trozos), limita (coln_mayor + margen + 1, colns_trozos));
+    if (! alguno) {
+        return;
+    }
+    fila_menor = limita (fila_menor, filas_trozos);
+    fila_mayor = limita (fila_mayor, filas_trozos);
+    coln_menor = limita (coln_menor, colns_trozos);
+    coln_mayor = limita (coln_mayor, colns_trozos);
+    cargaTrozos (fila_menor, fila_mayor, coln_menor, coln_mayor, true);
+    cargaTrozos (limita (fila_menor - margen, filas_trozos), limita (fila_mayor + margen, filas_trozos), 
+                 limita (coln_menor - margen, colns_trozos), limita (coln_mayor + margen, colns_trozos), false);
+}
+
+
+void CapaBaldosas::cargaTrozos (int fila_menor, int fila_mayor, int coln_menor, int coln_mayor, bool todos) {
+    int cargas_ciclo = 0;
+    for (int fila = fila_menor; fila <= fila_mayor; ++ fila) {
+        for (int coln = coln_menor; coln <= coln_mayor; ++ coln) {
+            int clave = fila * m_mapa->colns_trozos + coln;
+            if (trozos.contains (clave) || cargas.contains (clave)) {
+                continue;
+            }
+            if (! todos && cargas_ciclo >= m_mapa->cargas_por_ciclo) {
+                return;
+            }
+            cargaTrozo (clave, fila, coln);
+            cargas_ciclo ++;
+        }
+    }
+}
+
+
+void CapaBaldosas::cargaTrozo (int clave, int fila, int coln) {
+    std::shared_ptr <Carga> carga = std::make_shared <Carga> ();
+    carga->capa = this;
+    carga->clave = clave;
+    // la tarea trabaja con copias: el proveedor se puede cambiar mientras lee
+    MapaBaldosas::Proveedor proveedor = m_mapa->proveedor;
+    size_t total = (size_t) m_mapa->lado_trozo * m_mapa->lado_trozo;
+    int orden = m_orden;
+    auto lee = [carga, proveedor, total, orden, fila, coln] () {
+        carga->existe = proveedor && proveedor (orden, fila, coln, carga->indices);
+        if (! carga->existe) {
+            carga->indices.clear ();
+        } else if (carga->indices.size () != total) {
+            carga->indices.clear ();
+            carga->existe = false;
+            throw std::runtime_error {"El trozo " + std::to_string (fila) + "," + std::to_string (coln) + 
+                                      " de la capa " + std::to_string (orden) + " no tiene " + 
+                                      std::to_string (total) + " baldosas."};
+        }
+    };
+    if (Tareas::hilos () == 0) {
+        lee ();
+        instalaTrozo (* carga);
+        return;
+    }
+    cargas [clave] = carga;
+    int tarea = Tareas::crea ("CapaBaldosas", lee);
+    Tareas::alTerminar (tarea, [carga] () {
+        if (carga->capa != nullptr) {
+            carga->capa->instalaTrozo (* carga);
+        }
+    });
+    Tareas::lanza (tarea);
+}
+
+
+void CapaBaldosas::instalaTrozo (Carga & carga) {
+    // Un trozo que no existe se guarda vacío para no volver a pedirlo. También se guarda vacío 
+    // el trozo cuya lectura ha fallado: el aviso se entrega aunque la tarea lance una excepción.
+    std::unique_ptr <Trozo> trozo = std::make_unique <Trozo> ();
+    if (carga.indices.size () == (size_t) m_mapa->lado_trozo * m_mapa->lado_trozo) {
+        trozo->indices = std::move (carga.indices);
+    }
+    trozos [carga.clave] = std::move (trozo);
+    cargas.erase (carga.clave);
+    carga.capa = nullptr;
+}
+
+
+void CapaBaldosas::descartaTrozos (int fila_menor, int fila_mayor, int coln_menor, int coln_mayor) {
+    auto alejado = [this, fila_menor, fila_mayor, coln_menor, coln_mayor] (const auto & elemento) {
+        int fila = elemento.first / m_mapa->colns_trozos;
+        int coln = elemento.first % m_mapa->colns_trozos;
+        return fila < fila_menor || fila > fila_mayor || coln < coln_menor || coln > coln_mayor;
+    };
+    std::erase_if (trozos, alejado);
+    std::erase_if (cargas, [& alejado] (const auto & elemento) {
+        if (! alejado (elemento)) {
+            return false;
+        }
+        elemento.second->capa = nullptr;
+        return true;
+    });
+}
+
+
+void CapaBaldosas::construye (int fila_trozo, int coln_trozo, Trozo & trozo) {
+    int   lado  = m_mapa->lado_trozo;
+    float ancho = m_mapa->tamano_baldosa.x ();
+    float alto  = m_mapa->tamano_baldosa.y ();
+    //
+    trozo.vertices.setPrimitiveType (sf::Quads);
+    trozo.vertices.clear ();
+    trozo.animadas.clear ();
+    if (trozo.indices.empty ()) {
+        trozo.construido = true;
+        return;
+    }
+    //
+    // solo se generan vértices para las baldosas no vacías dentro del mapa
+    for (int i = 0; i < lado; ++ i) {
+        int fila = fila_trozo * lado + i;
+        if (fila >= m_mapa->m_filas) {
+            break;
+        }
+        for (int j = 0; j < lado; ++ j) {
+            int coln = coln_trozo * lado + j;
+            if (coln >= m_mapa->m_colns) {
+                break;
+            }
+            uint32_t estampa = trozo.indices [i * lado + j];
+            if (estampa == MapaBaldosas::sin_estampa) {
+                continue;
+            }
+            //
+            int vertice = (int) trozo.vertices.getVertexCount ();
+            float izqrd = coln * ancho;
+            float derch = (coln + 1) * ancho;
+            float arrba = fila * alto;
+            float abajo = (fila + 1) * alto;
+            trozo.vertices.append (sf::Vertex {sf::Vector2f (izqrd, arrba)});
+            trozo.vertices.append (sf::Vertex {sf::Vector2f (derch, arrba)});
+            trozo.vertices.append (sf::Vertex {sf::Vector2f (derch, abajo)});
+            trozo.vertices.append (sf::Vertex {sf::Vector2f (izqrd, abajo)});
+            //
+            auto buscado = estampas_animadas.find (estampa);
+            if (buscado != estampas_animadas.end ()) {
+                const Animacion & animacion = animaciones [buscado->second];
+                trozo.animadas.emplace_back (vertice, buscado->second);
+                estampa = animacion.secuencia.estampas [animacion.actual];
+            }
+            colocaEstampa (& trozo.vertices [vertice], estampa);
+        }
+    }
+    trozo.construido = true;
+}
+
+
+void CapaBaldosas::colocaEstampa (sf::Vertex * quad, uint32_t estampa) const {
+    int ancho_estmp = textura->rectg_textura.x / this->colns_estampas;
+    int alto__estmp = textura->rectg_textura.y / this->filas_estampas; 
+    int coln__estmp = estampa % colns_estampas;
+    int fila__estmp = estampa / colns_estampas;
+    //
+    float izqrd = (float) ( coln__estmp      * ancho_estmp);
+    float derch = (float) ((coln__estmp + 1) * ancho_estmp); 
+    float arrba = (float) ( fila__estmp      * alto__estmp);
+    float abajo = (float) ((fila__estmp + 1) * alto__estmp); 
+    quad [0].texCoords = sf::Vector2f (izqrd, arrba);
+    quad [1].texCoords = sf::Vector2f (derch, arrba);
+    quad [2].texCoords = sf::Vector2f (derch, abajo);
+    quad [3].texCoords = sf::Vector2f (izqrd, abajo);
+}
+
+
+void CapaBaldosas::dibuja (const Transforma & contenedor, Rendidor * rendidor) {
+    const sf::Transform & transforma = situa (contenedor);
+    //
+    // la parte visible de la vista se lleva a coordenadas de la capa 
+    const sf::View & vista = rendidor->vista ();
+    sf::FloatRect visible {vista.getCenter () - vista.getSize () / 2.0f, vista.getSize ()};
+    visible = transforma.getInverse ().transformRect (visible);
+    //
+    float ancho_trozo = m_mapa->lado_trozo * m_mapa->tamano_baldosa.x ();
+    float alto__trozo = m_mapa->lado_trozo * m_mapa->tamano_baldosa.y ();
+    int coln_menor = (int) std::floor (visible.left / ancho_trozo);
+    int coln_mayor = (int) std::floor ((visible.left + visible.width) / ancho_trozo);
+    int fila_menor = (int) std::floor (visible.top / alto__trozo);
+    int fila_mayor = (int) std::floor ((visible.top + visible.height) / alto__trozo);
+    //
+    // la lectura y el descarte de los trozos se hacen en MapaBaldosas::actualiza
+    this->con_vista = true;
+    this->vista_fila_menor = fila_menor;
+    this->vista_fila_mayor = fila_mayor;
+    this->vista_coln_menor = coln_menor;
+    this->vista_coln_mayor = coln_mayor;
+    //
+    int filas_trozos = m_mapa->filas_trozos;
+    int colns_trozos = m_mapa->colns_trozos;
+    fila_menor = std::max (fila_menor, 0);
+    fila_mayor = std::min (fila_mayor, filas_trozos - 1);
+    coln_menor = std::max (coln_menor, 0);
+    coln_mayor = std::min (coln_mayor, colns_trozos - 1);
+    //
+    sf::RenderStates states {};
+    states.transform = transforma;
+    states.texture = & textura->entidad ();
+    for (int fila = fila_menor; fila <= fila_mayor; ++ fila) {
+        for (int coln = coln_menor; coln <= coln_mayor; ++ coln) {
+            auto buscado = trozos.find (fila * colns_trozos + coln);
+            if (buscado == trozos.end ()) {
+                continue;
+            }
+            Trozo & trozo = * buscado->second;
+            if (! trozo.construido) {
+                construye (fila, coln, trozo);
+            }
+            if (trozo.vertices.getVertexCount () > 0) {
+                rendidor->dibuja (trozo.vertices, states, "CapaBaldosas");
+            }
+        }
+    }
+}
+
+
+Dibujable::ClaveEstado CapaBaldosas::claveEstado () const {
+    return ClaveEstado {this->textura, nullptr, sf::Quads};
+}
+
+
+bool CapaBaldosas::limitesPantalla (const Transforma & contenedor, sf::FloatRect & limites) {
+    float ancho = m_mapa->m_colns * m_mapa->tamano_baldosa.x ();
+    float alto  = m_mapa->m_filas * m_mapa->tamano_baldosa.y ();
+    limites = situa (contenedor).transformRect (sf::FloatRect {0, 0, ancho, alto});
+    return true;
+}
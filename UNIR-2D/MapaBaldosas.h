@@ -0,0 +1,304 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: MapaBaldosas.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    class MapaBaldosas;
+
+
+    /// @brief Secuencia de estampas que se presenta en las baldosas animadas de una capa.
+    /// @details Todas las baldosas de la capa que usan la estampa animada se presentan con las 
+    /// estampas de la secuencia, que cambian cada 'segundos_estampa' segundos.
+    struct AnimacionBaldosa {
+
+        /// @brief Estampas de la secuencia, con el mismo valor que los índices de las baldosas.
+        std::vector <uint32_t> estampas {};
+
+        /// @brief Segundos que se presenta cada estampa de la secuencia.
+        double segundos_estampa {0.1};
+
+    };
+
+
+    /// @brief Capa de un mapa de baldosas.
+    /// @details Cada capa tiene su propia instancia de Textura, su propia cuadricula de estampas y 
+    /// su propio índice Z. La superficie de la capa se divide en trozos cuadrados, con el tamaño 
+    /// indicado en la instancia de MapaBaldosas. Los trozos se leen cuando se acercan a la parte 
+    /// visible de la pantalla y se descartan cuando se alejan, en MapaBaldosas::actualiza y no al 
+    /// presentar la capa; solo se presentan los trozos visibles que ya se han leído.<p>
+    /// Las instancias de esta clase se crean mediante el método MapaBaldosas::agregaCapa y deben 
+    /// agregarse a un actor para que se presenten en pantalla.
+    class CapaBaldosas : public Dibujable {
+    public:
+
+		/// @brief Destructor.
+        ~CapaBaldosas ();
+
+        /// @brief Mapa al que pertenece la capa.
+        /// @return El mapa de la capa.
+        MapaBaldosas * mapa () const;
+
+        /// @brief Número de orden de la capa en el mapa, a partir de 0.
+        /// @return El número de orden de la capa.
+        int orden () const;
+
+        /// @brief Establece que una estampa se presenta animada en todas las baldosas de la capa.
+        /// @details Las estampas de la secuencia cambian en función del tiempo indicado en el 
+        /// método MapaBaldosas::actualiza. Solo se modifican las baldosas animadas, y solo cuando 
+        /// cambia la estampa de la secuencia.
+        /// @param estampa Estampa que se sustituye por la secuencia.
+        /// @param animacion Secuencia de estampas.
+        void animaEstampa (uint32_t estampa, const AnimacionBaldosa & animacion);
+
+        /// @brief Número de trozos de la capa que están en memoria.
+        /// @return Número de trozos.
+        int cuentaTrozos () const;
+
+    private:
+
+        // Trozo cuadrado de la superficie de la capa.
+        struct Trozo {
+            std::vector <uint32_t> indices {};
+            bool construido {false};
+            sf::VertexArray vertices {};
+            // vértice inicial e índice de la animación de cada baldosa animada
+            std::vector <std::pair <int, int>> animadas {};
+        };
+
+        // Lectura de un trozo en un hilo de tareas. La tarea solo escribe 'indices' y 'existe'; 
+        // 'capa' se anula en el hilo del juego si el trozo se descarta antes de terminar.
+        struct Carga {
+            CapaBaldosas * capa {};
+            int clave {};
+            std::vector <uint32_t> indices {};
+            bool existe {};
+        };
+
+        // Animación de una estampa y estampa actual de la secuencia.
+        struct Animacion {
+            uint32_t estampa {};
+            AnimacionBaldosa secuencia {};
+            size_t actual {};
+            bool cambiada {};
+        };
+
+        MapaBaldosas * m_mapa {};
+        int m_orden {};
+        Textura * textura {};
+        int filas_estampas {};
+        int colns_estampas {};
+
+        std::unordered_map <int, std::unique_ptr <Trozo>> trozos {};
+        std::unordered_map <int, std::shared_ptr <Carga>> cargas {};
+        // trozos visibles en la última presentación
+        bool con_vista {false};
+        int vista_fila_menor {};
+        int vista_fila_mayor {};
+        int vista_coln_menor {};
+        int vista_coln_mayor {};
+        std::vector <Animacion> animaciones {};
+        std::unordered_map <uint32_t, int> estampas_animadas {};
+
+        explicit CapaBaldosas (MapaBaldosas * mapa, int orden, Textura * textura, int filas_estampas, int colns_estampas);
+
+        // las capas no se pueden copiar ni mover       
+        CapaBaldosas (const CapaBaldosas & )              = delete;
+        CapaBaldosas (CapaBaldosas && )                   = delete;
+        CapaBaldosas & operator = (const CapaBaldosas & ) = delete;
+        CapaBaldosas & operator = (CapaBaldosas && )      = delete;
+
+        void anima (double tiempo_seg);
+        void gestionaTrozos ();
+        void cargaTrozos (int fila_menor, int fila_mayor, int coln_menor, int coln_mayor, bool todos);
+        void cargaTrozo (int clave, int fila, int coln);
+        void instalaTrozo (Carga & carga);
+        void descartaTrozos (int fila_menor, int fila_mayor, int coln_menor, int coln_mayor);
+        void construye (int fila_trozo, int coln_trozo, Trozo & trozo);
+        void colocaEstampa (sf::Vertex * quad, uint32_t estampa) const;
+
+        void dibuja (const Transforma & contenedor, Rendidor * rendidor) override;
+        ClaveEstado claveEstado () const override;
+        bool limitesPantalla (const Transforma & contenedor, sf::FloatRect & limites) override;
+
+        friend class MapaBaldosas;
+
+    };
+
+
+    /// @brief Mapa de baldosas de gran tamaño, con varias capas, dividido en trozos.
+    /// @details El mapa es una cuadricula de baldosas con las filas y las columnas indicadas en el 
+    /// constructor. La cuadricula se divide en trozos cuadrados de 'lado_trozo' baldosas de lado. 
+    /// Las capas del mapa (instancias de CapaBaldosas) comparten la cuadricula.<p>
+    /// Los índices de las baldosas de cada trozo se obtienen, cuando se necesitan, de una función 
+    /// proveedora (véase ponProveedor()) o de archivos binarios en un directorio (véase 
+    /// leeDirectorio()). Los valores de los índices son los descritos en Baldosas::mapea; el valor 
+    /// MapaBaldosas::sin_estampa indica una baldosa vacía.<p>
+    /// El actor que contiene las capas debe llamar al método actualiza() desde su método 
+    /// ActorBase::actualiza para que avancen las animaciones y se lean y descarten los trozos. 
+    /// Los trozos se leen en los hilos del servicio Tareas, de modo que la lectura no detiene la 
+    /// presentación; un trozo se presenta a partir del ciclo siguiente al que termina su lectura.
+    class MapaBaldosas {
+    public:
+
+        /// @brief Función que obtiene los índices de un trozo de una capa.
+        /// @details Los parámetros son el número de orden de la capa, la fila y la columna del 
+        /// trozo en la cuadricula de trozos, y el vector que recibe 'lado_trozo' x 'lado_trozo' 
+        /// índices organizados en filas. Devuelve falso si el trozo no existe.<p>
+        /// Se llama desde los hilos del servicio Tareas, así que no debe acceder a datos que el 
+        /// juego modifica a la vez.
+        using Proveedor = std::function <bool (int capa, int fila_trozo, int coln_trozo, std::vector <uint32_t> & indices)>;
+
+        /// @brief Índice de una baldosa vacía.
+        static constexpr uint32_t sin_estampa = 0xFFFFFFFF;
+
+        /// @brief Constructor.
+        /// @param filas Filas de baldosas del mapa.
+        /// @param columnas Columnas de baldosas del mapa.
+        /// @param tamano_baldosa Anchura y altura de cada baldosa en píxeles.
+        /// @param lado_trozo Número de baldosas del lado de cada trozo.
+        explicit MapaBaldosas (int filas, int columnas, Vector tamano_baldosa, int lado_trozo = 32);
+
+		/// @brief Destructor.
+        ~MapaBaldosas ();
+
+        /// @brief Filas de baldosas del mapa.
+        int filas () const;
+
+        /// @brief Columnas de baldosas del mapa.
+        int columnas () const;
+
+        /// @brief Número de baldosas del lado de cada trozo.
+        int ladoTrozo () const;
+
+        /// @brief Anchura y altura de cada baldosa en píxeles.
+        Vector tamanoBaldosa () const;
+
+        /// @brief Agrega una capa al mapa.
+        /// @details La capa pertenece al mapa y se elimina con él. Debe agregarse a un actor 
+        /// (véase ActorBase::agregaDibujo) para que se presente en pantalla, y extraerse del actor 
+        /// antes de eliminar el mapa.
+        /// @param textura Textura de la que se toman las estampas.
+        /// @param filas_estampas Filas de la cuadricula de estampas.
+        /// @param colns_estampas Columnas de la cuadricula de estampas.
+        /// @param indice_z Índice Z de la capa.
+        /// @return La capa creada.
+        CapaBaldosas * agregaCapa (Textura * textura, int filas_estampas, int colns_estampas, int indice_z);
+
+        /// @brief Capas del mapa, en el orden en que se agregaron.
+        const std::vector <std::unique_ptr <CapaBaldosas>> & capas () const;
+
+        /// @brief Establece la función que obtiene los índices de los trozos.
+        /// @param proveedor La función proveedora.
+        void ponProveedor (Proveedor proveedor);
+
+        /// @brief Establece que los índices de los trozos se leen de archivos binarios.
+        /// @details Cada trozo se lee del archivo 'capa<c>_<f>_<k>.trozo' del directorio indicado, 
+        /// donde 'c' es el orden de la capa y 'f' y 'k' son la fila y la columna del trozo. Los 
+        /// archivos se escriben con el método escribeTrozo(). Si no existe el archivo, el trozo 
+        /// está vacío.
+        /// @param directorio Directorio de los archivos.
+        void leeDirectorio (path directorio);
+
+        /// @brief Escribe los índices de un trozo en un archivo binario.
+        /// @param archivo Camino al archivo.
+        /// @param lado_trozo Número de baldosas del lado del trozo.
+        /// @param indices Índices del trozo, 'lado_trozo' x 'lado_trozo' valores organizados en 
+        /// filas.
+        static void escribeTrozo (path archivo, int lado_trozo, const std::vector <uint32_t> & indices);
+
+        /// @brief Establece cuantos trozos alrededor de la parte visible se mantienen en memoria.
+        /// @details Los trozos cercanos se leen por adelantado, como máximo 'cargas_por_ciclo' en 
+        /// cada ciclo de ejecución. La lectura de los trozos visibles se pide siempre.
+        /// @param margen Trozos alrededor de la parte visible.
+        /// @param cargas_por_ciclo Trozos no visibles leídos en cada ciclo.
+        void ponMargen (int margen, int cargas_por_ciclo = 2);
+
+        /// @brief Avanza las animaciones de las capas del mapa y lee y descarta sus trozos.
+        /// @details Los trozos que se leen o descartan son los que rodean la parte de cada capa 
+        /// presentada en el ciclo anterior.
+        /// @param tiempo_seg Tiempo en segundos desde el inicio de la ejecución del juego.
+        void actualiza (double tiempo_seg);
+
+    private:
+
+        int m_filas {};
+        int m_colns {};
+        int lado_trozo {};
+        int filas_trozos {};
+        int colns_trozos {};
+        Vector tamano_baldosa {};
+
+        std::vector <std::unique_ptr <CapaBaldosas>> m_capas {};
+        Proveedor proveedor {};
+        int margen {1};
+        int cargas_por_ciclo {2};
+
+        inline static int cuenta_instancias {};
+
+        // los mapas no se pueden copiar ni mover       
+        MapaBaldosas (const MapaBaldosas & )              = delete;
+        MapaBaldosas (MapaBaldosas && )                   = delete;
+        MapaBaldosas & operator = (const MapaBaldosas & ) = delete;
+        MapaBaldosas & operator = (MapaBaldosas && )      = delete;
+
+        friend class CapaBaldosas;
+
+    };
+
+
+    inline MapaBaldosas * CapaBaldosas::mapa () const {
+        return m_mapa;
+    }
+
+    inline int CapaBaldosas::orden () const {
+        return m_orden;
+    }
+
+    inline int CapaBaldosas::cuentaTrozos () const {
+        return (int) trozos.size ();
+    }
+
+    inline int MapaBaldosas::filas () const {
+        return m_filas;
+    }
+
+    inline int MapaBaldosas::columnas () const {
+        return m_colns;
+    }
+
+    inline int MapaBaldosas::ladoTrozo () const {
+        return lado_trozo;
+    }
+
+    inline Vector MapaBaldosas::tamanoBaldosa () const {
+        return tamano_baldosa;
+    }
+
+    inline const std::vector <std::unique_ptr <CapaBaldosas>> & MapaBaldosas::capas () const {
+        return m_capas;
+    }
+
+    inline void MapaBaldosas::ponProveedor (Proveedor proveedor) {
+        this->proveedor = proveedor;
+    }
+
+
+}
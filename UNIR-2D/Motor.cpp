@@ -33,6 +33,7 @@ void Motor::ejecuta (JuegoBase * juego) {
     //
     // Una instancia de 'Rendidor' se usa para presentar el juego en pantalla.
     this->rendidor = new Rendidor {};
+    this->rendidor->grabacion = grabacion;
     //
     // 'inicia' muestra la ventana del juego. También realiza la llamada al método 'inicia' del 
     // juego. 
@@ -42,6 +43,10 @@ void Motor::ejecuta (JuegoBase * juego) {
     this->ciclos = 0;
     // 'tiempo' mide el tiempo desde el inicio de la ejecución.
     this->tiempo.inicia ();
+    // Los tiempos de la entrada grabada se miden desde el mismo inicio.
+    if (grabacion != nullptr) {
+        grabacion->ponOrigen (this->tiempo);
+    }
     //
     // El bucle de juego.
     while (true) {
@@ -49,21 +54,32 @@ void Motor::ejecuta (JuegoBase * juego) {
         // Los ciclos comienzan por 1.
         this->ciclos++;
         //
+        // Los sucesos de teclado y ratón recibidos desde el ciclo anterior se procesan ahora y la 
+        // situación resultante se consulta a continuación por los métodos 'actualiza' del juego y 
+        // de los actores del juego.
+        Teclado::iniciaCiclo ();
+        Raton  ::iniciaCiclo ();
+        //
         // El rendidor ha detectado el cierre de la ventana del juego. Se termina el juego.  
-        if (rendidor->cerrado ()) {
+        if (rendidor->cerrado (this->ciclos)) {
             juego->ponEjecucion (EjecucionJuego::cancelado);
             break;
         }
         //
-        // Comprueba la situación del teclado y del ratón en este momento y la almacena para ser 
-        // consultada a continuación por los métodos 'actualiza' del juego y de los actores del 
-        // juego. Hacerlo así evita problemas de tiempo con el doble-clic.
-        Teclado::sondea ();
-        Raton  ::sondea ();
-        //
         // Inicia la medición parcial del tiempo de cada iteración del bucle.
         this->tiempo.arrancaCrono ();
         //
+        // Crea o retira el panel de rendimiento y la captura y aplica la escala, si se han cambiado.
+        this->preparaPanel ();
+        this->preparaCaptura ();
+        this->preparaEscala ();
+        //
+        // Entrega al juego los avisos de la música, si hay alguno.
+        Musica::entregaSucesos ();
+        //
+        // Ejecuta los avisos de las tareas terminadas desde el ciclo anterior, si hay alguno.
+        Tareas::entregaAvisos ();
+        //
         // Indica en la consola que el motor está funcionando.
         std::cout << '.';
         //
@@ -78,6 +94,14 @@ void Motor::ejecuta (JuegoBase * juego) {
         // juego y para presentalo en pantalla.
         this->tiempo.paraCrono ();
         //
+        // Se libera la memoria temporal reservada durante el ciclo.
+        ArenaCiclo::reinicia ();
+        //
+        // Se cierra la cuenta de las reservas de memoria del ciclo y, si se ha pedido, se 
+        // comprueba que los ciclos en reposo no reservan memoria.
+        RastreoMemoria::terminaCiclo (this->ciclos);
+        this->compruebaReservas ();
+        //
         // Se comprueba si en 'actualiza' se ha cambiado el estado de ejecución.
         if (juego->ejecucion () == EjecucionJuego::cancelado ||
             juego->ejecucion () == EjecucionJuego::reinicio    ) {
@@ -90,7 +114,11 @@ void Motor::ejecuta (JuegoBase * juego) {
         // 
         // 'micrseg_ciclo' es el tiempo asignado a cada iteración de bucle, se resta el tiempo de la 
         // medición parcial y se obtiene el tiempo que hay que estar parado, en 'duracion'. 
+        // Al reproducir una grabación de la entrada lo más rápido posible no hay detención.
         long duracion = micrseg_ciclo - this->tiempo.crono_micrseg ();
+        if (grabacion != nullptr && ! grabacion->tiempoReal ()) {
+            duracion = 0;
+        }
         if (duracion > 0) {
             //
             // Se detiene la ejecución durante el tiempo indicado por 'duracion'. Otros procesos del 
@@ -108,35 +136,193 @@ void Motor::ejecuta (JuegoBase * juego) {
 
 void Motor::inicia () {
     std::cout << "Motor UNIR-2D arrancado.\n";        
+    if (prueba_reservas && ! RastreoMemoria::disponible ()) {
+        throw std::runtime_error {"La prueba sin reservas requiere compilar con UNIR2D_RASTREO_MEMORIA."};
+    }
+    if (con_rastreo || prueba_reservas) {
+        RastreoMemoria::activa ();
+    }
     rendidor->abre (juego);
+    //
+    // La semilla y la posición inicial del ratón se graban con la entrada o se leen de la 
+    // grabación que se reproduce.
+    juego->m_semilla = std::random_device {} ();
+    sf::Vector2i raton = sf::Mouse::getPosition (* rendidor->window);
+    if (grabacion != nullptr) {
+        grabacion->inicia (juego->m_semilla, raton);
+    }
+    //
+    // Los hilos de tareas se arrancan antes de iniciar el juego, que ya puede lanzar tareas.
+    int hilos = hilos_tareas;
+    if (hilos == 0) {
+        hilos = std::clamp (static_cast <int> (std::thread::hardware_concurrency ()) - 1, 1, Tareas::maximoHilos);
+    }
+    Tareas::arranca (hilos);
     juego->inicia ();
     Teclado::configura (rendidor);
-    Raton::configura (rendidor);
+    Raton::configura (rendidor, raton);
 }
 
 
 void Motor::actualiza () {
+    RastreoMemoria::Zona zona {"actualiza"};
+    auto inicio = std::chrono::steady_clock::now ();
     double segundos_tiempo = this->tiempo.segundos ();
+    ZonasRaton::resuelve ();
+    Rutinas::resuelve (segundos_tiempo);
     juego->preactualiza (segundos_tiempo);
     juego->actualizaActores (segundos_tiempo);
     juego->posactualiza (segundos_tiempo);
+    if (grabacion != nullptr) {
+        grabacion->cierraCiclo (this->ciclos, segundos_tiempo);
+    }
+    micrseg_actualiza = (long)std::chrono::duration_cast <std::chrono::microseconds> (
+            std::chrono::steady_clock::now () - inicio).count ();
 }
 
 
 void Motor::presenta () {
+    auto inicio = std::chrono::steady_clock::now ();
     rendidor->limpia ();
-    juego->presentaActores (rendidor);
-    rendidor->muestra ();
+    {
+        RastreoMemoria::Zona zona {"dibuja"};
+        juego->presentaActores (rendidor);
+    }
+    auto dibujado = std::chrono::steady_clock::now ();
+    {
+        RastreoMemoria::Zona zona {"muestra"};
+        rendidor->muestra ();
+    }
+    auto mostrado = std::chrono::steady_clock::now ();
+    Estadisticas::terminaCiclo ();
+    //
+    long micrseg_dibuja = (long)std::chrono::duration_cast <std::chrono::microseconds> (
+            dibujado - inicio).count ();
+    long micrseg_muestra = (long)std::chrono::duration_cast <std::chrono::microseconds> (
+            mostrado - dibujado).count ();
+    if (panel != nullptr) {
+        panel->registra (micrseg_actualiza, micrseg_dibuja, micrseg_muestra);
+    }
+    if (micrseg_objetivo > 0) {
+        ajustaEscala (micrseg_dibuja + micrseg_muestra);
+    }
+}
+
+
+void Motor::preparaEscala () {
+    if (escala != escala_aplicada || suavizado != suavizado_aplicado) {
+        rendidor->ponEscala (escala, suavizado);
+        // la escala puede no aplicarse si no se puede crear la textura de la escena
+        escala = rendidor->escala;
+        escala_aplicada    = escala;
+        suavizado_aplicado = suavizado;
+    }
+}
+
+
+void Motor::ajustaEscala (long micrseg_presenta) {
+    //
+    // media exponencial del tiempo de presentación; la escala cambia a pasos y, tras un cambio,
+    // se esperan unos ciclos para que la media refleje el efecto del cambio.
+    media_presenta = media_presenta * 0.9 + micrseg_presenta * 0.1;
+    if (ciclos_escala > 0) {
+        ciclos_escala --;
+        return;
+    }
+    float nueva = escala;
+    if (media_presenta > micrseg_objetivo) {
+        nueva = std::max (escala - paso_escala, escala_minima);
+    } else if (media_presenta < micrseg_objetivo * 0.6) {
+        nueva = std::min (escala + paso_escala, 1.0f);
+    }
+    if (nueva != escala) {
+        escala = nueva;
+        ciclos_escala = ciclos_espera_escala;
+    }
+}
+
+
+void Motor::preparaPanel () {
+    if (con_panel && panel == nullptr) {
+        panel = new PanelRendimiento {juego};
+    } else if (! con_panel && panel != nullptr) {
+        delete panel;
+        panel = nullptr;
+    }
+    rendidor->panel = panel;
+}
+
+
+void Motor::preparaCaptura () {
+    if (con_captura && captura == nullptr) {
+        captura = new CapturaFotogramas {directorio_captura, formato_captura, ciclos_captura};
+    } else if (! con_captura && captura != nullptr) {
+        delete captura;
+        captura = nullptr;
+    }
+    rendidor->captura = captura;
+}
+
+
+void Motor::compruebaReservas () {
+    if (! prueba_reservas) {
+        return;
+    }
+    // un ciclo está en reposo si ni él ni los 'ciclos_reposo' anteriores tienen sucesos
+    if (rendidor->sucesos > 0) {
+        ciclos_inactivos = 0;
+        return;
+    }
+    ciclos_inactivos ++;
+    if (this->ciclos <= ciclos_preparacion || ciclos_inactivos <= ciclos_reposo) {
+        return;
+    }
+    if (RastreoMemoria::reservasCiclo () > 0) {
+        RastreoMemoria::desactiva ();
+        RastreoMemoria::escribe (std::cout);
+        throw std::runtime_error {
+                "El ciclo en reposo " + std::to_string (this->ciclos) + " ha hecho " + 
+                std::to_string (RastreoMemoria::reservasCiclo ()) + " reservas de memoria."};
+    }
 }
 
 
 void Motor::termina () {
+    RastreoMemoria::desactiva ();
+    int hilos = Tareas::hilos ();
+    Tareas::para ();
+    Rutinas::vacia ();
+    // el panel comparte las fuentes con los textos del juego: se retira antes de que el juego 
+    // compruebe que no quedan fuentes cargadas
+    rendidor->panel = nullptr;
+    delete panel;
+    panel = nullptr;
     juego->termina ();
+    ZonasRaton::vacia ();
+    rendidor->captura = nullptr;
+    delete captura;
+    captura = nullptr;
+    rendidor->grabacion = nullptr;
+    delete grabacion;
+    grabacion = nullptr;
+    Audio::cierra ();
+    Musica::cierra ();
+    ArenaCiclo::libera ();
     rendidor->cierra ();
     std::cout << "\n";        
     std::cout << "Motor UNIR-2D parado.\n";        
     std::cout << "  tiempo " << this->tiempo.segundos () <<"s\n";
     std::cout << "  " << this->ciclos << " ciclos\n";
     std::cout << "  ciclo medio " << this->tiempo.mediaCrono_micrseg () << " microseg.\n";  //  μ  \u03BC
+    std::cout << "  memoria de ciclo " << ArenaCiclo::maximoOcupados () << " bytes, " << 
+            ArenaCiclo::desbordes () << " desbordes\n";
+    std::cout << "  reserva de dibujos " << ReservaDibujos::bytesReservados () << " bytes en " << 
+            ReservaDibujos::losas () << " losas\n";
+    std::cout << "  tareas " << Tareas::ejecutadas () << " en " << hilos << " hilos, " << 
+            Tareas::robadas () << " robadas\n";
+    if (con_rastreo || prueba_reservas) {
+        RastreoMemoria::escribe (std::cout);
+    }
+    Estadisticas::escribe (std::cout);
 }
 
@@ -34,6 +34,95 @@ namespace unir2d {
         /// @param juego: instancia del juego que se ejecuta.
         void ejecuta (JuegoBase * juego);
 
+        /// @brief Indica si se presenta el panel de rendimiento.
+        /// @return Verdadero si se presenta el panel.
+        bool panelRendimiento () const;
+        /// @brief Establece si se presenta el panel de rendimiento.
+        /// @details El panel aparece sobre todo lo demás, en la esquina superior izquierda de la 
+        /// ventana. Muestra la gráfica de la duración de los últimos ciclos, dividida en la 
+        /// actualización, el dibujo y la presentación, los fotogramas por segundo, los dibujos del 
+        /// último ciclo, las instancias de Dibujable, Textura y Sonido y el nombre del estado del 
+        /// juego (véase JuegoBase::nombreEstado). Se puede cambiar durante la ejecución del juego.
+        /// @param valor: verdadero para presentar el panel.
+        void ponPanelRendimiento (bool valor);
+
+        /// @brief Inicia la captura de la ejecución del juego en una secuencia de archivos de imagen.
+        /// @details Los archivos se escriben en el directorio indicado, con los nombres 
+        /// 'ciclo_000000', 'ciclo_000001', etc. La ventana se copia en la tarjeta gráfica y se lee 
+        /// dos ciclos después; un hilo independiente escribe los archivos, de modo que la duración 
+        /// del ciclo apenas cambia. Si la escritura no da abasto, se descartan capturas y su número 
+        /// se indica en la consola. Se puede llamar durante la ejecución del juego.
+        /// @param directorio: directorio de los archivos; se crea si no existe.
+        /// @param formato: formato de los archivos.
+        /// @param ciclos_captura: se captura uno de cada 'ciclos_captura' ciclos.
+        void iniciaCaptura (const std::filesystem::path & directorio, 
+                            FormatoCaptura formato = FormatoCaptura::qoi, int ciclos_captura = 1);
+        /// @brief Termina la captura de la ejecución del juego.
+        /// @details Las capturas pendientes se escriben antes de terminar.
+        void terminaCaptura ();
+
+        /// @brief Obtiene la escala a la que se dibuja la escena.
+        /// @return Fracción del tamaño de la ventana, entre 0 y 1.
+        float escalaPresentacion () const;
+        /// @brief Establece la escala a la que se dibuja la escena.
+        /// @details Con una escala menor que 1, la escena se dibuja en una textura interna de 
+        /// 'escala' veces el tamaño de la ventana y después se amplía a la ventana. Se pierde 
+        /// nitidez a cambio de rellenar menos píxeles, lo que es útil con tarjetas gráficas lentas 
+        /// o sin aceleración. Las coordenadas de la escena y la posición del ratón (véase 
+        /// Raton::posicion) no cambian. Se puede cambiar durante la ejecución del juego.
+        /// @param escala: fracción del tamaño de la ventana, mayor que 0 y como mucho 1.
+        /// @param suavizado: verdadero para ampliar con filtrado bilineal; falso para ampliar 
+        /// repitiendo píxeles.
+        void ponEscalaPresentacion (float escala, bool suavizado = false);
+        /// @brief Establece que la escala de la escena se ajuste a la duración de la presentación.
+        /// @details Si la media de la duración del dibujo y la presentación de los ciclos supera 
+        /// 'micrseg_objetivo', la escala se reduce a pasos hasta 'escala_minima'; si queda muy por 
+        /// debajo, se aumenta hasta 1. Con 'micrseg_objetivo' igual a 0 el ajuste se desactiva y la 
+        /// escala se mantiene.
+        /// @param micrseg_objetivo: duración objetivo en microsegundos.
+        /// @param escala_minima: escala mínima, mayor que 0 y como mucho 1.
+        void ponEscalaDinamica (long micrseg_objetivo, float escala_minima = 0.5f);
+
+        /// @brief Graba la entrada del jugador durante la próxima ejecución del juego.
+        /// @details En cada ciclo se graban las pulsaciones y liberaciones de teclas y botones del 
+        /// ratón, los movimientos del ratón y los cambios de foco de la ventana, junto con el 
+        /// tiempo del ciclo. También se graba la semilla de los números aleatorios del juego 
+        /// (véase JuegoBase::semilla). Se debe llamar antes de Motor::ejecuta.
+        /// @param archivo: archivo de la grabación; se reemplaza si existe.
+        void grabaEntrada (const std::filesystem::path & archivo);
+        /// @brief Reproduce una grabación de la entrada del jugador en la próxima ejecución.
+        /// @details La entrada grabada sustituye a la entrada real, los ciclos tienen los tiempos 
+        /// grabados y el juego recibe la semilla grabada, de modo que un juego que use 
+        /// JuegoBase::semilla para sus números aleatorios y Tiempo para medir el tiempo repite la 
+        /// ejecución grabada. Al terminar la grabación se termina el juego. Se debe llamar antes 
+        /// de Motor::ejecuta.
+        /// @param archivo: archivo de la grabación.
+        /// @param tiempo_real: verdadero para reproducir con la duración normal de los ciclos; 
+        /// falso para reproducir lo más rápido posible.
+        void reproduceEntrada (const std::filesystem::path & archivo, bool tiempo_real = true);
+
+        /// @brief Establece si se rastrean las reservas de memoria dinámica.
+        /// @details Requiere compilar el motor con el símbolo 'UNIR2D_RASTREO_MEMORIA' (véase 
+        /// RastreoMemoria); sin él no tiene efecto. Las reservas del último ciclo aparecen en el 
+        /// panel de rendimiento y, al terminar, se escribe un resumen en la consola. Se debe 
+        /// llamar antes de Motor::ejecuta.
+        /// @param valor: verdadero para rastrear las reservas.
+        void ponRastreoMemoria (bool valor);
+        /// @brief Establece la prueba de ciclos sin reservas de memoria dinámica.
+        /// @details Activa el rastreo de memoria y, pasados los ciclos de preparación indicados, 
+        /// comprueba que los ciclos en reposo, sin sucesos de teclado ni ratón en ese ciclo ni en 
+        /// los anteriores, no reservan memoria dinámica. Si alguno lo hace, se escribe el resumen 
+        /// del rastreo en la consola y se lanza una excepción std::runtime_error. Requiere compilar 
+        /// el motor con el símbolo 'UNIR2D_RASTREO_MEMORIA'; sin él, Motor::ejecuta lanza la 
+        /// excepción al comenzar. Se debe llamar antes de Motor::ejecuta.
+        /// @param ciclos_preparacion: ciclos iniciales que no se comprueban.
+        void ponPruebaSinReservas (int ciclos_preparacion = 60);
+        /// @brief Establece el número de hilos del servicio de tareas (véase Tareas).
+        /// @details Con el valor 0, el número de hilos es el de procesadores lógicos menos uno, 
+        /// y al menos uno. Se debe llamar antes de Motor::ejecuta.
+        /// @param hilos: número de hilos, entre 0 y Tareas::maximoHilos.
+        void ponHilosTareas (int hilos);
+
     private:
 
         // Juego que se está ejecutando.
@@ -50,6 +139,39 @@ namespace unir2d {
         // Instancia de Tiempo que controla el tiempo durante la ejecución del juego.
         Tiempo tiempo {};
 
+        // Panel de rendimiento, se crea al solicitarlo.
+        bool con_panel {};
+        PanelRendimiento * panel {};
+        // Captura de la ejecución, se crea al solicitarla.
+        bool                  con_captura {};
+        std::filesystem::path directorio_captura {};
+        FormatoCaptura        formato_captura {};
+        int                   ciclos_captura {};
+        CapturaFotogramas *   captura {};
+        // Escala de la escena y su ajuste a la duración de la presentación.
+        static constexpr float paso_escala = 0.05f;
+        static constexpr int   ciclos_espera_escala = 30;
+        float  escala {1.0f};
+        bool   suavizado {};
+        float  escala_aplicada {1.0f};
+        bool   suavizado_aplicado {};
+        long   micrseg_objetivo {};
+        float  escala_minima {0.5f};
+        double media_presenta {};
+        int    ciclos_escala {};
+        // Grabación o reproducción de la entrada.
+        GrabacionEntrada * grabacion {};
+        // Duración de la actualización en el ciclo en curso. 
+        long micrseg_actualiza {};
+        // Rastreo de la memoria y prueba de los ciclos en reposo.
+        static constexpr int ciclos_reposo = 3;
+        bool con_rastreo {};
+        bool prueba_reservas {};
+        int  ciclos_preparacion {};
+        int  ciclos_inactivos {};
+        // Hilos del servicio de tareas; 0 para calcularlos según los procesadores.
+        int hilos_tareas {};
+
         // No se pueden copiar ni mover las instancias de esta clase. 
         Motor (const Motor & )              = delete;
         Motor (Motor && )                   = delete;
@@ -61,10 +183,81 @@ namespace unir2d {
         void actualiza ();
         void presenta ();
         void termina();
+        void preparaPanel ();
+        void preparaCaptura ();
+        void preparaEscala ();
+        void ajustaEscala (long micrseg_presenta);
+        void compruebaReservas ();
 
     };
 
 
+    inline bool Motor::panelRendimiento () const {
+        return con_panel;
+    }
+
+    inline void Motor::ponPanelRendimiento (bool valor) {
+        con_panel = valor;
+    }
+
+    inline void Motor::iniciaCaptura (
+            const std::filesystem::path & directorio, FormatoCaptura formato, int ciclos_captura) {
+        assert (ciclos_captura >= 1);
+        con_captura        = true;
+        directorio_captura = directorio;
+        formato_captura    = formato;
+        this->ciclos_captura = ciclos_captura;
+    }
+
+    inline void Motor::terminaCaptura () {
+        con_captura = false;
+    }
+
+    inline float Motor::escalaPresentacion () const {
+        return escala;
+    }
+
+    inline void Motor::ponEscalaPresentacion (float escala, bool suavizado) {
+        assert (escala > 0.0f && escala <= 1.0f);
+        this->escala    = escala;
+        this->suavizado = suavizado;
+    }
+
+    inline void Motor::ponEscalaDinamica (long micrseg_objetivo, float escala_minima) {
+        assert (micrseg_objetivo >= 0);
+        assert (escala_minima > 0.0f && escala_minima <= 1.0f);
+        this->micrseg_objetivo = micrseg_objetivo;
+        this->escala_minima    = escala_minima;
+        media_presenta = 0.0;
+        ciclos_escala  = 0;
+    }
+
+    inline void Motor::grabaEntrada (const std::filesystem::path & archivo) {
+        assert (grabacion == nullptr);
+        grabacion = new GrabacionEntrada {archivo, true, false};
+    }
+
+    inline void Motor::reproduceEntrada (const std::filesystem::path & archivo, bool tiempo_real) {
+        assert (grabacion == nullptr);
+        grabacion = new GrabacionEntrada {archivo, false, ! tiempo_real};
+    }
+
+    inline void Motor::ponRastreoMemoria (bool valor) {
+        con_rastreo = valor;
+    }
+
+    inline void Motor::ponPruebaSinReservas (int ciclos_preparacion) {
+        assert (ciclos_preparacion >= 0);
+        prueba_reservas = true;
+        this->ciclos_preparacion = ciclos_preparacion;
+    }
+
+    inline void Motor::ponHilosTareas (int hilos) {
+        assert (hilos >= 0 && hilos <= Tareas::maximoHilos);
+        hilos_tareas = hilos;
+    }
+
+
 }
 
 
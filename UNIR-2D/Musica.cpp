@@ -0,0 +1,339 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: Musica.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+#include "UNIR-2D.h"
+
+using namespace unir2d;
+
+
+/// @cond
+
+
+Musica::Rampa Musica::atenuacion {};
+
+
+// periodo de las actualizaciones de volumen del hilo de la música
+static constexpr std::chrono::milliseconds periodo_musica {20};
+
+
+Musica::Guarda::~Guarda () {
+    if (hilo.joinable ()) {
+        {
+            std::lock_guard <std::mutex> bloqueo {cerrojo};
+            terminar = true;
+        }
+        aviso.notify_one ();
+        hilo.join ();
+    }
+}
+
+
+Musica::Plato::~Plato () {
+    RegistroRecursos::retira (this);
+}
+
+
+float Musica::Rampa::actual (Reloj::time_point ahora) const {
+    if (segundos <= 0.0) {
+        return final;
+    }
+    double transcurrido = std::chrono::duration <double> (ahora - momento).count ();
+    if (transcurrido >= segundos) {
+        return final;
+    }
+    return inicio + (final - inicio) * (float) (transcurrido / segundos);
+}
+
+
+void Musica::Rampa::cambia (float objetivo, double segundos, Reloj::time_point ahora) {
+    inicio   = actual (ahora);
+    final    = objetivo;
+    momento  = ahora;
+    this->segundos = segundos;
+}
+
+
+void Musica::reproduce (const path & pista, double segundos_fundido) {
+    reproduce (std::vector <path> {pista}, true, segundos_fundido);
+}
+
+
+void Musica::reproduce (const std::vector <path> & pistas, bool en_bucle, double segundos_fundido) {
+    assert (! pistas.empty ());
+    encarga (Encargo {Orden::reproduce, pistas, en_bucle, segundos_fundido});
+}
+
+
+void Musica::siguiente (double segundos_fundido) {
+    encarga (Encargo {Orden::siguiente, {}, false, segundos_fundido});
+}
+
+
+void Musica::para (double segundos_fundido) {
+    encarga (Encargo {Orden::para, {}, false, segundos_fundido});
+}
+
+
+int Musica::volumen () {
+    return volumen_general;
+}
+
+
+void Musica::ponVolumen (int valor) {
+    assert (valor >= 0 && valor <= 100);
+    volumen_general = valor;
+    encarga (Encargo {Orden::volumen, {}, false, 0.0, valor / 100.0f});
+}
+
+
+void Musica::atenua (int porcentaje, double segundos_rampa) {
+    assert (porcentaje >= 0 && porcentaje <= 100);
+    encarga (Encargo {Orden::atenua, {}, false, segundos_rampa, porcentaje / 100.0f});
+}
+
+
+void Musica::restaura (double segundos_rampa) {
+    encarga (Encargo {Orden::atenua, {}, false, segundos_rampa, 1.0f});
+}
+
+
+void Musica::ponAvisos (std::function <void (AvisoMusica, int)> avisos) {
+    funcion_avisos = std::move (avisos);
+}
+
+
+void Musica::encarga (Encargo && encargo) {
+    {
+        std::lock_guard <std::mutex> bloqueo {cerrojo};
+        encargos.push_back (std::move (encargo));
+        if (! hilo.joinable ()) {
+            terminar = false;
+            hilo = std::thread {& Musica::ejecuta};
+        }
+    }
+    aviso.notify_one ();
+}
+
+
+void Musica::ejecuta () {
+    while (true) {
+        std::deque <Encargo> pendientes {};
+        bool terminando {};
+        {
+            std::unique_lock <std::mutex> bloqueo {cerrojo};
+            // sin música que atender, el hilo espera al siguiente encargo
+            bool activo = plato_actual != nullptr || plato_saliente != nullptr;
+            if (activo) {
+                aviso.wait_for (bloqueo, periodo_musica, [] () { return terminar || ! encargos.empty (); });
+            } else {
+                aviso.wait (bloqueo, [] () { return terminar || ! encargos.empty (); });
+            }
+            terminando = terminar;
+            pendientes.swap (encargos);
+        }
+        // al terminar se atienden los encargos pendientes, como la parada de la música, salvo 
+        // los que abrirían otra pista
+        Reloj::time_point ahora = Reloj::now ();
+        for (const Encargo & encargo : pendientes) {
+            if (terminando && (encargo.orden == Orden::reproduce || encargo.orden == Orden::siguiente)) {
+                continue;
+            }
+            atiende (encargo, ahora);
+        }
+        if (terminando) {
+            break;
+        }
+        avanza (ahora);
+    }
+    plato_actual.reset ();
+    plato_saliente.reset ();
+}
+
+
+void Musica::atiende (const Encargo & encargo, Reloj::time_point ahora) {
+    switch (encargo.orden) {
+    case Orden::reproduce:
+        lista          = encargo.pistas;
+        lista_en_bucle = encargo.en_bucle;
+        fundido_lista  = encargo.segundos;
+        abre (0, encargo.segundos, ahora);
+        break;
+    case Orden::siguiente:
+        if (plato_actual != nullptr && ! lista.empty ()) {
+            abre ((plato_actual->pista + 1) % (int) lista.size (), encargo.segundos, ahora);
+        }
+        break;
+    case Orden::para:
+        if (plato_actual != nullptr) {
+            plato_saliente = std::move (plato_actual);
+            funde (* plato_saliente, 0.0f, encargo.segundos, ahora);
+        }
+        lista.clear ();
+        break;
+    case Orden::volumen:
+        general = encargo.valor;
+        break;
+    case Orden::atenua:
+        atenuacion.cambia (encargo.valor, encargo.segundos, ahora);
+        break;
+    }
+}
+
+
+void Musica::abre (int pista, double segundos_fundido, Reloj::time_point ahora) {
+    // el plato actual pasa a ser el saliente; un saliente anterior se corta
+    if (plato_actual != nullptr) {
+        plato_saliente = std::move (plato_actual);
+        funde (* plato_saliente, 0.0f, segundos_fundido, ahora);
+    }
+    for (int intento = 0; intento < (int) lista.size (); ++ intento) {
+        int indice = (pista + intento) % (int) lista.size ();
+        std::unique_ptr <Plato> plato = std::make_unique <Plato> ();
+        if (! plato->musica.openFromFile (lista [indice].string ())) {
+            avisa (AvisoMusica::errorPista, indice);
+            continue;
+        }
+        // una sola pista en bucle se repite sin pausas con el bucle del propio flujo
+        RegistroRecursos::Propietario propietario {"Musica"};
+        RegistroRecursos::registra (plato.get (), 
+                RegistroRecursos::recursoFlujo (plato->musica, lista [indice].string ()));
+        plato->musica.setLoop (lista.size () == 1 && lista_en_bucle);
+        plato->pista   = indice;
+        plato->fundido = segundos_fundido > 0.0 ? 0.0f : 1.0f;
+        funde (* plato, 1.0f, segundos_fundido, ahora);
+        plato->musica.setVolume (100.0f * general * atenuacion.actual (ahora) * plato->fundido);
+        plato->musica.play ();
+        plato_actual = std::move (plato);
+        avisa (AvisoMusica::empiezaPista, indice);
+        return;
+    }
+    lista.clear ();
+    avisa (AvisoMusica::terminaLista, -1);
+}
+
+
+void Musica::funde (Plato & plato, float objetivo, double segundos, Reloj::time_point ahora) {
+    plato.fundido_inicio   = plato.fundido;
+    plato.fundido_final    = objetivo;
+    plato.inicio_fundido   = ahora;
+    plato.segundos_fundido = segundos;
+    if (segundos <= 0.0) {
+        plato.fundido = objetivo;
+    }
+}
+
+
+void Musica::avanza (Reloj::time_point ahora) {
+    float volumen = 100.0f * general * atenuacion.actual (ahora);
+    //
+    // fundidos de los platos
+    for (Plato * plato : {plato_actual.get (), plato_saliente.get ()}) {
+        if (plato == nullptr) {
+            continue;
+        }
+        if (plato->segundos_fundido > 0.0) {
+            double transcurrido = std::chrono::duration <double> (ahora - plato->inicio_fundido).count ();
+            double fraccion = std::min (transcurrido / plato->segundos_fundido, 1.0);
+            plato->fundido = plato->fundido_inicio + 
+                    (plato->fundido_final - plato->fundido_inicio) * (float) fraccion;
+        }
+        plato->musica.setVolume (volumen * plato->fundido);
+    }
+    if (plato_saliente != nullptr) {
+        if (plato_saliente->fundido <= 0.0f || 
+            plato_saliente->musica.getStatus () == sf::SoundSource::Stopped) {
+            plato_saliente.reset ();
+        }
+    }
+    if (plato_actual == nullptr) {
+        return;
+    }
+    //
+    // una pista en bucle vuelve al principio
+    sf::Time posicion = plato_actual->musica.getPlayingOffset ();
+    if (plato_actual->musica.getLoop () && posicion < plato_actual->posicion) {
+        avisa (AvisoMusica::repitePista, plato_actual->pista);
+    }
+    plato_actual->posicion = posicion;
+    //
+    // el paso a la siguiente pista empieza antes del final para fundirlas
+    sf::Time restante = plato_actual->musica.getDuration () - posicion;
+    bool terminando = ! plato_actual->musica.getLoop () && 
+            (plato_actual->musica.getStatus () == sf::SoundSource::Stopped || 
+             restante.asSeconds () <= fundido_lista);
+    if (! terminando) {
+        return;
+    }
+    int siguiente = plato_actual->pista + 1;
+    if (siguiente < (int) lista.size () || lista_en_bucle) {
+        abre (siguiente % (int) lista.size (), fundido_lista, ahora);
+    } else {
+        plato_saliente = std::move (plato_actual);
+        funde (* plato_saliente, 0.0f, restante.asSeconds (), ahora);
+        lista.clear ();
+        avisa (AvisoMusica::terminaLista, -1);
+    }
+}
+
+
+void Musica::avisa (AvisoMusica aviso, int pista) {
+    std::lock_guard <std::mutex> bloqueo {cerrojo};
+    sucesos.emplace_back (aviso, pista);
+    hay_sucesos = true;
+}
+
+
+void Musica::entregaSucesos () {
+    // sin sucesos, el coste en el bucle del juego es la lectura de 'hay_sucesos'
+    if (! hay_sucesos) {
+        return;
+    }
+    std::vector <std::pair <AvisoMusica, int>> entregados {};
+    {
+        std::lock_guard <std::mutex> bloqueo {cerrojo};
+        entregados.swap (sucesos);
+        hay_sucesos = false;
+    }
+    if (funcion_avisos) {
+        for (const std::pair <AvisoMusica, int> & suceso : entregados) {
+            funcion_avisos (suceso.first, suceso.second);
+        }
+    }
+}
+
+
+void Musica::cierra () {
+    // el hilo atiende los encargos pendientes antes de terminar
+    {
+        std::lock_guard <std::mutex> bloqueo {cerrojo};
+        terminar = true;
+    }
+    aviso.notify_one ();
+    if (hilo.joinable ()) {
+        hilo.join ();
+    }
+    encargos.clear ();
+    lista.clear ();
+    atenuacion = Rampa {};
+    sucesos.clear ();
+    hay_sucesos = false;
+    funcion_avisos = nullptr;
+}
+
+
+/// @endcond
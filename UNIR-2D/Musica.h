@@ -0,0 +1,178 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: Musica.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    /// @enum AvisoMusica
+    /// @brief Sucesos de la reproducción de música que se avisan al juego (véase Musica::ponAvisos).
+    enum class AvisoMusica {
+        /// @brief Ha empezado a sonar una pista.
+        empiezaPista,
+        /// @brief Una pista ha vuelto a empezar en bucle.
+        repitePista,
+        /// @brief Ha terminado la lista de pistas y la música se ha detenido.
+        terminaLista,
+        /// @brief Una pista no se ha podido abrir y se ha saltado.
+        errorPista
+    };
+
+
+    /// @brief Servicio de reproducción de música.
+    /// @details La música se reproduce desde un hilo propio, que se encarga de repetir las pistas 
+    /// sin pausas, de pasar de una pista a la siguiente de la lista, de los fundidos entre pistas 
+    /// y de las rampas de volumen. Los métodos de esta clase solo encargan el trabajo al hilo y 
+    /// vuelven inmediatamente, de modo que la música no tiene ningún coste en el bucle del juego.<p>
+    /// El volumen de la música es el producto del volumen general (véase ponVolumen) y de la 
+    /// atenuación (véase atenua y restaura). La atenuación indica el volumen objetivo; no se 
+    /// acumula con las atenuaciones anteriores.<p>
+    /// El hilo no llama al juego. Los sucesos de la reproducción se guardan y la clase Motor los 
+    /// entrega al juego al comienzo de cada ciclo, si hay alguno.
+    class Musica {
+    public:
+
+        /// @brief Reproduce una pista en bucle, sin pausas entre las repeticiones.
+        /// @details No se pueden reproducir archivos de tipo mp3. Si ya suena otra música, se funde 
+        /// con la nueva durante el tiempo indicado.
+        /// @param pista Archivo de la pista.
+        /// @param segundos_fundido Duración del fundido con la música anterior.
+        static void reproduce (const path & pista, double segundos_fundido = 0.0);
+
+        /// @brief Reproduce una lista de pistas.
+        /// @details Cada pista se funde con la siguiente durante el tiempo indicado. Con una sola 
+        /// pista en bucle, la pista se repite sin pausas.
+        /// @param pistas Archivos de las pistas.
+        /// @param en_bucle Si la lista vuelve a empezar al terminar.
+        /// @param segundos_fundido Duración de los fundidos entre pistas.
+        static void reproduce (const std::vector <path> & pistas, bool en_bucle = true, 
+                               double segundos_fundido = 0.0);
+
+        /// @brief Pasa a la siguiente pista de la lista.
+        /// @param segundos_fundido Duración del fundido entre las pistas.
+        static void siguiente (double segundos_fundido = 0.0);
+
+        /// @brief Detiene la música.
+        /// @param segundos_fundido Duración del fundido hasta el silencio.
+        static void para (double segundos_fundido = 0.0);
+
+        /// @brief Obtiene el volumen general de la música entre 0 y 100.
+        /// @return Volumen general.
+        static int volumen ();
+
+        /// @brief Establece el volumen general de la música entre 0 y 100.
+        /// @param valor Volumen general.
+        static void ponVolumen (int valor);
+
+        /// @brief Atenúa la música hasta el porcentaje indicado del volumen general.
+        /// @param porcentaje Porcentaje objetivo, entre 0 y 100.
+        /// @param segundos_rampa Duración del cambio de volumen.
+        static void atenua (int porcentaje, double segundos_rampa = 0.5);
+
+        /// @brief Restaura el volumen general de la música tras una atenuación.
+        /// @param segundos_rampa Duración del cambio de volumen.
+        static void restaura (double segundos_rampa = 0.5);
+
+        /// @brief Establece la función que recibe los avisos de la reproducción.
+        /// @details La función se llama desde el bucle del juego, antes de actualizar los actores, 
+        /// con el aviso y el índice de la pista en la lista.
+        /// @param avisos Función que recibe los avisos.
+        static void ponAvisos (std::function <void (AvisoMusica, int)> avisos);
+
+    private:
+
+        using Reloj = std::chrono::steady_clock;
+
+        enum class Orden { reproduce, siguiente, para, volumen, atenua };
+
+        struct Encargo {
+            Orden               orden {};
+            std::vector <path>  pistas {};
+            bool                en_bucle {};
+            double              segundos {};
+            float               valor {};
+        };
+
+        // Una pista abierta, con su fundido de entrada o de salida.
+        struct Plato {
+            sf::Music musica {};
+            int       pista {-1};
+            float     fundido {};
+            float     fundido_inicio {};
+            float     fundido_final {};
+            Reloj::time_point inicio_fundido {};
+            double    segundos_fundido {};
+            sf::Time  posicion {};
+            ~Plato ();
+        };
+
+        // Un cambio progresivo de volumen.
+        struct Rampa {
+            float  inicio {1.0f};
+            float  final {1.0f};
+            Reloj::time_point momento {};
+            double segundos {};
+            float  actual (Reloj::time_point ahora) const;
+            void   cambia (float objetivo, double segundos, Reloj::time_point ahora);
+        };
+
+        // Estado compartido entre el juego y el hilo de la música.
+        inline static std::mutex              cerrojo {};
+        inline static std::condition_variable aviso {};
+        inline static std::deque <Encargo>    encargos {};
+        inline static std::vector <std::pair <AvisoMusica, int>> sucesos {};
+        inline static std::atomic <bool>      hay_sucesos {};
+        inline static bool                    terminar {};
+        inline static std::thread             hilo {};
+        inline static std::atomic <int>       volumen_general {100};
+        inline static std::function <void (AvisoMusica, int)> funcion_avisos {};
+
+        // Estado del hilo de la música.
+        inline static std::vector <path> lista {};
+        inline static bool   lista_en_bucle {};
+        inline static double fundido_lista {};
+        inline static std::unique_ptr <Plato> plato_actual {};
+        inline static std::unique_ptr <Plato> plato_saliente {};
+        static Rampa         atenuacion;
+        inline static float  general {1.0f};
+
+        // Para el hilo si el programa termina sin llamar a cierra(). Se declara después de los 
+        // datos que usa el hilo, para destruirse antes que ellos.
+        struct Guarda {
+            ~Guarda ();
+        };
+        inline static Guarda guarda {};
+
+        static void encarga (Encargo && encargo);
+        static void ejecuta ();
+        static void atiende (const Encargo & encargo, Reloj::time_point ahora);
+        static void avanza (Reloj::time_point ahora);
+        static void abre (int pista, double segundos_fundido, Reloj::time_point ahora);
+        static void funde (Plato & plato, float objetivo, double segundos, Reloj::time_point ahora);
+        static void avisa (AvisoMusica aviso, int pista);
+
+        static void entregaSucesos ();
+        static void cierra ();
+
+        friend class Motor;
+
+    };
+
+
+}
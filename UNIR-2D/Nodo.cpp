@@ -0,0 +1,189 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: Nodo.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+
+#include "UNIR-2D.h"
+
+using namespace unir2d;
+
+
+/// @cond
+
+Nodo::~Nodo () {
+    if (m_padre != nullptr) {
+        m_padre->extraeHijo (this);
+    }
+    if (m_actor != nullptr) {
+        m_actor->extraeNodo (this);
+    }
+    for (Nodo * hijo : m_hijos) {
+        hijo->m_padre = nullptr;
+        hijo->marca ();
+    }
+    for (Dibujable * dibujo : m_dibujos) {
+        dibujo->m_nodo = nullptr;
+    }
+}
+
+
+void Nodo::agregaHijo (Nodo * hijo) {
+    assert (hijo != nullptr && hijo != this);
+    assert (hijo->m_padre == nullptr && hijo->m_actor == nullptr);
+    hijo->m_padre = this;
+    m_hijos.push_back (hijo);
+    ActorBase * actor = actorRaiz ();
+    if (actor != nullptr) {
+        hijo->registra (actor);
+    }
+    hijo->marca ();
+}
+
+
+void Nodo::extraeHijo (Nodo * hijo) {
+    assert (hijo != nullptr && hijo->m_padre == this);
+    ActorBase * actor = actorRaiz ();
+    if (actor != nullptr) {
+        hijo->retira (actor);
+    }
+    m_hijos.erase (std::find (m_hijos.begin (), m_hijos.end (), hijo));
+    hijo->m_padre = nullptr;
+    hijo->marca ();
+}
+
+
+void Nodo::agregaDibujo (Dibujable * dibujo) {
+    assert (dibujo != nullptr && dibujo->m_nodo == nullptr);
+    dibujo->m_nodo = this;
+    m_dibujos.push_back (dibujo);
+    ActorBase * actor = actorRaiz ();
+    if (actor != nullptr) {
+        actor->agregaDibujo (dibujo);
+    }
+}
+
+
+void Nodo::extraeDibujo (Dibujable * dibujo) {
+    assert (dibujo != nullptr && dibujo->m_nodo == this);
+    ActorBase * actor = actorRaiz ();
+    if (actor != nullptr) {
+        actor->extraeDibujo (dibujo);
+    }
+    m_dibujos.erase (std::find (m_dibujos.begin (), m_dibujos.end (), dibujo));
+    dibujo->m_nodo = nullptr;
+}
+
+
+void Nodo::extraeDibujos () {
+    while (! m_dibujos.empty ()) {
+        extraeDibujo (m_dibujos.back ());
+    }
+}
+
+
+void Nodo::marca () {
+    marcado = true;
+    // los antecesores ya marcados tienen marcados a los suyos
+    for (Nodo * nodo = m_padre; nodo != nullptr && ! nodo->descendiente_marcado; nodo = nodo->m_padre) {
+        nodo->descendiente_marcado = true;
+    }
+}
+
+
+void Nodo::valida () const {
+    const Nodo * raiz = this;
+    while (raiz->m_padre != nullptr) {
+        raiz = raiz->m_padre;
+    }
+    raiz->calcula (false);
+}
+
+
+void Nodo::calcula (bool forzado) const {
+    if (m_padre == nullptr) {
+        uint64_t version = m_actor != nullptr ? m_actor->m_transforma.version () : 0;
+        if (version != version_actor) {
+            version_actor = version;
+            forzado = true;
+        }
+    }
+    if (! forzado && ! marcado && ! descendiente_marcado) {
+        return;
+    }
+    //
+    if (forzado || marcado) {
+        Vector posicion = m_posicion;
+        float  rotacion = m_rotacion;
+        bool   visible  = m_visible;
+        const Transforma * base = nullptr;
+        if (m_padre != nullptr) {
+            base = & m_padre->m_mundo;
+            visible = visible && m_padre->visible_mundo;
+        } else if (m_actor != nullptr) {
+            base = & m_actor->m_transforma;
+        }
+        if (base != nullptr) {
+            posicion = base->aplicaAPosicion (posicion);
+            rotacion = base->aplicaARotacion (rotacion);
+        }
+        // los hijos solo se calculan de nuevo si cambia el resultado
+        forzado = posicion != m_mundo.posicion () || rotacion != m_mundo.rotacion () || 
+                  visible != visible_mundo;
+        m_mundo.ponPosicion (posicion);
+        m_mundo.ponRotacion (rotacion);
+        visible_mundo = visible;
+        marcado = false;
+    }
+    //
+    if (forzado || descendiente_marcado) {
+        for (Nodo * hijo : m_hijos) {
+            hijo->calcula (forzado);
+        }
+    }
+    descendiente_marcado = false;
+}
+
+
+ActorBase * Nodo::actorRaiz () const {
+    const Nodo * raiz = this;
+    while (raiz->m_padre != nullptr) {
+        raiz = raiz->m_padre;
+    }
+    return raiz->m_actor;
+}
+
+
+void Nodo::registra (ActorBase * actor) {
+    for (Dibujable * dibujo : m_dibujos) {
+        actor->agregaDibujo (dibujo);
+    }
+    for (Nodo * hijo : m_hijos) {
+        hijo->registra (actor);
+    }
+}
+
+
+void Nodo::retira (ActorBase * actor) {
+    for (Dibujable * dibujo : m_dibujos) {
+        actor->extraeDibujo (dibujo);
+    }
+    for (Nodo * hijo : m_hijos) {
+        hijo->retira (actor);
+    }
+}
+
+/// @endcond
@@ -0,0 +1,273 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: Nodo.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    class ActorBase;
+
+
+    /// @brief Nodo de una jerarquía de dibujables dentro de un actor.
+    /// @details Un nodo tiene una posición y una rotación relativas a su nodo padre o, si es la 
+    /// raíz de la jerarquía, al actor al que se agrega mediante ActorBase#agregaNodo. Los 
+    /// dibujables agregados a un nodo se situan respecto al nodo, del mismo modo que los 
+    /// dibujables de un actor se situan respecto al actor, y aparecen en la lista de dibujos del 
+    /// actor, ordenados por su índice Z.<p>
+    /// Un nodo oculto oculta a todos sus descendientes y a sus dibujables. Así, mover u ocultar un 
+    /// panel compuesto de muchos elementos es un único cambio en el nodo del panel.<p>
+    /// La situación y la visibilidad resultantes (las 'del mundo') se guardan en cada nodo. Un 
+    /// cambio en un nodo solo lo marca a él y a sus antecesores; el cálculo se hace cuando se 
+    /// consultan o antes de presentar el actor, y recorre solo las ramas marcadas. Si el actor se 
+    /// mueve, se calculan todos sus nodos.<p>
+    /// Los nodos no se pueden copiar ni mover, y no son propietarios de sus hijos ni de sus 
+    /// dibujables.
+    class Nodo {
+    public:
+
+        /// @brief Constructor.
+        explicit Nodo () = default;
+
+        /// @brief Destructor. Separa el nodo de su padre o de su actor, y de sus hijos y dibujables.
+        ~Nodo ();
+
+        /// @brief Obtiene la posición del nodo relativa a su padre.
+        /// @return Posición del nodo.
+        Vector posicion () const;
+
+        /// @brief Establece la posición del nodo relativa a su padre.
+        /// @param valor Posición del nodo.
+        void ponPosicion (Vector valor);
+
+        /// @brief Obtiene la rotación del nodo relativa a su padre.
+        /// @return Rotación en radianes.
+        float rotacion () const;
+
+        /// @brief Establece la rotación del nodo relativa a su padre.
+        /// @param radianes Rotación en radianes.
+        void ponRotacion (float radianes);
+
+        /// @brief Indica si el nodo está visible, sin considerar a sus antecesores.
+        /// @return Si el nodo está visible.
+        bool visible () const;
+
+        /// @brief Establece si el nodo, sus descendientes y sus dibujables se presentan.
+        /// @param valor Si el nodo está visible.
+        void ponVisible (bool valor);
+
+        /// @brief Obtiene la posición del nodo en la pantalla.
+        /// @return Posición resultante de la del nodo, sus antecesores y su actor.
+        Vector posicionMundo () const;
+
+        /// @brief Obtiene la rotación del nodo en la pantalla.
+        /// @return Rotación en radianes resultante de la del nodo, sus antecesores y su actor.
+        float rotacionMundo () const;
+
+        /// @brief Indica si el nodo y todos sus antecesores están visibles.
+        /// @return Si el nodo se presenta.
+        bool visibleMundo () const;
+
+        /// @brief Convierte una posición relativa al nodo en una posición en la pantalla.
+        /// @param posicion Posición relativa al nodo.
+        /// @return Posición en la pantalla.
+        Vector aplicaAPosicion (Vector posicion) const;
+
+        /// @brief Obtiene el nodo padre.
+        /// @return El nodo padre, o nulo si es una raíz.
+        Nodo * padre () const;
+
+        /// @brief Obtiene el actor al que se ha agregado el nodo como raíz (véase 
+        /// ActorBase#agregaNodo).
+        /// @return El actor, o nulo si el nodo no es la raíz de un actor.
+        ActorBase * actor () const;
+
+        /// @brief Obtiene los nodos hijos.
+        /// @return Nodos hijos, en el orden en que se agregaron.
+        const std::vector <Nodo *> & hijos () const;
+
+        /// @brief Agrega un nodo hijo.
+        /// @details El hijo no debe tener padre ni estar agregado a un actor.
+        /// @param hijo Nodo hijo.
+        void agregaHijo (Nodo * hijo);
+
+        /// @brief Extrae un nodo hijo, que pasa a ser una raíz sin actor.
+        /// @param hijo Nodo hijo.
+        void extraeHijo (Nodo * hijo);
+
+        /// @brief Obtiene los dibujables del nodo.
+        /// @return Dibujables del nodo.
+        const std::vector <Dibujable *> & dibujos () const;
+
+        /// @brief Agrega un dibujable al nodo y, si el nodo está en un actor, a la lista del actor.
+        /// @details El dibujable no debe estar en otro nodo. Su posición y rotación pasan a ser 
+        /// relativas al nodo.
+        /// @param dibujo Elemento dibujable.
+        void agregaDibujo (Dibujable * dibujo);
+
+        /// @brief Extrae un dibujable del nodo y, si el nodo está en un actor, de la lista del 
+        /// actor.
+        /// @param dibujo Elemento dibujable.
+        void extraeDibujo (Dibujable * dibujo);
+
+        /// @brief Extrae todos los dibujables del nodo.
+        void extraeDibujos ();
+
+    private:
+
+        Vector m_posicion {0.0, 0.0};
+        float  m_rotacion {0.0};
+        bool   m_visible  {true};
+
+        Nodo *                    m_padre {};
+        std::vector <Nodo *>      m_hijos {};
+        std::vector <Dibujable *> m_dibujos {};
+        // solo en la raíz de una jerarquía agregada a un actor
+        ActorBase *               m_actor {};
+
+        // situación y visibilidad del mundo, válidas si el nodo y sus descendientes no están 
+        // marcados
+        mutable Transforma m_mundo {};
+        mutable bool       visible_mundo {true};
+        mutable bool       marcado {true};
+        mutable bool       descendiente_marcado {};
+        mutable uint64_t   version_actor {};
+
+        void marca ();
+        void valida () const;
+        void calcula (bool forzado) const;
+        ActorBase * actorRaiz () const;
+        void registra (ActorBase * actor);
+        void retira (ActorBase * actor);
+
+        // los nodos no se pueden copiar ni mover       
+        Nodo (const Nodo & )              = delete;
+        Nodo (Nodo && )                   = delete;
+        Nodo & operator = (const Nodo & ) = delete;
+        Nodo & operator = (Nodo && )      = delete;
+
+        friend class ActorBase;
+
+    };
+
+
+    inline Vector Nodo::posicion () const {
+        return m_posicion;
+    }
+
+    inline float Nodo::rotacion () const {
+        return m_rotacion;
+    }
+
+    inline bool Nodo::visible () const {
+        return m_visible;
+    }
+
+    inline void Nodo::ponPosicion (Vector valor) {
+        if (m_posicion == valor) {
+            return;
+        }
+        m_posicion = valor;
+        marca ();
+    }
+
+    inline void Nodo::ponRotacion (float radianes) {
+        if (m_rotacion == radianes) {
+            return;
+        }
+        m_rotacion = radianes;
+        marca ();
+    }
+
+    inline void Nodo::ponVisible (bool valor) {
+        if (m_visible == valor) {
+            return;
+        }
+        m_visible = valor;
+        marca ();
+    }
+
+    inline Vector Nodo::posicionMundo () const {
+        valida ();
+        return m_mundo.posicion ();
+    }
+
+    inline float Nodo::rotacionMundo () const {
+        valida ();
+        return m_mundo.rotacion ();
+    }
+
+    inline bool Nodo::visibleMundo () const {
+        valida ();
+        return visible_mundo;
+    }
+
+    inline Vector Nodo::aplicaAPosicion (Vector posicion) const {
+        valida ();
+        return m_mundo.aplicaAPosicion (posicion);
+    }
+
+    inline Nodo * Nodo::padre () const {
+        return m_padre;
+    }
+
+    inline ActorBase * Nodo::actor () const {
+        return m_actor;
+    }
+
+    inline const std::vector <Nodo *> & Nodo::hijos () const {
+        return m_hijos;
+    }
+
+    inline const std::vector <Dibujable *> & Nodo::dibujos () const {
+        return m_dibujos;
+    }
+
+
+}
+
+
+/// @class unir2d::Nodo
+/// 
+/// Ejemplo de uso:
+/// @code
+/// class ActorVentana : public ActorBase {
+/// protected:
+///     void inicia () override {
+///         marco.ponPosicion (Vector {300, 200});
+///         titulo.ponPosicion (Vector {10, 4});
+///         panel.agregaDibujo (& marco);
+///         panel.agregaDibujo (& titulo);
+///         boton.ponPosicion (Vector {220, 160});
+///         panel.agregaHijo (& boton);
+///         agregaNodo (& panel);
+///     }
+///     void actualiza (double tiempo_seg) override {
+///         // mueve el marco, el título y el botón, con sus dibujables
+///         panel.ponPosicion (panel.posicion () + Vector {1, 0});
+///         if (Teclado::pulsando (Tecla::escape)) {
+///             panel.ponVisible (false);
+///         }
+///     }
+/// private:
+///     Nodo panel {};
+///     Nodo boton {};
+///     Rectangulo marco {};
+///     Texto titulo {"predeterminado"};
+/// };
+/// @endcode
@@ -0,0 +1,167 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: PanelRendimiento.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+#include "UNIR-2D.h"
+
+using namespace unir2d;
+
+
+/// @cond
+
+
+// colores de las fases del ciclo: actualización, dibujo y presentación
+static const sf::Color colores_fases [3] {
+        sf::Color {0x40, 0xA0, 0xFF}, 
+        sf::Color {0xFF, 0xA0, 0x40}, 
+        sf::Color {0xA0, 0xFF, 0x60} };
+
+
+PanelRendimiento::PanelRendimiento (JuegoBase * juego) {
+    this->juego = juego;
+    //
+    // la fuente se comparte con las instancias de Texto; sin ella se presenta solo la gráfica
+    Fuentes & fuentes = Texto::fuentes;
+    try {
+        if (! fuentes.tabla_fuentes.contains (nombre_fuente)) {
+            fuentes.carga (nombre_fuente);
+        }
+        con_fuente = true;
+    } catch (const std::runtime_error & ) {
+        con_fuente = false;
+    }
+    if (con_fuente) {
+        fuentes.cuenta_usos ++;
+        texto.setFont (* fuentes.tabla_fuentes.at (nombre_fuente));
+        texto.setCharacterSize (12);
+        texto.setFillColor (sf::Color::White);
+        texto.setPosition (margen * 2, margen * 2 + alto_grafica + margen);
+    }
+    cadena.reserve (256);
+    //
+    // fondo, línea de referencia de un ciclo y tres rectángulos por columna
+    float ancho = columnas * ancho_columna;
+    float alto  = alto_grafica + (con_fuente ? margen + alto_texto : 0.0f);
+    vertices.resize ((2 + columnas * fases) * 4);
+    auto rectangulo = [this] (int quad, float x, float y, float w, float h, sf::Color color) {
+        vertices [quad * 4    ] = sf::Vertex {sf::Vector2f {x,     y    }, color};
+        vertices [quad * 4 + 1] = sf::Vertex {sf::Vector2f {x + w, y    }, color};
+        vertices [quad * 4 + 2] = sf::Vertex {sf::Vector2f {x + w, y + h}, color};
+        vertices [quad * 4 + 3] = sf::Vertex {sf::Vector2f {x,     y + h}, color};
+    };
+    rectangulo (0, margen, margen, ancho + margen * 2, alto + margen * 2, sf::Color {0, 0, 0, 0xC0});
+    float referencia = margen * 2 + alto_grafica * (1.0f - 33333.0f / micrseg_grafica);
+    rectangulo (1, margen * 2, referencia, ancho, 1.0f, sf::Color {0xFF, 0xFF, 0xFF, 0x80});
+    for (int columna = 0; columna < columnas; ++ columna) {
+        for (int fase = 0; fase < fases; ++ fase) {
+            rectangulo (2 + columna * fases + fase, 0, 0, 0, 0, colores_fases [fase]);
+        }
+    }
+    inicio_muestra = std::chrono::steady_clock::now ();
+}
+
+
+PanelRendimiento::~PanelRendimiento () {
+    if (con_fuente) {
+        Fuentes & fuentes = Texto::fuentes;
+        fuentes.cuenta_usos --;
+        if (fuentes.cuenta_usos == 0) {
+            fuentes.descarga ();
+        }
+    }
+}
+
+
+void PanelRendimiento::registra (long micrseg_actualiza, long micrseg_dibuja, long micrseg_muestra) {
+    tiempos [siguiente] = {micrseg_actualiza, micrseg_dibuja, micrseg_muestra};
+    siguiente = (siguiente + 1) % columnas;
+    ciclos_muestra ++;
+    //
+    Momento ahora = std::chrono::steady_clock::now ();
+    double segundos = std::chrono::duration <double> (ahora - inicio_muestra).count ();
+    if (segundos >= 0.25) {
+        escribe (ciclos_muestra / segundos);
+        inicio_muestra = ahora;
+        ciclos_muestra = 0;
+    }
+}
+
+
+void PanelRendimiento::escribe (double fps) {
+    if (! con_fuente) {
+        return;
+    }
+    const std::array <long, fases> & ultimo = tiempos [(siguiente + columnas - 1) % columnas];
+    const CuentaPresentacion & cuenta = Estadisticas::ultimoCiclo ();
+    std::string estado = juego->nombreEstado ();
+    wchar_t linea [256];
+    std::swprintf (linea, 256, 
+            L"%5.1f fps  act %5.2f  dib %5.2f  pres %5.2f ms\n"
+            L"dibujos %ld  vertices %ld  texturas %ld\n"
+            L"Dibujable %d  Textura %d  Sonido %d  voces %d\n"
+            L"estado ",
+            fps, ultimo [0] / 1000.0, ultimo [1] / 1000.0, ultimo [2] / 1000.0,
+            cuenta.dibujos, cuenta.vertices, cuenta.cambios_textura,
+            Dibujable::cuenta_instancias, Textura::cuenta_instancias, Sonido::cuenta_instancias, 
+            Audio::vocesOcupadas ());
+    cadena.assign (linea);
+    // el nombre está en la codificación de la configuración regional, como en Texto
+    const std::ctype <wchar_t> & conversion = std::use_facet <std::ctype <wchar_t>> (std::locale {});
+    for (char caracter : estado) {
+        cadena.push_back (conversion.widen (caracter));
+    }
+    if (RastreoMemoria::activo ()) {
+        std::swprintf (linea, 256, L"\nreservas %ld  %zu bytes", 
+                RastreoMemoria::reservasCiclo (), RastreoMemoria::bytesCiclo ());
+        cadena.append (linea);
+    }
+    texto.setString (cadena);
+}
+
+
+void PanelRendimiento::dibuja (sf::RenderWindow * window) {
+    // la columna más antigua a la izquierda; cada fase se apila sobre la anterior
+    float escala = alto_grafica / micrseg_grafica;
+    float base   = margen * 2 + alto_grafica;
+    for (int columna = 0; columna < columnas; ++ columna) {
+        const std::array <long, fases> & tiempo = tiempos [(siguiente + columna) % columnas];
+        float izqrd = margen * 2 + columna * ancho_columna;
+        float derch = izqrd + ancho_columna;
+        float abajo = base;
+        for (int fase = 0; fase < fases; ++ fase) {
+            float arrba = std::max (abajo - tiempo [fase] * escala, margen * 2);
+            sf::Vertex * quad = & vertices [(2 + columna * fases + fase) * 4];
+            quad [0].position = sf::Vector2f {izqrd, arrba};
+            quad [1].position = sf::Vector2f {derch, arrba};
+            quad [2].position = sf::Vector2f {derch, abajo};
+            quad [3].position = sf::Vector2f {izqrd, abajo};
+            abajo = arrba;
+        }
+    }
+    //
+    // el panel se presenta sobre todo lo demás, con la vista por defecto
+    sf::View vista = window->getView ();
+    window->setView (window->getDefaultView ());
+    window->draw (vertices);
+    if (con_fuente) {
+        window->draw (texto);
+    }
+    window->setView (vista);
+}
+
+
+/// @endcond
@@ -0,0 +1,82 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: PanelRendimiento.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    /// @cond
+
+
+    // Panel superpuesto a la pantalla del juego con la gráfica de tiempos de los ciclos, los 
+    // fotogramas por segundo, los dibujos del último ciclo, las instancias vivas y el estado del 
+    // juego. La geometría se reserva al crear el panel y el texto se actualiza cuatro veces por 
+    // segundo; el panel se presenta con dos llamadas de dibujo.
+    class PanelRendimiento {
+    private:
+
+        // ciclos que aparecen en la gráfica
+        static constexpr int   columnas        = 120;
+        static constexpr float ancho_columna   = 2.0f;
+        // la altura de la gráfica corresponde a dos ciclos de 33333 microsegundos
+        static constexpr float alto_grafica    = 64.0f;
+        static constexpr float micrseg_grafica = 66666.0f;
+        static constexpr float margen          = 6.0f;
+        static constexpr float alto_texto      = 82.0f;
+        static constexpr int   fases           = 3;
+
+        JuegoBase * juego {};
+
+        static constexpr const char * nombre_fuente = "DejaVuSansMono";
+
+        bool con_fuente {false};
+        sf::Text texto {};
+        std::wstring cadena {};
+
+        sf::VertexArray vertices {sf::Quads};
+        std::array <std::array <long, fases>, columnas> tiempos {};
+        int siguiente {};
+
+        using Momento = std::chrono::time_point <std::chrono::steady_clock>;
+        Momento inicio_muestra {};
+        int ciclos_muestra {};
+
+        explicit PanelRendimiento (JuegoBase * juego);
+        ~PanelRendimiento ();
+
+        // No se pueden copiar ni mover las instancias de esta clase      
+        PanelRendimiento (const PanelRendimiento & )              = delete;
+        PanelRendimiento (PanelRendimiento && )                   = delete;
+        PanelRendimiento & operator = (const PanelRendimiento & ) = delete;
+        PanelRendimiento & operator = (PanelRendimiento && )      = delete;
+
+        void registra (long micrseg_actualiza, long micrseg_dibuja, long micrseg_muestra);
+        void dibuja (sf::RenderWindow * window);
+        void escribe (double fps);
+
+        friend class Motor;
+        friend class Rendidor;
+
+    };
+
+
+    /// @endcond
+
+
+}
@@ -0,0 +1,274 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: RastreoMemoria.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+#include "UNIR-2D.h"
+
+#if defined (_MSC_VER)
+    #include <intrin.h>
+    #include <malloc.h>
+#endif
+
+using namespace unir2d;
+
+
+/// @cond
+
+
+namespace {
+
+    // Todo el estado es trivialmente construible y destructible, de modo que los operadores 
+    // globales lo pueden usar antes y después de la inicialización de las variables estáticas. 
+    thread_local bool  rastrea_hilo {};
+    thread_local bool  dentro {};
+    const char *       zona_actual {"juego"};
+    long               ciclo_actual {1};
+    long               reservas_en_curso {};
+    size_t             bytes_en_curso {};
+    long               reservas_ciclo {};
+    size_t             bytes_ciclo {};
+    long               reservas_totales {};
+    size_t             bytes_totales {};
+    RastreoMemoria::Muestra muestras_guardadas [RastreoMemoria::cuentaMuestras] {};
+    long               cuenta_guardadas {};
+
+
+    void anota (size_t bytes, const void * direccion) {
+        if (! rastrea_hilo || dentro) {
+            return;
+        }
+        dentro = true;
+        reservas_en_curso ++;
+        bytes_en_curso += bytes;
+        if ((reservas_totales + reservas_en_curso) % RastreoMemoria::intervaloMuestreo == 1) {
+            RastreoMemoria::Muestra & muestra = 
+                    muestras_guardadas [cuenta_guardadas % RastreoMemoria::cuentaMuestras];
+            muestra.ciclo     = ciclo_actual;
+            muestra.zona      = zona_actual;
+            muestra.direccion = direccion;
+            muestra.bytes     = bytes;
+            cuenta_guardadas ++;
+        }
+        dentro = false;
+    }
+
+}
+
+
+RastreoMemoria::Zona::Zona (const char * nombre) {
+    previa = zona_actual;
+    zona_actual = nombre;
+}
+
+
+RastreoMemoria::Zona::~Zona () {
+    zona_actual = previa;
+}
+
+
+bool RastreoMemoria::disponible () {
+#if defined (UNIR2D_RASTREO_MEMORIA)
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+bool RastreoMemoria::activo () {
+    return rastrea_hilo;
+}
+
+
+long RastreoMemoria::reservasCiclo () {
+    return reservas_ciclo;
+}
+
+
+size_t RastreoMemoria::bytesCiclo () {
+    return bytes_ciclo;
+}
+
+
+long RastreoMemoria::reservasTotales () {
+    return reservas_totales + reservas_en_curso;
+}
+
+
+size_t RastreoMemoria::bytesTotales () {
+    return bytes_totales + bytes_en_curso;
+}
+
+
+void RastreoMemoria::muestras (std::vector <Muestra> & muestras) {
+    muestras.clear ();
+    long primera = std::max (0L, cuenta_guardadas - cuentaMuestras);
+    for (long indc = primera; indc < cuenta_guardadas; ++ indc) {
+        muestras.push_back (muestras_guardadas [indc % cuentaMuestras]);
+    }
+}
+
+
+void RastreoMemoria::escribe (std::ostream & salida) {
+    if (! disponible ()) {
+        return;
+    }
+    salida << "  reservas de memoria " << reservasTotales () << ", " << bytesTotales () << " bytes\n";
+    std::vector <Muestra> lista {};
+    muestras (lista);
+    for (const Muestra & muestra : lista) {
+        salida << "    ciclo " << muestra.ciclo << "  " << muestra.zona << "  " << 
+                muestra.direccion << "  " << muestra.bytes << " bytes\n";
+    }
+}
+
+
+void RastreoMemoria::activa () {
+    rastrea_hilo = disponible ();
+}
+
+
+void RastreoMemoria::desactiva () {
+    rastrea_hilo = false;
+}
+
+
+void RastreoMemoria::terminaCiclo (long ciclo) {
+    reservas_ciclo    = reservas_en_curso;
+    bytes_ciclo       = bytes_en_curso;
+    reservas_totales += reservas_en_curso;
+    bytes_totales    += bytes_en_curso;
+    reservas_en_curso = 0;
+    bytes_en_curso    = 0;
+    ciclo_actual      = ciclo + 1;
+}
+
+
+#if defined (UNIR2D_RASTREO_MEMORIA)
+
+#if defined (_MSC_VER)
+    #define UNIR2D_DIRECCION_LLAMADA _ReturnAddress ()
+#else
+    #define UNIR2D_DIRECCION_LLAMADA __builtin_return_address (0)
+#endif
+
+
+namespace {
+
+    void * reserva (size_t bytes, const void * direccion) {
+        void * memoria = std::malloc (bytes == 0 ? 1 : bytes);
+        if (memoria == nullptr) {
+            throw std::bad_alloc {};
+        }
+        anota (bytes, direccion);
+        return memoria;
+    }
+
+    void * reservaAlineada (size_t bytes, std::align_val_t alineacion, const void * direccion) {
+        size_t alinea = static_cast <size_t> (alineacion);
+        size_t tamano = (std::max (bytes, size_t {1}) + alinea - 1) & ~(alinea - 1);
+#if defined (_MSC_VER)
+        void * memoria = _aligned_malloc (tamano, alinea);
+#else
+        void * memoria = std::aligned_alloc (alinea, tamano);
+#endif
+        if (memoria == nullptr) {
+            throw std::bad_alloc {};
+        }
+        anota (bytes, direccion);
+        return memoria;
+    }
+
+    void liberaAlineada (void * memoria) {
+#if defined (_MSC_VER)
+        _aligned_free (memoria);
+#else
+        std::free (memoria);
+#endif
+    }
+
+}
+
+
+void * operator new (size_t bytes) {
+    return reserva (bytes, UNIR2D_DIRECCION_LLAMADA);
+}
+
+void * operator new [] (size_t bytes) {
+    return reserva (bytes, UNIR2D_DIRECCION_LLAMADA);
+}
+
+void * operator new (size_t bytes, const std::nothrow_t & ) noexcept {
+    try {
+        return reserva (bytes, UNIR2D_DIRECCION_LLAMADA);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void * operator new [] (size_t bytes, const std::nothrow_t & ) noexcept {
+    try {
+        return reserva (bytes, UNIR2D_DIRECCION_LLAMADA);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void * operator new (size_t bytes, std::align_val_t alineacion) {
+    return reservaAlineada (bytes, alineacion, UNIR2D_DIRECCION_LLAMADA);
+}
+
+void * operator new [] (size_t bytes, std::align_val_t alineacion) {
+    return reservaAlineada (bytes, alineacion, UNIR2D_DIRECCION_LLAMADA);
+}
+
+void operator delete (void * memoria) noexcept {
+    std::free (memoria);
+}
+
+void operator delete [] (void * memoria) noexcept {
+    std::free (memoria);
+}
+
+void operator delete (void * memoria, size_t ) noexcept {
+    std::free (memoria);
+}
+
+void operator delete [] (void * memoria, size_t ) noexcept {
+    std::free (memoria);
+}
+
+void operator delete (void * memoria, std::align_val_t ) noexcept {
+    liberaAlineada (memoria);
+}
+
+void operator delete [] (void * memoria, std::align_val_t ) noexcept {
+    liberaAlineada (memoria);
+}
+
+void operator delete (void * memoria, size_t , std::align_val_t ) noexcept {
+    liberaAlineada (memoria);
+}
+
+void operator delete [] (void * memoria, size_t , std::align_val_t ) noexcept {
+    liberaAlineada (memoria);
+}
+
+#endif
+
+
+/// @endcond
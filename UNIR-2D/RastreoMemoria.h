@@ -0,0 +1,137 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: RastreoMemoria.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    class Motor;
+
+
+    /// @brief Rastreo de las reservas de memoria dinámica del hilo del bucle del juego.
+    /// @details El rastreo está disponible cuando el motor se compila con el símbolo 
+    /// 'UNIR2D_RASTREO_MEMORIA' definido; en ese caso se sustituyen los operadores globales 'new' 
+    /// y 'delete' por otros que cuentan las reservas. Sin el símbolo, la clase no cuenta nada y los 
+    /// operadores globales no cambian.<p>
+    /// Una vez activado (véase Motor::ponRastreoMemoria), se cuentan las reservas y los bytes 
+    /// reservados en cada ciclo y en toda la ejecución. Además, se guarda una muestra de una de 
+    /// cada 'intervaloMuestreo' reservas, con la zona del motor en la que se hizo (véase 
+    /// RastreoMemoria::Zona) y la dirección de retorno del operador 'new'. Las reservas de los 
+    /// demás hilos no se cuentan.<p>
+    /// La dirección de retorno no es el punto del juego que causa la reserva: casi siempre está 
+    /// dentro de la biblioteca estándar (un 'allocator', el constructor de una cadena...). Para 
+    /// encontrar ese punto, se pone en el depurador un punto de interrupción en esa dirección y se 
+    /// examina la pila de llamadas.
+    class RastreoMemoria {
+    public:
+
+        /// @brief Una reserva de memoria muestreada.
+        struct Muestra {
+
+            /// @brief Ciclo en el que se hizo la reserva.
+            long ciclo {};
+
+            /// @brief Zona del motor en la que se hizo la reserva.
+            const char * zona {};
+
+            /// @brief Dirección de retorno del operador 'new'; normalmente, una función de la 
+            /// biblioteca estándar.
+            const void * direccion {};
+
+            /// @brief Bytes reservados.
+            size_t bytes {};
+
+        };
+
+        /// @brief Establece la zona del motor en la que se hacen las reservas mientras existe 
+        /// la instancia.
+        class Zona {
+        public:
+
+            /// @brief Constructor.
+            /// @param nombre Nombre de la zona; debe ser una cadena literal.
+            explicit Zona (const char * nombre);
+
+            /// @brief Destructor. Restablece la zona anterior.
+            ~Zona ();
+
+            // No se pueden copiar ni mover las instancias de esta clase. 
+            Zona (const Zona & )              = delete;
+            Zona (Zona && )                   = delete;
+            Zona & operator = (const Zona & ) = delete;
+            Zona & operator = (Zona && )      = delete;
+
+        private:
+
+            const char * previa;
+
+        };
+
+        /// @brief Número de muestras guardadas; se guardan las últimas.
+        static constexpr int cuentaMuestras = 64;
+
+        /// @brief Una de cada tantas reservas se guarda como muestra.
+        static constexpr int intervaloMuestreo = 16;
+
+        /// @brief Indica si el motor se ha compilado con el rastreo.
+        /// @return Si el rastreo está disponible.
+        static bool disponible ();
+
+        /// @brief Indica si el rastreo está activo.
+        /// @return Si el rastreo está activo.
+        static bool activo ();
+
+        /// @brief Número de reservas en el último ciclo terminado.
+        /// @return Número de reservas.
+        static long reservasCiclo ();
+
+        /// @brief Bytes reservados en el último ciclo terminado.
+        /// @return Bytes reservados.
+        static size_t bytesCiclo ();
+
+        /// @brief Número de reservas desde la activación del rastreo.
+        /// @return Número de reservas.
+        static long reservasTotales ();
+
+        /// @brief Bytes reservados desde la activación del rastreo.
+        /// @return Bytes reservados.
+        static size_t bytesTotales ();
+
+        /// @brief Obtiene las muestras guardadas, de la más antigua a la más reciente.
+        /// @param muestras Recibe las muestras.
+        static void muestras (std::vector <Muestra> & muestras);
+
+        /// @brief Escribe un resumen del rastreo y las muestras guardadas.
+        /// @param salida Flujo de salida.
+        static void escribe (std::ostream & salida);
+
+    private:
+
+        // El estado del rastreo está en 'RastreoMemoria.cpp', junto a los operadores globales; 
+        // así, los operadores no dependen de la inicialización de variables estáticas.
+        static void activa ();
+        static void desactiva ();
+        static void terminaCiclo (long ciclo);
+
+        friend class Motor;
+
+    };
+
+
+}
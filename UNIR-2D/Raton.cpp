@@ -16,107 +16,122 @@
 
 
 #include "UNIR-2D.h"
-#include <Windows.h>
 
 using namespace unir2d;
 
 
-void Raton::configura (Rendidor * rendidor) {
-    winHandle = rendidor->window->getSystemHandle ();
-    momento_clic = std::chrono::steady_clock::time_point::min ();
+void Raton::configura (Rendidor * rendidor, sf::Vector2i pixel) {
+    Raton::rendidor = rendidor;
+    s_pulsado.reset ();
+    s_consumido.reset ();
+    s_bajado.reset ();
+    s_subido.reset ();
+    s_pendiente.reset ();
+    s_doble_clic = false;
+    momento_clic = Momento {};
+    s_posicion = rendidor->coordenadasEscena (pixel.x, pixel.y);
 }
 
 
-void Raton::sondea () {
-    if (GetFocus () != winHandle) {
-        for (int indc = 0; indc < s_pulsado.size (); ++ indc) {
-            s_pulsado [indc] = false;
+void Raton::iniciaCiclo () {
+    s_bajado.reset ();
+    s_subido.reset ();
+    for (int indc = 0; indc < totalBotones; ++ indc) {
+        if (s_pendiente [indc]) {
+            suelta (indc);
         }
-        s_doble_clic = false;
-        return;
     }
-    //s_pulsado = false;
-    sondeaPulsado (BotonRaton::izquierda);
-    sondeaPulsado (BotonRaton::derecha);
-    sondeaPulsado (BotonRaton::centro);
-    sondeaDobleClic ();
-    sondeaPosicion ();
+    s_pendiente.reset ();
 }
 
 
-void Raton::sondeaPulsado (BotonRaton boton) {
-    int vkey = 0;
-    switch (boton) {
-        case BotonRaton::izquierda:  
-            if (GetSystemMetrics (SM_SWAPBUTTON) == 0) {
-                vkey = VK_LBUTTON; 
-            } else {
-                vkey = VK_RBUTTON; 
-            }
-            break;
-        case BotonRaton::derecha:    
-            if (GetSystemMetrics (SM_SWAPBUTTON) == 0) {
-                vkey = VK_RBUTTON; 
-            } else {
-                vkey = VK_LBUTTON; 
-            }
-            break;
-        case BotonRaton::centro:   
-            vkey = VK_MBUTTON;  
+void Raton::procesa (const sf::Event & suceso, Momento momento) {
+    switch (suceso.type) {
+    case sf::Event::MouseMoved:
+        s_posicion = rendidor->coordenadasEscena (suceso.mouseMove.x, suceso.mouseMove.y);
+        break;
+    case sf::Event::MouseButtonPressed: {
+        s_posicion = rendidor->coordenadasEscena (suceso.mouseButton.x, suceso.mouseButton.y);
+        int indc = indice (suceso.mouseButton.button);
+        if (indc >= 0) {
+            pulsa (indc, momento);
+        }
+        break;
+    }
+    case sf::Event::MouseButtonReleased: {
+        s_posicion = rendidor->coordenadasEscena (suceso.mouseButton.x, suceso.mouseButton.y);
+        int indc = indice (suceso.mouseButton.button);
+        if (indc < 0) {
             break;
-        default:
-            return;
+        }
+        // si se ha pulsado en este ciclo, se mantiene pulsado hasta el siguiente
+        if (s_bajado [indc]) {
+            s_pendiente [indc] = true;
+        } else {
+            suelta (indc);
+        }
+        break;
     }
-    int indice = static_cast <int> (boton);
-    if ((GetAsyncKeyState(vkey) & 0x8000) != 0) {
-        s_pulsado [indice] = true;
-    } else {
-        s_pulsado   [indice] = false;
-        s_consumido [indice] = false;
+    case sf::Event::LostFocus:
+        sueltaTodos ();
+        break;
+    default:
+        break;
     }
 }
 
 
-void Raton::sondeaDobleClic () {
-    int vkey = 0;
-    if (GetSystemMetrics (SM_SWAPBUTTON) == 0) {
-        vkey = VK_LBUTTON; 
-    } else {
-        vkey = VK_RBUTTON; 
+int Raton::indice (sf::Mouse::Button boton) {
+    // el sistema ya tiene en cuenta el intercambio de botones para zurdos
+    switch (boton) {
+    case sf::Mouse::Left:   return static_cast <int> (BotonRaton::izquierda);
+    case sf::Mouse::Right:  return static_cast <int> (BotonRaton::derecha);
+    case sf::Mouse::Middle: return static_cast <int> (BotonRaton::centro);
+    default:
+        return -1;
     }
-    bool clic = (GetAsyncKeyState(vkey) & 0x8000) != 0;
-    if (! clic) {
-        s_doble_clic = false;
+}
+
+
+void Raton::pulsa (int indice, Momento momento) {
+    s_pulsado   [indice] = true;
+    s_bajado    [indice] = true;
+    s_pendiente [indice] = false;
+    if (indice != static_cast <int> (BotonRaton::izquierda)) {
         return;
     }
     //
-	Momento ahora = std::chrono::steady_clock::now ();
-    std::chrono::nanoseconds lapso = ahora - momento_clic;        
-    momento_clic = ahora;
-    //
-    constexpr std::chrono::nanoseconds ms__50 { 50 * 1000 * 1000};  // 50 millisegundos
-    constexpr std::chrono::nanoseconds ms_200 {200 * 1000 * 1000}; // 200 millisegundos
-    //
-    if (lapso > ms_200) {
-        s_doble_clic = false;
+    // doble-clic; tras detectarlo, la siguiente pulsación empieza de nuevo
+    bool cerca = norma (s_posicion - posicion_clic) <= distanciaDobleClic;
+    if (momento - momento_clic <= intervaloDobleClic && cerca) {
+        s_doble_clic = true;
+        momento_clic = Momento {};
+    } else {
+        momento_clic  = momento;
+        posicion_clic = s_posicion;
+    }
+}
+
+
+void Raton::suelta (int indice) {
+    if (! s_pulsado [indice]) {
         return;
     }
-    if (lapso < ms__50) {
+    s_pulsado   [indice] = false;
+    s_consumido [indice] = false;
+    s_subido    [indice] = true;
+    if (indice == static_cast <int> (BotonRaton::izquierda)) {
         s_doble_clic = false;
-        return;
     }
-    s_doble_clic = true;
 }
 
 
-void Raton::sondeaPosicion () {
-    POINT raton;
-    GetCursorPos (& raton);
-    WINDOWINFO win_info;
-    BOOL bien =  GetWindowInfo (winHandle, & win_info);
-    s_posicion = Vector {
-            (float) (raton.x - win_info.rcClient.left), 
-            (float) (raton.y - win_info.rcClient.top ) };
+void Raton::sueltaTodos () {
+    for (int indc = 0; indc < totalBotones; ++ indc) {
+        suelta (indc);
+    }
+    s_pendiente.reset ();
+    momento_clic = Momento {};
 }
 
 
@@ -126,16 +141,22 @@ bool Raton::pulsando (BotonRaton boton) {
         return false;
     }
     return s_pulsado [indice];
-//    return s_pulsado && s_boton == boton;
+}
+
+
+bool Raton::recienPulsado (BotonRaton boton) {
+    return s_bajado [static_cast <int> (boton)];
+}
+
+
+bool Raton::recienSoltado (BotonRaton boton) {
+    return s_subido [static_cast <int> (boton)];
 }
 
 
 void Raton::consumePulsado (BotonRaton boton) {
     int indice = static_cast <int> (boton);
     s_consumido [indice] = true;
-    //if (s_pulsado && s_boton == boton) {
-    //    s_pulsado = false;
-    //}
 }
 
 
@@ -152,4 +173,3 @@ void Raton::consumeDobleClic () {
 Vector Raton::posicion () {
     return s_posicion;
 }
-
@@ -27,24 +27,47 @@ namespace unir2d {
 	/// @brief Clase que implementa el acceso al ratón del sistema.
 	/// @details Esta clase detecta si se ha realizado una pulsación reciente doble del botón 
 	/// izquierdo del ratón. Es lo que se denomina doble-clic.<p>
-	/// La clase Motor comprueba el estado de pulsación de los botones del ratón una sola vez en 
-	/// cada ciclo del bucle del juego. De esta forma, el resultado obtenido con los métodos de esta 
-	/// clase es coherente durante todo el ciclo.<p>
+	/// La ventana del juego recibe las pulsaciones de los botones y los movimientos del ratón como 
+	/// sucesos, que la clase Motor procesa una sola vez al principio de cada ciclo del bucle del 
+	/// juego. De esta forma, el resultado obtenido con los métodos de esta clase es coherente 
+	/// durante todo el ciclo. Un botón pulsado y soltado entre dos ciclos consecutivos aparece 
+	/// pulsado durante un ciclo, de modo que los clics rápidos no se pierden.<p>
 	/// La pulsación de un botón del ratón es lenta en comparación con la ejecución de los ciclos 
 	/// del bucle del juego. Si, durante un ciclo, el juego responde a una pulsación con una acción, en 
 	/// el siguiente ciclo el botón puede seguir estando pulsado y, en consecuencia, la accion se puede 
 	/// repetir. Para evitar este efecto, esta clase puede marcar una pulsación como 'consumida',
 	/// lo que es equivalente a anular la pulsación. La pulsacion se vuelve a detectar cuando el 
-	/// jugador levanta el botón y lo vuelve a pulsar.
+	/// jugador levanta el botón y lo vuelve a pulsar.<p>
+	/// Al perder la ventana el foco se sueltan todos los botones.
 	class Raton {
 	public:
 
-		/// @brief Comprueba si el botón del ratón indicado está pulsado en el momento de la llamada.
+		/// @brief Tiempo máximo entre las dos pulsaciones de un doble-clic.
+		static constexpr std::chrono::milliseconds intervaloDobleClic {400};
+
+		/// @brief Distancia máxima, en píxeles, entre las dos pulsaciones de un doble-clic.
+		static constexpr float distanciaDobleClic = 4.0f;
+
+		/// @brief Comprueba si el botón del ratón indicado está pulsado en el ciclo actual.
 		/// @details La pulsación doble (doble-clic) y la pulsación simple no son excluyentes.
 		/// @param boton Botón del ratón que se comprueba.
 		/// @return Si el botón está pulsado.
 		static bool pulsando (BotonRaton boton);
 
+		/// @brief Comprueba si el botón del ratón indicado se ha pulsado al comienzo del ciclo 
+		/// actual.
+		/// @details Es verdadero solo en el ciclo en que se recibe la pulsación, aunque el botón 
+		/// esté consumido.
+		/// @param boton Botón del ratón que se comprueba.
+		/// @return Si el botón se acaba de pulsar.
+		static bool recienPulsado (BotonRaton boton);
+
+		/// @brief Comprueba si el botón del ratón indicado se ha soltado al comienzo del ciclo 
+		/// actual.
+		/// @param boton Botón del ratón que se comprueba.
+		/// @return Si el botón se acaba de soltar.
+		static bool recienSoltado (BotonRaton boton);
+
 		/// @brief Anula la pulsación actual del botón del ratón indicado.
 		/// @details Si el botón indicado está pulsado, lo marca como no pulsado hasta que el 
 		/// jugador lo vuelva a pulsar.
@@ -52,7 +75,9 @@ namespace unir2d {
 		static void consumePulsado (BotonRaton boton);
 
 		/// @brief Comprueba si se ha realizado un doble-clic reciente con el ratón.
-		/// @details El doble-clic y la pulsación simple no son excluyentes.
+		/// @details El doble-clic se detecta al recibir una pulsación del botón izquierdo a menos de 
+		/// 'intervaloDobleClic' y de 'distanciaDobleClic' de la pulsación anterior, y dura hasta 
+		/// que se suelta el botón. El doble-clic y la pulsación simple no son excluyentes.
 		/// @return Si se ha reaizado un doble-clic reciente.
 		static bool dobleClic ();
 
@@ -61,10 +86,11 @@ namespace unir2d {
 		/// el jugador lo vuelva a realizar.
 		static void consumeDobleClic ();
 
-		/// @brief Obtiene la posición del ratón en el momento de la llamada.
+		/// @brief Obtiene la posición del ratón en el ciclo actual.
 		/// @details La posición del ratón es relativa a la posición del la pantalla del juego. El 
 		/// origen de la pantalla está en la esquina superior izquierda del area de cliente de la 
-		/// ventana.
+		/// ventana. Si la escena se dibuja a una escala reducida (véase Motor::ponEscalaPresentacion), 
+		/// la posición se da en las coordenadas de la escena, igual que a escala completa.
 		/// @return Posición del ratón.
 		static Vector posicion ();
 
@@ -72,28 +98,37 @@ namespace unir2d {
 
 		using Momento = std::chrono::time_point<std::chrono::steady_clock>;
 
-		inline static sf::WindowHandle winHandle;
-
-		inline static Momento momento_clic;
+		inline static Rendidor * rendidor {};
 
 		static const int totalBotones = static_cast <int> (BotonRaton::centro) + 1;
-		inline static std::array <bool, totalBotones> s_pulsado   { false };
-		inline static std::array <bool, totalBotones> s_consumido { false };
+		using Botones = std::bitset <totalBotones>;
 
-		inline static bool   s_doble_clic;
-		inline static Vector s_posicion;
+		inline static Botones s_pulsado   {};
+		inline static Botones s_consumido {};
+		inline static Botones s_bajado    {};
+		inline static Botones s_subido    {};
+		// botones pulsados y soltados en el mismo ciclo; se sueltan al comienzo del siguiente
+		inline static Botones s_pendiente {};
 
-		static void sondea ();
+		inline static Momento momento_clic {};
+		inline static Vector  posicion_clic {};
+		inline static bool    s_doble_clic {};
+		inline static Vector  s_posicion {};
 
-		static void configura (Rendidor * rendidor);
+		static void configura (Rendidor * rendidor, sf::Vector2i pixel);
+		static void iniciaCiclo ();
+		static void procesa (const sf::Event & suceso, Momento momento);
 
-		static void sondeaPulsado (BotonRaton boton);
-		static void sondeaDobleClic ();
-		static void sondeaPosicion ();
+		static int  indice (sf::Mouse::Button boton);
+		static void pulsa (int indice, Momento momento);
+		static void suelta (int indice);
+		static void sueltaTodos ();
 
 		friend class Motor;
+		friend class Rendidor;
+		friend class GrabacionEntrada;
 
 	};
 
 
-}
\ No newline at end of file
+}
@@ -21,8 +21,18 @@ using namespace unir2d;
 
 
 void Rectangulo::dibuja (const Transforma & contenedor, Rendidor * rendidor) {
-    Dibujable::situa (this->shape, contenedor, this->m_transforma);
-	rendidor->window->draw (this->shape);
+	sf::RenderStates states {};
+	states.transform = situa (contenedor);
+	rendidor->dibuja (this->shape, states, "Rectangulo", verticesFigura (this->shape), nullptr);
 }
 
 
+Dibujable::ClaveEstado Rectangulo::claveEstado () const {
+	return ClaveEstado {nullptr, nullptr, sf::TriangleFan};
+}
+
+
+bool Rectangulo::limitesPantalla (const Transforma & contenedor, sf::FloatRect & limites) {
+	limites = situa (contenedor).transformRect (this->shape.getLocalBounds ());
+	return true;
+}
@@ -74,6 +74,8 @@ namespace unir2d {
         Rectangulo & operator = (Rectangulo && )      = delete;
 
 		void dibuja (const Transforma & contenedor, Rendidor * rendidor) override;
+		ClaveEstado claveEstado () const override;
+		bool limitesPantalla (const Transforma & contenedor, sf::FloatRect & limites) override;
 
 	};
 
@@ -94,6 +96,7 @@ namespace unir2d {
 	inline void Rectangulo::ponBase (float valor) {
 		m_base = valor;
 		shape.setSize (sf::Vector2f {m_base, m_altura});
+		Estadisticas::cuentaReconstruccion ("Rectangulo");
 	}
 
 	inline float Rectangulo::altura () const {
@@ -103,6 +106,7 @@ namespace unir2d {
 	inline void Rectangulo::ponAltura (float valor) {
 		m_altura = valor;
 		shape.setSize (sf::Vector2f {m_base, m_altura});
+		Estadisticas::cuentaReconstruccion ("Rectangulo");
 	}
 
 	inline Color Rectangulo::color () const {
@@ -112,6 +116,8 @@ namespace unir2d {
 	inline void Rectangulo::ponColor (Color valor) {
 		m_color = valor;
 		shape.setFillColor (sf::Color {m_color.entero ()});
+		// SFML escribe de nuevo el color de los vértices de la figura
+		Estadisticas::cuentaReconstruccion ("Rectangulo");
 	}
 
 
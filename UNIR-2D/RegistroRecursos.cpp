@@ -0,0 +1,231 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: RegistroRecursos.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+#include "UNIR-2D.h"
+
+using namespace unir2d;
+
+
+/// @cond
+
+
+namespace {
+
+    const char * nombreClase (ClaseRecurso clase) {
+        switch (clase) {
+        case ClaseRecurso::textura:  return "textura";
+        case ClaseRecurso::sonido:   return "sonido";
+        case ClaseRecurso::flujo:    return "flujo";
+        case ClaseRecurso::fuente:   return "fuente";
+        case ClaseRecurso::vertices: return "vertices";
+        }
+        return "";
+    }
+
+    void escribeRecurso (std::ostream & salida, const RegistroRecursos::Recurso & recurso) {
+        salida << "    " << nombreClase (recurso.clase) << "  " << recurso.bytes << " bytes  " << 
+                recurso.propietario;
+        if (recurso.clase == ClaseRecurso::textura) {
+            salida << "  " << recurso.ancho << "x" << recurso.alto;
+            if (recurso.suavizada) {
+                salida << " suavizada";
+            }
+            if (recurso.para_rendir) {
+                salida << " para rendir";
+            }
+        }
+        if (! recurso.nombre.empty ()) {
+            salida << "  " << recurso.nombre;
+        }
+        salida << "\n";
+    }
+
+}
+
+
+int RegistroRecursos::cuenta (ClaseRecurso clase) {
+    std::lock_guard <std::mutex> bloqueo {cierre};
+    int cuenta = 0;
+    for (const auto & [objeto, recurso] : recursos) {
+        if (recurso.clase == clase) {
+            cuenta ++;
+        }
+    }
+    return cuenta;
+}
+
+
+size_t RegistroRecursos::bytes (ClaseRecurso clase) {
+    std::lock_guard <std::mutex> bloqueo {cierre};
+    size_t bytes = 0;
+    for (const auto & [objeto, recurso] : recursos) {
+        if (recurso.clase == clase) {
+            bytes += recurso.clase == ClaseRecurso::fuente ? bytesFuente (objeto) : recurso.bytes;
+        }
+    }
+    return bytes;
+}
+
+
+void RegistroRecursos::principales (int cuenta, std::vector <Recurso> & lista) {
+    lista.clear ();
+    {
+        std::lock_guard <std::mutex> bloqueo {cierre};
+        for (const auto & [objeto, recurso] : recursos) {
+            lista.push_back (recurso);
+            if (recurso.clase == ClaseRecurso::fuente) {
+                lista.back ().bytes = bytesFuente (objeto);
+            }
+        }
+    }
+    std::sort (lista.begin (), lista.end (), 
+            [] (const Recurso & a, const Recurso & b) { return a.bytes > b.bytes; });
+    if (lista.size () > cuenta) {
+        lista.resize (cuenta);
+    }
+}
+
+
+void RegistroRecursos::ponPresupuesto (ClaseRecurso clase, size_t bytes) {
+    presupuestos [static_cast <int> (clase)] = bytes;
+    avisados     [static_cast <int> (clase)] = false;
+    compruebaPresupuesto (clase);
+}
+
+
+bool RegistroRecursos::excedido (ClaseRecurso clase) {
+    size_t presupuesto = presupuestos [static_cast <int> (clase)];
+    return presupuesto > 0 && bytes (clase) > presupuesto;
+}
+
+
+void RegistroRecursos::escribe (std::ostream & salida, int cuenta) {
+    salida << "  recursos\n";
+    for (int indc = 0; indc < cuentaClases; ++ indc) {
+        ClaseRecurso clase = static_cast <ClaseRecurso> (indc);
+        salida << "    " << nombreClase (clase) << "  " << RegistroRecursos::cuenta (clase) << 
+                "  " << bytes (clase) << " bytes";
+        if (presupuestos [indc] > 0) {
+            salida << " de " << presupuestos [indc];
+        }
+        salida << "\n";
+    }
+    std::vector <Recurso> lista {};
+    principales (cuenta, lista);
+    salida << "  recursos principales\n";
+    for (const Recurso & recurso : lista) {
+        escribeRecurso (salida, recurso);
+    }
+}
+
+
+void RegistroRecursos::registra (const void * objeto, Recurso recurso) {
+    recurso.propietario = propietario_actual;
+    ClaseRecurso clase = recurso.clase;
+    {
+        std::lock_guard <std::mutex> bloqueo {cierre};
+        recursos [objeto] = std::move (recurso);
+    }
+    compruebaPresupuesto (clase);
+}
+
+
+void RegistroRecursos::retira (const void * objeto) {
+    std::lock_guard <std::mutex> bloqueo {cierre};
+    recursos.erase (objeto);
+    tamanos_fuente.erase (objeto);
+}
+
+
+void RegistroRecursos::marcaSuavizada (const void * objeto) {
+    std::lock_guard <std::mutex> bloqueo {cierre};
+    auto iter = recursos.find (objeto);
+    if (iter != recursos.end ()) {
+        iter->second.suavizada = true;
+    }
+}
+
+
+RegistroRecursos::Recurso RegistroRecursos::recursoFlujo (
+        const sf::Music & musica, const std::string & archivo) {
+    // SFML lee la música en bloques de un segundo de muestras de 16 bits
+    Recurso recurso {};
+    recurso.clase  = ClaseRecurso::flujo;
+    recurso.nombre = archivo;
+    recurso.bytes  = static_cast <size_t> (musica.getSampleRate ()) * musica.getChannelCount () * 
+                     sizeof (sf::Int16);
+    return recurso;
+}
+
+
+void RegistroRecursos::anotaTamanoFuente (const sf::Font * fuente, unsigned tamano) {
+    std::lock_guard <std::mutex> bloqueo {cierre};
+    std::vector <unsigned> & tamanos = tamanos_fuente [fuente];
+    if (std::find (tamanos.begin (), tamanos.end (), tamano) == tamanos.end ()) {
+        tamanos.push_back (tamano);
+    }
+}
+
+
+size_t RegistroRecursos::bytesFuente (const void * fuente) {
+    // cada tamaño de carácter usado tiene su página; crece a medida que se dibujan caracteres
+    auto iter = tamanos_fuente.find (fuente);
+    if (iter == tamanos_fuente.end ()) {
+        return 0;
+    }
+    size_t bytes = 0;
+    for (unsigned tamano : iter->second) {
+        sf::Vector2u pagina = static_cast <const sf::Font *> (fuente)->getTexture (tamano).getSize ();
+        bytes += static_cast <size_t> (pagina.x) * pagina.y * 4;
+    }
+    return bytes;
+}
+
+
+void RegistroRecursos::compruebaPresupuesto (ClaseRecurso clase) {
+    int indice = static_cast <int> (clase);
+    if (presupuestos [indice] == 0) {
+        return;
+    }
+    size_t ocupados = bytes (clase);
+    if (ocupados <= presupuestos [indice]) {
+        avisados [indice] = false;
+        return;
+    }
+    if (! avisados [indice]) {
+        avisados [indice] = true;
+        std::cout << "Presupuesto de " << nombreClase (clase) << " superado: " << ocupados << 
+                " bytes de " << presupuestos [indice] << "\n";
+    }
+}
+
+
+bool RegistroRecursos::escribeFugas (std::ostream & salida) {
+    std::lock_guard <std::mutex> bloqueo {cierre};
+    if (recursos.empty ()) {
+        return false;
+    }
+    salida << "Recursos no liberados:\n";
+    for (const auto & [objeto, recurso] : recursos) {
+        escribeRecurso (salida, recurso);
+    }
+    return true;
+}
+
+
+/// @endcond
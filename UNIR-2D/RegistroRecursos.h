@@ -0,0 +1,179 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: RegistroRecursos.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    /// @brief Clases de recursos registrados en RegistroRecursos.
+    enum class ClaseRecurso {
+        /// @brief Textura cargada o creada para dibujar en ella.
+        textura,
+        /// @brief Sonido decodificado en memoria.
+        sonido,
+        /// @brief Música que se lee del archivo mientras suena.
+        flujo,
+        /// @brief Fuente de caracteres, con las páginas de caracteres de los tamaños usados.
+        fuente,
+        /// @brief Búfer de vértices en la tarjeta gráfica.
+        vertices
+    };
+
+
+    /// @brief Registro de los recursos del motor que existen en cada momento.
+    /// @details Las clases Textura, Audio, Sonido, Musica, Fuentes y Malla registran sus 
+    /// recursos al cargarlos o crearlos, y los retiran al liberarlos. Cada recurso anota una 
+    /// estimación de la memoria que ocupa, en la tarjeta gráfica o en la memoria principal, y el 
+    /// propietario vigente al registrarlo (véase RegistroRecursos::Propietario).<p>
+    /// El registro permite consultar los totales por clase de recurso y los recursos que más 
+    /// memoria ocupan, y fijar un presupuesto de memoria para cada clase; al superarlo se escribe 
+    /// un aviso en la consola. Al terminar el juego se escriben en la consola los recursos que no 
+    /// se han liberado, con sus propietarios.
+    class RegistroRecursos {
+    public:
+
+        /// @brief Datos de un recurso registrado.
+        struct Recurso {
+
+            /// @brief Clase de recurso.
+            ClaseRecurso clase {};
+
+            /// @brief Archivo del recurso; vacío si el recurso se ha creado.
+            std::string nombre {};
+
+            /// @brief Propietario vigente al registrar el recurso.
+            const char * propietario {};
+
+            /// @brief Anchura, en píxeles, de una textura.
+            unsigned ancho {};
+
+            /// @brief Altura, en píxeles, de una textura.
+            unsigned alto {};
+
+            /// @brief Si la textura se presenta suavizada.
+            bool suavizada {};
+
+            /// @brief Si es una textura creada para dibujar en ella.
+            bool para_rendir {};
+
+            /// @brief Memoria estimada, en bytes. En una fuente, la de sus páginas de caracteres.
+            size_t bytes {};
+
+        };
+
+        /// @brief Establece el propietario de los recursos registrados mientras existe la 
+        /// instancia, en el hilo que la crea.
+        class Propietario {
+        public:
+
+            /// @brief Constructor.
+            /// @param nombre Nombre del propietario; debe ser una cadena literal.
+            explicit Propietario (const char * nombre);
+
+            /// @brief Destructor. Restablece el propietario anterior.
+            ~Propietario ();
+
+            // No se pueden copiar ni mover las instancias de esta clase. 
+            Propietario (const Propietario & )              = delete;
+            Propietario (Propietario && )                   = delete;
+            Propietario & operator = (const Propietario & ) = delete;
+            Propietario & operator = (Propietario && )      = delete;
+
+        private:
+
+            const char * previo;
+
+        };
+
+        /// @brief Número de recursos registrados de una clase.
+        /// @param clase Clase de recurso.
+        /// @return Número de recursos.
+        static int cuenta (ClaseRecurso clase);
+
+        /// @brief Memoria estimada de los recursos registrados de una clase.
+        /// @param clase Clase de recurso.
+        /// @return Memoria, en bytes.
+        static size_t bytes (ClaseRecurso clase);
+
+        /// @brief Obtiene los recursos que más memoria ocupan, de mayor a menor.
+        /// @param cuenta Número máximo de recursos.
+        /// @param lista Recibe los recursos.
+        static void principales (int cuenta, std::vector <Recurso> & lista);
+
+        /// @brief Establece el presupuesto de memoria de una clase de recurso.
+        /// @details Cuando la memoria de la clase supera el presupuesto se escribe un aviso en la
+        /// consola, una sola vez hasta que vuelve a estar dentro del presupuesto.
+        /// @param clase Clase de recurso.
+        /// @param bytes Presupuesto, en bytes; cero para no tener presupuesto.
+        static void ponPresupuesto (ClaseRecurso clase, size_t bytes);
+
+        /// @brief Indica si la memoria de una clase de recurso supera su presupuesto.
+        /// @param clase Clase de recurso.
+        /// @return Si supera el presupuesto.
+        static bool excedido (ClaseRecurso clase);
+
+        /// @brief Escribe los totales por clase de recurso y los recursos que más memoria ocupan.
+        /// @param salida Flujo de salida.
+        /// @param cuenta Número máximo de recursos escritos.
+        static void escribe (std::ostream & salida, int cuenta = 10);
+
+    private:
+
+        static constexpr int cuentaClases = 5;
+
+        // Los recursos se registran también desde el hilo de Musica.
+        inline static std::mutex cierre {};
+        inline static std::unordered_map <const void *, Recurso> recursos {};
+        inline static std::unordered_map <const void *, std::vector <unsigned>> tamanos_fuente {};
+        inline static std::array <size_t, cuentaClases> presupuestos {};
+        inline static std::array <bool,   cuentaClases> avisados {};
+        inline static thread_local const char * propietario_actual {"juego"};
+
+        static void registra (const void * objeto, Recurso recurso);
+        static void retira (const void * objeto);
+        static void marcaSuavizada (const void * objeto);
+        static Recurso recursoFlujo (const sf::Music & musica, const std::string & archivo);
+        static void anotaTamanoFuente (const sf::Font * fuente, unsigned tamano);
+        static size_t bytesFuente (const void * fuente);
+        static void compruebaPresupuesto (ClaseRecurso clase);
+        static bool escribeFugas (std::ostream & salida);
+
+        friend class Textura;
+        friend class Audio;
+        friend class Sonido;
+        friend class Musica;
+        friend class Fuentes;
+        friend class Texto;
+        friend class Malla;
+        friend class JuegoBase;
+
+    };
+
+
+    inline RegistroRecursos::Propietario::Propietario (const char * nombre) {
+        previo = propietario_actual;
+        propietario_actual = nombre;
+    }
+
+    inline RegistroRecursos::Propietario::~Propietario () {
+        propietario_actual = previo;
+    }
+
+
+}
@@ -34,39 +34,147 @@ void Rendidor::abre (JuegoBase * juego) {
                 sf::Style::Titlebar | sf::Style::Close);
     window->setPosition (sf::Vector2i ((int) posicion.x (), (int) posicion.y ())); 
     //window->setVerticalSyncEnabled (true);
+    destino = window;
 }
 
 
 void Rendidor::cierra () {
+    destino = nullptr;
+    delete escena;
+    escena = nullptr;
     window->close();
 }
 
 
 void Rendidor::limpia () {
-    window->clear(sf::Color(150, 150, 150, 255));
+    destino->clear(sf::Color(150, 150, 150, 255));
 }
 
 
 void Rendidor::muestra () {
+    if (destino != window) {
+        //
+        // amplía la parte dibujada de la escena a toda la ventana
+        escena->display ();
+        sf::Vector2u tamano = window->getSize ();
+        sf::IntRect parte {0, 0, 
+                std::max (1, (int) std::lround (tamano.x * escala)), 
+                std::max (1, (int) std::lround (tamano.y * escala)) };
+        sf::Sprite ampliada {escena->getTexture (), parte};
+        ampliada.setScale ((float) tamano.x / parte.width, (float) tamano.y / parte.height);
+        Estadisticas::cuentaDibujo ("Rendidor", 4, & escena->getTexture (), window);
+        window->draw (ampliada);
+    }
+    // la captura no incluye el panel de rendimiento
+    if (captura != nullptr) {
+        captura->toma (window);
+    }
+    if (panel != nullptr) {
+        panel->dibuja (window);
+    }
     window->display();
 }
 
 
-bool Rendidor::cerrado () {
+bool Rendidor::cerrado (int ciclo) {
+    // los sucesos de teclado y ratón se reparten entre Teclado y Raton; al reproducir una 
+    // grabación, los sucesos reales se descartan y se reparten los grabados
+    bool reproduciendo = grabacion != nullptr && grabacion->reproduciendo ();
+    sucesos = 0;
     sf::Event event;
     while (window->pollEvent (event)) {
         if (event.type == sf::Event::Closed) {
             return true;
         }
+        sucesos ++;
+        if (reproduciendo) {
+            continue;
+        }
+        auto momento = std::chrono::steady_clock::now ();
+        if (grabacion != nullptr) {
+            grabacion->registra (event, momento);
+        }
+        Teclado::procesa (event, momento);
+        Raton  ::procesa (event, momento);
         //if (event.type == sf::Event::KeyPressed) {
         //    if (event.key.code == sf::Keyboard::Escape) {
         //        return true;
         //    }
         //}
     }
+    if (reproduciendo) {
+        return ! grabacion->reproduce (ciclo);
+    }
     return false;
 }
 
 
+void Rendidor::ponEscala (float escala, bool suavizado) {
+    assert (escala > 0.0f);
+    this->escala    = std::min (escala, 1.0f);
+    this->suavizado = suavizado;
+    if (this->escala == 1.0f) {
+        destino = window;
+        return;
+    }
+    //
+    // la textura tiene el tamaño de la ventana; la escala solo cambia la parte usada
+    sf::Vector2u tamano = window->getSize ();
+    if (escena == nullptr) {
+        escena = new sf::RenderTexture {};
+        if (! escena->create (tamano.x, tamano.y)) {
+            delete escena;
+            escena = nullptr;
+            this->escala = 1.0f;
+            destino = window;
+            return;
+        }
+    }
+    escena->setSmooth (suavizado);
+    // la escena reducida muestra lo mismo que la vista de la ventana
+    sf::View vista = window->getView ();
+    vista.setViewport (sf::FloatRect {0.0f, 0.0f, this->escala, this->escala});
+    escena->setView (vista);
+    destino = escena;
+}
+
+
+const sf::View & Rendidor::vista () const {
+    return destino->getView ();
+}
+
+
+Vector Rendidor::coordenadasEscena (int x, int y) const {
+    // en los dos modos la escena ocupa la ventana completa: el píxel se normaliza respecto a la 
+    // ventana y se lleva a la escena con la vista con la que se dibuja
+    sf::Vector2u tamano = window->getSize ();
+    sf::Vector2f normalizado {
+            -1.0f + 2.0f * x / tamano.x, 
+             1.0f - 2.0f * y / tamano.y };
+    sf::Vector2f punto = destino->getView ().getInverseTransform ().transformPoint (normalizado);
+    return Vector {punto.x, punto.y};
+}
+
+
+void Rendidor::dibuja (const sf::Drawable & objeto, const sf::RenderStates & states, 
+                       const char * clase, size_t vertices, const sf::Texture * textura) {
+    Estadisticas::cuentaDibujo (clase, vertices, textura, destino);
+    destino->draw (objeto, states);
+}
+
+
+void Rendidor::dibuja (const sf::VertexArray & vertices, const sf::RenderStates & states, const char * clase) {
+    Estadisticas::cuentaDibujo (clase, vertices.getVertexCount (), states.texture, destino);
+    destino->draw (vertices, states);
+}
+
+
+void Rendidor::dibuja (const sf::Vertex * vertices, size_t cuenta, sf::PrimitiveType tipo, 
+                       const sf::RenderStates & states, const char * clase) {
+    Estadisticas::cuentaDibujo (clase, cuenta, states.texture, destino);
+    destino->draw (vertices, cuenta, tipo, states);
+}
+
+
 /// @endcond
 
@@ -25,6 +25,16 @@ namespace unir2d {
     private:
 
         sf::RenderWindow * window {};
+        // Destino de los dibujos de la escena: la ventana, o 'escena' si se dibuja a escala reducida.
+        sf::RenderTarget * destino {};
+        sf::RenderTexture * escena {};
+        float escala {1.0f};
+        bool suavizado {};
+        PanelRendimiento * panel {};
+        CapturaFotogramas * captura {};
+        GrabacionEntrada * grabacion {};
+        // Sucesos de teclado y ratón recibidos en el último ciclo.
+        int sucesos {};
 
         explicit Rendidor() = default;
         ~Rendidor() = default;
@@ -40,7 +50,20 @@ namespace unir2d {
         void limpia ();
         void muestra ();
 
-        bool cerrado ();
+        bool cerrado (int ciclo);
+
+        // Con una escala menor que 1, la escena se dibuja en la parte superior izquierda de 
+        // 'escena', reducida, y se amplía a la ventana al mostrarla. 
+        void ponEscala (float escala, bool suavizado);
+        const sf::View & vista () const;
+        Vector coordenadasEscena (int x, int y) const;
+
+        // Dibujan en la ventana y cuentan el dibujo en Estadisticas a nombre de 'clase'.
+        void dibuja (const sf::Drawable & objeto, const sf::RenderStates & states, 
+                     const char * clase, size_t vertices, const sf::Texture * textura);
+        void dibuja (const sf::VertexArray & vertices, const sf::RenderStates & states, const char * clase);
+        void dibuja (const sf::Vertex * vertices, size_t cuenta, sf::PrimitiveType tipo, 
+                     const sf::RenderStates & states, const char * clase);
 
         friend class Teclado;
         friend class Raton;
@@ -52,6 +75,7 @@ namespace unir2d {
         friend class Rectangulo;
         friend class Imagen;
         friend class Baldosas;
+        friend class CapaBaldosas;
         friend class Malla;
         friend class Texto;
 
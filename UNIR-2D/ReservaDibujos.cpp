@@ -0,0 +1,84 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: ReservaDibujos.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+#include "UNIR-2D.h"
+
+using namespace unir2d;
+
+
+/// @cond
+
+
+void * ReservaDibujos::reserva (size_t bytes) {
+    assert (! Tareas::enHiloTareas ());
+    if (bytes > tamanoMaximo) {
+        return ::operator new (bytes);
+    }
+    size_t indice = (bytes - 1) / alineacion;
+    Clase & clase = clases [indice];
+    if (clase.libre == nullptr) {
+        agregaLosa (clase, (indice + 1) * alineacion);
+    }
+    Hueco * hueco = clase.libre;
+    clase.libre = hueco->siguiente;
+    clase.ocupados ++;
+    return hueco;
+}
+
+
+void ReservaDibujos::devuelve (void * objeto, size_t bytes) {
+    assert (! Tareas::enHiloTareas ());
+    if (objeto == nullptr) {
+        return;
+    }
+    if (bytes > tamanoMaximo) {
+        ::operator delete (objeto);
+        return;
+    }
+    Clase & clase = clases [(bytes - 1) / alineacion];
+    assert (clase.ocupados > 0);
+    Hueco * hueco = static_cast <Hueco *> (objeto);
+    hueco->siguiente = clase.libre;
+    clase.libre = hueco;
+    clase.ocupados --;
+}
+
+
+void ReservaDibujos::agregaLosa (Clase & clase, size_t tamano) {
+    // La losa no se libera nunca; sus huecos pasan a la lista de huecos libres en orden, para que 
+    // los dibujables creados seguidos queden seguidos en memoria.
+    std::byte * losa = static_cast <std::byte *> (
+            ::operator new (tamano * objetosLosa, std::align_val_t {alineacion}));
+    for (int indc = objetosLosa - 1; indc >= 0; -- indc) {
+        Hueco * hueco = reinterpret_cast <Hueco *> (losa + indc * tamano);
+        hueco->siguiente = clase.libre;
+        clase.libre = hueco;
+    }
+    clase.losas ++;
+}
+
+
+void LoteDibujos::libera () {
+    for (auto iter = dibujos.rbegin (); iter != dibujos.rend (); ++ iter) {
+        delete * iter;
+    }
+    dibujos.clear ();
+}
+
+
+/// @endcond
@@ -0,0 +1,169 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: ReservaDibujos.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    class Dibujable;
+
+
+    /// @brief Memoria de las instancias de las clases derivadas de Dibujable.
+    /// @details Los dibujables se crean en losas de memoria contiguas, una serie de losas por cada
+    /// tamaño de objeto; en la práctica, una serie por cada clase de dibujable. Los huecos que dejan
+    /// los dibujables destruidos se reutilizan al crear otros del mismo tamaño, de modo que crear y
+    /// destruir dibujables repetidamente no usa la memoria dinámica general, y los dibujables de
+    /// una misma clase quedan próximos en memoria al recorrerlos para presentarlos.<p>
+    /// Los operadores 'new' y 'delete' de Dibujable usan esta clase; no es necesario llamarla
+    /// directamente. Las losas no se devuelven al sistema hasta el final de la ejecución.<p>
+    /// La clase no está protegida para su uso concurrente: los dibujables solo se pueden crear y 
+    /// destruir desde el hilo del bucle del juego, nunca desde una tarea de la clase Tareas.
+    class ReservaDibujos {
+    public:
+
+        /// @brief Número de objetos de cada losa.
+        static constexpr int objetosLosa = 64;
+
+        /// @brief Tamaño máximo de los objetos que se crean en las losas; los mayores se crean en 
+        /// la memoria dinámica general.
+        static constexpr size_t tamanoMaximo = 2048;
+
+        /// @brief Número de dibujables existentes creados en las losas.
+        /// @return Número de dibujables.
+        static int objetos ();
+
+        /// @brief Número de losas reservadas.
+        /// @return Número de losas.
+        static int losas ();
+
+        /// @brief Memoria ocupada por las losas reservadas, en bytes.
+        /// @return Bytes reservados.
+        static size_t bytesReservados ();
+
+    private:
+
+        // alineación y tamaño de los huecos de las losas
+        static constexpr size_t alineacion = 16;
+        static constexpr size_t cuentaClases = tamanoMaximo / alineacion;
+
+        struct Hueco {
+            Hueco * siguiente;
+        };
+
+        struct Clase {
+            Hueco * libre;
+            int     ocupados;
+            int     losas;
+        };
+
+        // El estado es trivialmente destructible; así, se pueden destruir dibujables durante la 
+        // destrucción de las variables estáticas.
+        inline static std::array <Clase, cuentaClases> clases {};
+
+        static void * reserva (size_t bytes);
+        static void devuelve (void * objeto, size_t bytes);
+        static void agregaLosa (Clase & clase, size_t tamano);
+
+        friend class Dibujable;
+
+    };
+
+
+    /// @brief Grupo de dibujables que se crean uno a uno y se destruyen todos juntos.
+    /// @details Las clases que presentan un grupo de dibujables crean cada uno con el método
+    /// 'crea' y los destruyen a la vez con el método 'libera', en el orden inverso al de creación.
+    /// Antes de llamar a 'libera', los dibujables deben estar extraídos de su actor.
+    class LoteDibujos {
+    public:
+
+        /// @brief Constructor por defecto.
+        LoteDibujos () = default;
+
+        /// @brief Destructor. Destruye los dibujables que queden en el lote.
+        ~LoteDibujos ();
+
+        // Impide la copia y el movimiento.
+        LoteDibujos (const LoteDibujos & ) = delete;
+        LoteDibujos (LoteDibujos && ) = delete;
+        LoteDibujos & operator = (const LoteDibujos & ) = delete;
+        LoteDibujos & operator = (LoteDibujos && ) = delete;
+
+        /// @brief Crea un dibujable en el lote.
+        /// @tparam T Clase del dibujable; derivada de Dibujable.
+        /// @param argumentos Argumentos del constructor del dibujable.
+        /// @return El dibujable creado.
+        template <typename T, typename... A>
+        T * crea (A &&... argumentos);
+
+        /// @brief Destruye todos los dibujables del lote.
+        void libera ();
+
+        /// @brief Número de dibujables del lote.
+        /// @return Número de dibujables.
+        size_t cuenta () const;
+
+    private:
+
+        std::vector <Dibujable *> dibujos {};
+
+    };
+
+
+    inline int ReservaDibujos::objetos () {
+        int cuenta = 0;
+        for (const Clase & clase : clases) {
+            cuenta += clase.ocupados;
+        }
+        return cuenta;
+    }
+
+    inline int ReservaDibujos::losas () {
+        int cuenta = 0;
+        for (const Clase & clase : clases) {
+            cuenta += clase.losas;
+        }
+        return cuenta;
+    }
+
+    inline size_t ReservaDibujos::bytesReservados () {
+        size_t bytes = 0;
+        for (size_t indc = 0; indc < cuentaClases; ++ indc) {
+            bytes += static_cast <size_t> (clases [indc].losas) * objetosLosa * (indc + 1) * alineacion;
+        }
+        return bytes;
+    }
+
+    inline LoteDibujos::~LoteDibujos () {
+        libera ();
+    }
+
+    template <typename T, typename... A>
+    inline T * LoteDibujos::crea (A &&... argumentos) {
+        static_assert (std::is_base_of_v <Dibujable, T>);
+        T * dibujo = new T (std::forward <A> (argumentos)...);
+        dibujos.push_back (dibujo);
+        return dibujo;
+    }
+
+    inline size_t LoteDibujos::cuenta () const {
+        return dibujos.size ();
+    }
+
+
+}
@@ -0,0 +1,237 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: Rutinas.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+
+#include "UNIR-2D.h"
+
+using namespace unir2d;
+
+
+/// @cond
+
+int64_t Rutinas::lanza (Rutina rutina) {
+    assert (rutina.mango && ! rutina.mango.done ());
+    Rutina::Mango mango = std::exchange (rutina.mango, nullptr);
+    int64_t id = ++ ultima_rutina;
+    mango.promise ().lanzada = id;
+    lanzadas.emplace (id, Lanzada {mango, false, false, false});
+    reanuda (mango, id);
+    return id;
+}
+
+
+void Rutinas::cancela (int64_t rutina) {
+    auto posicion = lanzadas.find (rutina);
+    if (posicion == lanzadas.end ()) {
+        return;
+    }
+    Lanzada & lanzada = posicion->second;
+    lanzada.cancelada = true;
+    // una corrutina en ejecución, o que espera una tarea, se destruye después
+    if (lanzada.ejecutando || lanzada.en_tarea) {
+        return;
+    }
+    lanzada.mango.destroy ();
+    lanzadas.erase (posicion);
+}
+
+
+int Rutinas::cuenta () {
+    int cuenta = 0;
+    for (const auto & [id, lanzada] : lanzadas) {
+        if (! lanzada.cancelada) {
+            cuenta ++;
+        }
+    }
+    return cuenta;
+}
+
+
+void Rutinas::Espera::await_suspend (Rutina::Mango mango) {
+    int64_t rutina = mango.promise ().lanzada;
+    if (segundos <= 0) {
+        ciclo_siguiente.push_back (Suspendida {mango, rutina});
+        return;
+    }
+    plazos.push_back (Plazo {m_ahora + segundos, ++ ultimo_orden, mango, rutina});
+    std::push_heap (plazos.begin (), plazos.end (), posterior);
+}
+
+
+void Rutinas::EsperaCondicion::await_suspend (Rutina::Mango mango) {
+    condiciones.push_back (Condicion {std::move (condicion), mango, mango.promise ().lanzada});
+}
+
+
+void Rutinas::EsperaTarea::await_suspend (Rutina::Mango mango) {
+    int64_t rutina = mango.promise ().lanzada;
+    assert (lanzadas.contains (rutina));
+    int tarea = Tareas::crea (nombre, std::move (funcion));
+    Tareas::alTerminar (tarea, avisoTarea (mango, tarea, error));
+    lanzadas [rutina].en_tarea = true;
+    Tareas::lanza (tarea);
+}
+
+
+void Rutinas::EsperaTarea::await_resume () const {
+    if (error) {
+        std::rethrow_exception (error);
+    }
+}
+
+
+bool Rutinas::EsperaLanzada::await_ready () {
+    if (! Tareas::terminada (tarea)) {
+        return false;
+    }
+    error = Tareas::extraeError (tarea);
+    return true;
+}
+
+
+void Rutinas::EsperaLanzada::await_suspend (Rutina::Mango mango) {
+    int64_t rutina = mango.promise ().lanzada;
+    assert (lanzadas.contains (rutina));
+    lanzadas [rutina].en_tarea = true;
+    Tareas::alTerminar (tarea, avisoTarea (mango, tarea, error));
+}
+
+
+void Rutinas::EsperaLanzada::await_resume () const {
+    if (error) {
+        std::rethrow_exception (error);
+    }
+}
+
+
+Tareas::Funcion Rutinas::avisoTarea (Rutina::Mango mango, int tarea, std::exception_ptr & error) {
+    // El aviso toma la excepción de la tarea antes de que Tareas la relance en el hilo del juego 
+    // y la deja en la espera, que está en el marco de la corrutina: el marco no se destruye 
+    // mientras la corrutina espera la tarea.
+    int64_t rutina = mango.promise ().lanzada;
+    std::coroutine_handle <> reanudable = mango;
+    return [reanudable, rutina, tarea, & error] () {
+        error = Tareas::extraeError (tarea);
+        terminaTarea (reanudable, rutina);
+    };
+}
+
+
+void Rutinas::reanuda (std::coroutine_handle <> mango, int64_t rutina) {
+    auto posicion = lanzadas.find (rutina);
+    if (posicion == lanzadas.end () || posicion->second.cancelada) {
+        return;
+    }
+    posicion->second.ejecutando = true;
+    mango.resume ();
+    //
+    // la corrutina puede haber lanzado otras, lo que invalida 'posicion'
+    posicion = lanzadas.find (rutina);
+    Lanzada & lanzada = posicion->second;
+    lanzada.ejecutando = false;
+    if (lanzada.cancelada) {
+        if (! lanzada.en_tarea) {
+            lanzada.mango.destroy ();
+            lanzadas.erase (posicion);
+        }
+        return;
+    }
+    if (! lanzada.mango.done ()) {
+        return;
+    }
+    std::exception_ptr error = lanzada.mango.promise ().error;
+    lanzada.mango.destroy ();
+    lanzadas.erase (posicion);
+    if (error) {
+        std::rethrow_exception (error);
+    }
+}
+
+
+void Rutinas::terminaTarea (std::coroutine_handle <> mango, int64_t rutina) {
+    auto posicion = lanzadas.find (rutina);
+    if (posicion == lanzadas.end ()) {
+        return;
+    }
+    posicion->second.en_tarea = false;
+    if (posicion->second.cancelada) {
+        posicion->second.mango.destroy ();
+        lanzadas.erase (posicion);
+        return;
+    }
+    // Los avisos se entregan antes de 'resuelve': la corrutina se reanuda en 'resuelve', con el 
+    // tiempo del ciclo ya actualizado.
+    ciclo_siguiente.push_back (Suspendida {mango, rutina});
+}
+
+
+bool Rutinas::posterior (const Plazo & plazo_1, const Plazo & plazo_2) {
+    if (plazo_1.momento != plazo_2.momento) {
+        return plazo_1.momento > plazo_2.momento;
+    }
+    return plazo_1.orden > plazo_2.orden;
+}
+
+
+void Rutinas::resuelve (double tiempo_seg) {
+    m_ahora = tiempo_seg;
+    //
+    // las que esperan en este ciclo pasan a esperar al siguiente
+    ciclo_en_curso.swap (ciclo_siguiente);
+    for (const Suspendida & suspendida : ciclo_en_curso) {
+        reanuda (suspendida.mango, suspendida.rutina);
+    }
+    ciclo_en_curso.clear ();
+    //
+    // los plazos nuevos terminan después de 'm_ahora', de modo que el bucle termina
+    while (! plazos.empty () && plazos.front ().momento <= m_ahora) {
+        std::pop_heap (plazos.begin (), plazos.end (), posterior);
+        Plazo plazo = plazos.back ();
+        plazos.pop_back ();
+        reanuda (plazo.mango, plazo.rutina);
+    }
+    //
+    condiciones_en_curso.swap (condiciones);
+    for (Condicion & condicion : condiciones_en_curso) {
+        if (! activa (condicion.rutina)) {
+            continue;
+        }
+        if (condicion.condicion ()) {
+            reanuda (condicion.mango, condicion.rutina);
+        } else {
+            condiciones.push_back (std::move (condicion));
+        }
+    }
+    condiciones_en_curso.clear ();
+}
+
+
+void Rutinas::vacia () {
+    std::unordered_map <int64_t, Lanzada> destruidas {};
+    destruidas.swap (lanzadas);
+    for (auto & [id, lanzada] : destruidas) {
+        lanzada.mango.destroy ();
+    }
+    ciclo_siguiente.clear ();
+    ciclo_en_curso.clear ();
+    plazos.clear ();
+    condiciones.clear ();
+    condiciones_en_curso.clear ();
+}
+
+/// @endcond
@@ -0,0 +1,379 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: Rutinas.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    /// @brief Corrutina del juego.
+    /// @details Una función que devuelve Rutina y usa 'co_await' es una corrutina: se suspende en 
+    /// cada 'co_await' y continúa cuando se cumple lo esperado, conservando sus variables locales. 
+    /// Así, una secuencia que dura varios ciclos (una animación, una espera, un diálogo) se escribe 
+    /// como código lineal, en lugar de como un estado que se consulta en cada ciclo.<p>
+    /// La corrutina no empieza al llamar a la función. Empieza al entregarla a Rutinas#lanza, 
+    /// que la ejecuta hasta su primera suspensión y la reanuda después en el hilo del juego, o al 
+    /// esperarla con 'co_await' desde otra corrutina, que continúa cuando la esperada termina.<p>
+    /// Las esperas disponibles son Rutinas#siguienteCiclo, Rutinas#espera, Rutinas#esperaTecla, 
+    /// Rutinas#esperaBoton, Rutinas#esperaQue, Rutinas#ejecuta y Rutinas#esperaTarea.
+    class Rutina {
+    public:
+
+        /// @cond
+        struct promise_type;
+        using Mango = std::coroutine_handle <promise_type>;
+
+        struct FinalRutina {
+            bool await_ready () const noexcept { return false; }
+            std::coroutine_handle <> await_suspend (Mango mango) noexcept;
+            void await_resume () const noexcept {}
+        };
+
+        struct promise_type {
+            // corrutina que espera a esta, si hay alguna
+            std::coroutine_handle <> continuacion {};
+            // identificador de la corrutina lanzada de la que depende esta
+            int64_t lanzada {};
+            std::exception_ptr error {};
+
+            Rutina get_return_object () { return Rutina {Mango::from_promise (* this)}; }
+            std::suspend_always initial_suspend () const noexcept { return {}; }
+            FinalRutina final_suspend () const noexcept { return {}; }
+            void return_void () const {}
+            void unhandled_exception () { error = std::current_exception (); }
+        };
+        /// @endcond
+
+        /// @brief Constructor de movimiento.
+        Rutina (Rutina && otra) noexcept;
+
+        /// @brief Asignación de movimiento.
+        Rutina & operator = (Rutina && otra) noexcept;
+
+        /// @brief Destructor. Destruye la corrutina si no se ha lanzado.
+        ~Rutina ();
+
+        /// @cond
+        bool await_ready () const noexcept;
+        std::coroutine_handle <> await_suspend (Mango llamante) noexcept;
+        void await_resume ();
+        /// @endcond
+
+    private:
+
+        Mango mango {};
+
+        explicit Rutina (Mango mango);
+
+        Rutina (const Rutina & )              = delete;
+        Rutina & operator = (const Rutina & ) = delete;
+
+        friend class Rutinas;
+
+    };
+
+
+    /// @brief Planificador de las corrutinas del juego (véase Rutina).
+    /// @details La clase Motor reanuda las corrutinas al comienzo de la actualización de cada 
+    /// ciclo, antes de JuegoBase#preactualiza, y destruye las que quedan al terminar el juego, 
+    /// antes de JuegoBase#termina.<p>
+    /// Una corrutina suspendida no tiene coste en cada ciclo mientras espera un plazo o una tarea. 
+    /// Las esperas de una condición, de una tecla o de un botón consultan la condición una vez en 
+    /// cada ciclo.<p>
+    /// Si una corrutina lanza una excepción que no recoge, la excepción sale de Rutinas#lanza o 
+    /// de la actualización del ciclo en la que se reanudó.
+    class Rutinas {
+    public:
+
+        /// @cond
+        struct Espera {
+            bool await_ready () const noexcept;
+            void await_suspend (Rutina::Mango mango);
+            void await_resume () const noexcept {}
+            double segundos;
+        };
+
+        struct EsperaCondicion {
+            bool await_ready () const;
+            void await_suspend (Rutina::Mango mango);
+            void await_resume () const noexcept {}
+            std::function <bool ()> condicion;
+        };
+
+        struct EsperaTarea {
+            bool await_ready () const noexcept { return false; }
+            void await_suspend (Rutina::Mango mango);
+            void await_resume () const;
+            const char * nombre;
+            std::function <void ()> funcion;
+            std::exception_ptr error {};
+        };
+
+        struct EsperaLanzada {
+            bool await_ready ();
+            void await_suspend (Rutina::Mango mango);
+            void await_resume () const;
+            int tarea;
+            std::exception_ptr error {};
+        };
+        /// @endcond
+
+        /// @brief Entrega una corrutina al planificador y la ejecuta hasta su primera suspensión.
+        /// @param rutina Corrutina que se lanza.
+        /// @return Identificador de la corrutina.
+        static int64_t lanza (Rutina rutina);
+
+        /// @brief Destruye una corrutina lanzada, con las que está esperando.
+        /// @details Si la corrutina espera una tarea de Rutinas#ejecuta, se destruye cuando termina 
+        /// la tarea, sin reanudarla. Si la corrutina ya ha terminado, no tiene efecto.
+        /// @param rutina Identificador de la corrutina.
+        static void cancela (int64_t rutina);
+
+        /// @brief Indica si una corrutina lanzada no ha terminado ni se ha cancelado.
+        /// @param rutina Identificador de la corrutina.
+        /// @return Si la corrutina está activa.
+        static bool activa (int64_t rutina);
+
+        /// @brief Número de corrutinas lanzadas activas.
+        /// @return Número de corrutinas.
+        static int cuenta ();
+
+        /// @brief Tiempo del ciclo en curso, en segundos desde el inicio del juego.
+        /// @details Es el valor que reciben los métodos 'actualiza' de los actores en el ciclo.
+        /// @return Tiempo en segundos.
+        static double ahora ();
+
+        /// @brief Espera hasta el ciclo siguiente.
+        /// @return Objeto que se usa con 'co_await'.
+        static Espera siguienteCiclo ();
+
+        /// @brief Espera un número de segundos.
+        /// @details La corrutina se reanuda en el primer ciclo cuyo tiempo alcanza el plazo.
+        /// @param segundos Segundos de espera.
+        /// @return Objeto que se usa con 'co_await'.
+        static Espera espera (double segundos);
+
+        /// @brief Espera hasta que se cumpla una condición, que se consulta una vez por ciclo.
+        /// @details Si la condición ya se cumple, no hay suspensión.
+        /// @param condicion Condición esperada.
+        /// @return Objeto que se usa con 'co_await'.
+        static EsperaCondicion esperaQue (std::function <bool ()> condicion);
+
+        /// @brief Espera hasta que se pulse una tecla.
+        /// @param tecla Tecla esperada.
+        /// @return Objeto que se usa con 'co_await'.
+        static EsperaCondicion esperaTecla (Tecla tecla);
+
+        /// @brief Espera hasta que se pulse un botón del ratón.
+        /// @param boton Botón esperado.
+        /// @return Objeto que se usa con 'co_await'.
+        static EsperaCondicion esperaBoton (BotonRaton boton);
+
+        /// @brief Ejecuta una función en una tarea (véase Tareas) y espera a que termine.
+        /// @details La corrutina se reanuda en el ciclo siguiente a la terminación de la tarea, 
+        /// con el aviso de la tarea, sin consultarla en cada ciclo. Si la función lanza una 
+        /// excepción, la excepción se vuelve a lanzar en el 'co_await'.
+        /// @param nombre Nombre de la tarea, para el perfil. Debe ser una cadena constante.
+        /// @param funcion Trabajo de la tarea.
+        /// @return Objeto que se usa con 'co_await'.
+        static EsperaTarea ejecuta (const char * nombre, std::function <void ()> funcion);
+
+        /// @brief Espera a que termine una tarea lanzada con Tareas.
+        /// @details La corrutina continúa en el ciclo en que se entrega el aviso de la tarea (véase 
+        /// Tareas#alTerminar), sin consultarla en cada ciclo. Si la tarea ya tiene un aviso, se 
+        /// ejecuta antes. Si la tarea ha lanzado una excepción que no se ha relanzado aún, la 
+        /// excepción se vuelve a lanzar en el 'co_await'.
+        /// @param tarea Identificador de la tarea.
+        /// @return Objeto que se usa con 'co_await'.
+        static EsperaLanzada esperaTarea (int tarea);
+
+    private:
+
+        struct Lanzada {
+            Rutina::Mango mango;
+            bool          ejecutando;
+            bool          en_tarea;
+            bool          cancelada;
+        };
+
+        struct Suspendida {
+            std::coroutine_handle <> mango;
+            int64_t                  rutina;
+        };
+
+        struct Plazo {
+            double                   momento;
+            int64_t                  orden;
+            std::coroutine_handle <> mango;
+            int64_t                  rutina;
+        };
+
+        struct Condicion {
+            std::function <bool ()>  condicion;
+            std::coroutine_handle <> mango;
+            int64_t                  rutina;
+        };
+
+        inline static std::unordered_map <int64_t, Lanzada> lanzadas {};
+        inline static int64_t ultima_rutina {};
+        inline static double  m_ahora {};
+
+        inline static std::vector <Suspendida> ciclo_siguiente {};
+        inline static std::vector <Suspendida> ciclo_en_curso {};
+        // montículo por momento y orden de llegada
+        inline static std::vector <Plazo>      plazos {};
+        inline static int64_t                  ultimo_orden {};
+        inline static std::vector <Condicion>  condiciones {};
+        inline static std::vector <Condicion>  condiciones_en_curso {};
+
+        static void reanuda (std::coroutine_handle <> mango, int64_t rutina);
+        static Tareas::Funcion avisoTarea (Rutina::Mango mango, int tarea, std::exception_ptr & error);
+        static void terminaTarea (std::coroutine_handle <> mango, int64_t rutina);
+        static bool posterior (const Plazo & plazo_1, const Plazo & plazo_2);
+
+        static void resuelve (double tiempo_seg);
+        static void vacia ();
+
+        friend class Motor;
+
+    };
+
+
+    inline Rutina::Rutina (Mango mango) {
+        this->mango = mango;
+    }
+
+    inline Rutina::Rutina (Rutina && otra) noexcept {
+        mango = std::exchange (otra.mango, nullptr);
+    }
+
+    inline Rutina & Rutina::operator = (Rutina && otra) noexcept {
+        if (this != & otra) {
+            if (mango) {
+                mango.destroy ();
+            }
+            mango = std::exchange (otra.mango, nullptr);
+        }
+        return * this;
+    }
+
+    inline Rutina::~Rutina () {
+        if (mango) {
+            mango.destroy ();
+        }
+    }
+
+    inline std::coroutine_handle <> Rutina::FinalRutina::await_suspend (Mango mango) noexcept {
+        std::coroutine_handle <> continuacion = mango.promise ().continuacion;
+        if (continuacion) {
+            return continuacion;
+        }
+        return std::noop_coroutine ();
+    }
+
+    inline bool Rutina::await_ready () const noexcept {
+        return ! mango || mango.done ();
+    }
+
+    inline std::coroutine_handle <> Rutina::await_suspend (Mango llamante) noexcept {
+        // la esperada empieza ahora y, al terminar, continúa la que espera
+        mango.promise ().continuacion = llamante;
+        mango.promise ().lanzada = llamante.promise ().lanzada;
+        return mango;
+    }
+
+    inline void Rutina::await_resume () {
+        if (mango && mango.promise ().error) {
+            std::rethrow_exception (mango.promise ().error);
+        }
+    }
+
+    inline bool Rutinas::activa (int64_t rutina) {
+        auto posicion = lanzadas.find (rutina);
+        return posicion != lanzadas.end () && ! posicion->second.cancelada;
+    }
+
+    inline double Rutinas::ahora () {
+        return m_ahora;
+    }
+
+    inline Rutinas::Espera Rutinas::siguienteCiclo () {
+        return Espera {0.0};
+    }
+
+    inline Rutinas::Espera Rutinas::espera (double segundos) {
+        return Espera {std::max (segundos, 0.0)};
+    }
+
+    inline Rutinas::EsperaCondicion Rutinas::esperaQue (std::function <bool ()> condicion) {
+        assert (condicion);
+        return EsperaCondicion {std::move (condicion)};
+    }
+
+    inline Rutinas::EsperaCondicion Rutinas::esperaTecla (Tecla tecla) {
+        return EsperaCondicion {[tecla] () { return Teclado::recienPulsada (tecla); }};
+    }
+
+    inline Rutinas::EsperaCondicion Rutinas::esperaBoton (BotonRaton boton) {
+        return EsperaCondicion {[boton] () { return Raton::recienPulsado (boton); }};
+    }
+
+    inline Rutinas::EsperaTarea Rutinas::ejecuta (const char * nombre, std::function <void ()> funcion) {
+        assert (funcion);
+        return EsperaTarea {nombre, std::move (funcion)};
+    }
+
+    inline Rutinas::EsperaLanzada Rutinas::esperaTarea (int tarea) {
+        return EsperaLanzada {tarea};
+    }
+
+    inline bool Rutinas::Espera::await_ready () const noexcept {
+        return false;
+    }
+
+    inline bool Rutinas::EsperaCondicion::await_ready () const {
+        return condicion ();
+    }
+
+
+}
+
+
+/// @class unir2d::Rutina
+/// 
+/// Ejemplo de uso:
+/// @code
+/// Rutina JuegoNaves::presentaNivel (int nivel) {
+///     rotulo.ponTexto ("Nivel " + std::to_string (nivel));
+///     rotulo.ponVisible (true);
+///     co_await Rutinas::espera (2.0);
+///     rotulo.ponVisible (false);
+///     // el mapa se prepara en otro hilo mientras se presenta el juego
+///     co_await Rutinas::ejecuta ("mapa", [this, nivel] { mapa.genera (nivel); });
+///     for (int paso = 0; paso < 60; paso ++) {
+///         fondo.ponPosicion (fondo.posicion () + Vector {0, 4});
+///         co_await Rutinas::siguienteCiclo ();
+///     }
+///     co_await Rutinas::esperaTecla (Tecla::espacio);
+///     empiezaNivel ();
+/// }
+/// 
+/// void JuegoNaves::inicia () {
+///     Rutinas::lanza (presentaNivel (1));
+/// }
+/// @endcode
@@ -21,12 +21,22 @@ using namespace unir2d;
 
 
 void Sonido::carga (path archivo) {
-    es_sonido = true;
-    bool bien = sound_buffer.loadFromFile (archivo.string ().c_str ());
-    if (! bien) {
-        throw std::runtime_error {"archivo de carga de Sonido no encontrado: " + archivo.string ()};
+    int carga = Audio::carga (archivo);
+    if (carga_audio >= 0) {
+        Audio::descarga (carga_audio);
     }
-    sound.setBuffer (sound_buffer);
+    carga_audio = carga;
+    es_sonido = true;
+}
+
+
+int Sonido::prioridad () {
+    return prioridad_sonido;
+}
+
+
+void Sonido::ponPrioridad (int valor) {
+    prioridad_sonido = valor;
 }
 
 
@@ -36,12 +46,13 @@ void Sonido::abre (path archivo) {
     if (! bien) {
         throw std::runtime_error {"archivo de carga de Sonido no encontrado: " + archivo.string ()};
     }
+    RegistroRecursos::registra (this, RegistroRecursos::recursoFlujo (music, archivo.string ()));
 }
 
 
 int Sonido::volumen () {
     if (es_sonido) {
-        return static_cast <int> (sound.getVolume ());
+        return volumen_sonido;
     }
     if (es_musica) {
         return static_cast <int> (music.getVolume ());
@@ -52,7 +63,7 @@ int Sonido::volumen () {
         
 void Sonido::ponVolumen (int valor) {
     if (es_sonido) {
-        sound.setVolume (static_cast <float> (valor));
+        volumen_sonido = valor;
     }
     if (es_musica) {
         music.setVolume (static_cast <float> (valor));
@@ -70,7 +81,7 @@ bool Sonido::sonando () {
 
 void Sonido::suena () {
     if (es_sonido) {
-        sound.play ();
+        Audio::suena (carga_audio, volumen_sonido, prioridad_sonido);
     }
     if (es_musica) {
         music.play ();
@@ -80,7 +91,7 @@ void Sonido::suena () {
 
 void Sonido::para () {
     if (es_sonido) {
-        sound.stop ();
+        Audio::para (carga_audio);
     }
     if (es_musica) {
         music.stop ();
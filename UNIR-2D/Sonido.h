@@ -27,7 +27,10 @@ namespace unir2d {
     /// @brief Reproduce sonidos y musica mientras se ejecuta el proyecto.
     /// @details El sonido se toma de un archivo externo. Solo es posible usar un archivo en cada 
     /// instancia, sin embargo, se pueden usar varias instancias para reproducir varios sonidos 
-    /// simultaneamente.
+    /// simultaneamente.<p>
+    /// Los sonidos almacenados en memoria (véase carga()) se reproducen con las voces de la clase 
+    /// Audio: varias instancias del mismo archivo comparten los datos decodificados y cada llamada 
+    /// a suena() inicia una reproducción que se superpone a las anteriores.
     class Sonido  {
     public: 
 
@@ -43,6 +46,16 @@ namespace unir2d {
         /// @param archivo Archivo de sonido.
         void carga (path archivo);
 
+        /// @brief Obtiene la prioridad de las reproducciones del sonido.
+        /// @details Solo se usa con los sonidos almacenados en memoria (véase Audio::suena).
+        /// @return Prioridad del sonido.
+        int prioridad ();
+
+        /// @brief Establece la prioridad de las reproducciones del sonido.
+        /// @details Solo se usa con los sonidos almacenados en memoria (véase Audio::suena).
+        /// @param valor Prioridad del sonido.
+        void ponPrioridad (int valor);
+
         /// @brief Abre un archivo de sonido que no se almacena en la memoria.
         /// @details No se pueden cargar archivos de tipo mp3. Este método se usa para sonidos de 
         /// mayor duración. Para cargar archivos de sonido de corta duración se usa el método 
@@ -63,10 +76,14 @@ namespace unir2d {
         bool sonando ();
 
         /// @brief Inicia la reproducción del sonido.
-        /// @details El archivo debe estar establecido con el método carga() o el método graba().
+        /// @details El archivo debe estar establecido con el método carga() o el método graba(). 
+        /// Con un sonido almacenado en memoria, se inicia una nueva reproducción sin detener las 
+        /// anteriores.
         void suena ();
 
         /// @brief Detiene la reproducción del sonido.
+        /// @details Con un sonido almacenado en memoria, detiene todas las reproducciones del 
+        /// archivo.
         void para ();
 
         // @brief Reinicia la reproducción del sonido.
@@ -76,8 +93,9 @@ namespace unir2d {
 
         bool            es_sonido {};
         bool            es_musica {};
-        sf::SoundBuffer sound_buffer {};
-        sf::Sound       sound {};
+        int             carga_audio {-1};
+        int             volumen_sonido {100};
+        int             prioridad_sonido {};
         sf::Music       music {};
 
         inline static int cuenta_instancias {};
@@ -89,6 +107,7 @@ namespace unir2d {
         Sonido & operator = (Sonido && )      = delete;
 
         friend class JuegoBase;
+        friend class PanelRendimiento;
 
     };
 
@@ -99,6 +118,12 @@ namespace unir2d {
 
 
     inline Sonido::~Sonido () {
+        if (carga_audio >= 0) {
+            Audio::descarga (carga_audio);
+        }
+        if (es_musica) {
+            RegistroRecursos::retira (this);
+        }
         cuenta_instancias --;
     }
 
@@ -0,0 +1,492 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: Tareas.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+
+#include "UNIR-2D.h"
+
+using namespace unir2d;
+
+
+/// @cond
+
+
+void Tareas::arranca (int hilos) {
+    assert (tareas == nullptr);
+    assert (hilos >= 1 && hilos <= maximoHilos);
+    tareas = new Tarea [capacidadTareas];
+    colas  = new Cola  [hilos];
+    libres.clear ();
+    for (int indice = capacidadTareas - 1; indice >= 0; -- indice) {
+        libres.push_back (indice);
+    }
+    encoladas = 0;
+    activas   = 0;
+    parando   = false;
+    cuenta_ejecutadas = 0;
+    cuenta_robadas    = 0;
+    total_hilos = hilos;
+    for (int hilo = 0; hilo < hilos; ++ hilo) {
+        hilos_tareas.emplace_back (trabaja, hilo);
+    }
+}
+
+
+void Tareas::para () {
+    if (tareas == nullptr) {
+        return;
+    }
+    //
+    // Se terminan las tareas encoladas y las que se están ejecutando, con las sucesoras que 
+    // encolan. Las tareas no lanzadas, y las que esperan a alguna de ellas, no se ejecutan.
+    while (encoladas.load () > 0 || activas.load () > 0) {
+        if (! ayuda ()) {
+            std::this_thread::yield ();
+        }
+    }
+    {
+        std::lock_guard <std::mutex> bloqueo {cerrojo_espera};
+        parando = true;
+    }
+    despierta.notify_all ();
+    for (std::thread & hilo : hilos_tareas) {
+        hilo.join ();
+    }
+    hilos_tareas.clear ();
+    //
+    // Los avisos no entregados y los errores no relanzados se descartan.
+    avisos.clear ();
+    avisos_entrega.clear ();
+    avisos_sueltos.clear ();
+    sueltos_entrega.clear ();
+    hay_avisos = false;
+    errores.clear ();
+    hay_error = false;
+    delete [] colas;
+    delete [] tareas;
+    colas  = nullptr;
+    tareas = nullptr;
+    total_hilos = 0;
+}
+
+
+Tareas::Tarea & Tareas::localiza (int tarea, int & indice) {
+    assert (tareas != nullptr && tarea > 0);
+    indice = tarea % capacidadTareas;
+    return tareas [indice];
+}
+
+
+int Tareas::crea (const char * nombre, Funcion funcion) {
+    if (tareas == nullptr) {
+        throw std::runtime_error {"El servicio de tareas no está arrancado."};
+    }
+    int indice;
+    {
+        std::lock_guard <std::mutex> bloqueo {cerrojo_libres};
+        if (libres.empty ()) {
+            throw std::runtime_error {"Demasiadas tareas sin terminar."};
+        }
+        indice = libres.back ();
+        libres.pop_back ();
+    }
+    Tarea & tarea = tareas [indice];
+    std::lock_guard <std::mutex> bloqueo {tarea.cerrojo};
+    tarea.estado     = Estado::creada;
+    tarea.pendientes = 1;
+    tarea.nombre     = nombre;
+    tarea.funcion    = std::move (funcion);
+    return tarea.generacion * capacidadTareas + indice;
+}
+
+
+void Tareas::dependeDe (int tarea, int previa) {
+    int indice;
+    Tarea & datos = localiza (tarea, indice);
+    assert (datos.generacion == tarea / capacidadTareas && datos.estado == Estado::creada);
+    int indice_previa;
+    Tarea & datos_previa = localiza (previa, indice_previa);
+    std::lock_guard <std::mutex> bloqueo {datos_previa.cerrojo};
+    if (datos_previa.generacion != previa / capacidadTareas || 
+            datos_previa.estado == Estado::terminada) {
+        return;
+    }
+    datos_previa.sucesoras.push_back (indice);
+    datos.pendientes ++;
+}
+
+
+void Tareas::alTerminar (int tarea, Funcion aviso) {
+    int indice;
+    Tarea & datos = localiza (tarea, indice);
+    {
+        std::lock_guard <std::mutex> bloqueo {datos.cerrojo};
+        if (datos.generacion == tarea / capacidadTareas && datos.estado != Estado::libre) {
+            // una tarea terminada sigue sin liberar mientras tiene el aviso pendiente de entrega
+            assert (datos.estado != Estado::terminada || datos.aviso);
+            if (datos.aviso) {
+                datos.aviso = [previo = std::move (datos.aviso), nuevo = std::move (aviso)] () {
+                    previo ();
+                    nuevo ();
+                };
+            } else {
+                datos.aviso = std::move (aviso);
+            }
+            return;
+        }
+    }
+    // la tarea ya ha terminado y se ha liberado: el aviso se entrega al comienzo del ciclo 
+    // siguiente
+    std::lock_guard <std::mutex> bloqueo_avisos {cerrojo_avisos};
+    avisos_sueltos.push_back (std::move (aviso));
+    hay_avisos = true;
+}
+
+
+void Tareas::lanza (int tarea) {
+    int indice;
+    Tarea & datos = localiza (tarea, indice);
+    {
+        std::lock_guard <std::mutex> bloqueo {datos.cerrojo};
+        assert (datos.generacion == tarea / capacidadTareas && datos.estado == Estado::creada);
+        datos.estado = Estado::lanzada;
+    }
+    // 'pendientes' empieza en 1; si no quedan tareas previas por terminar, se encola ya
+    if (datos.pendientes.fetch_sub (1) == 1) {
+        encola (indice);
+    }
+}
+
+
+int Tareas::ejecuta (const char * nombre, Funcion funcion) {
+    int tarea = crea (nombre, std::move (funcion));
+    lanza (tarea);
+    return tarea;
+}
+
+
+int Tareas::continua (int previa, const char * nombre, Funcion funcion) {
+    int tarea = crea (nombre, std::move (funcion));
+    dependeDe (tarea, previa);
+    lanza (tarea);
+    return tarea;
+}
+
+
+bool Tareas::terminada (int tarea) {
+    int indice;
+    Tarea & datos = localiza (tarea, indice);
+    std::lock_guard <std::mutex> bloqueo {datos.cerrojo};
+    return datos.generacion != tarea / capacidadTareas || datos.estado == Estado::terminada;
+}
+
+
+void Tareas::espera (int tarea) {
+    while (! terminada (tarea)) {
+        if (! ayuda ()) {
+            std::this_thread::yield ();
+        }
+    }
+    std::exception_ptr excepcion = extraeError (tarea);
+    if (excepcion) {
+        std::rethrow_exception (excepcion);
+    }
+}
+
+
+void Tareas::paraCada (int inicio, int fin, int lote, const std::function <void (int desde, int hasta)> & funcion) {
+    assert (lote > 0);
+    if (fin <= inicio) {
+        return;
+    }
+    //
+    // Los ayudantes y el hilo que llama toman lotes hasta agotarlos. Hay que esperar a todos los 
+    // ayudantes, aunque no lleguen a tomar ningún lote, porque usan 'reparto'. La función de los 
+    // ayudantes solo captura un puntero, para que quepa en std::function sin reservar memoria.
+    struct Reparto {
+        std::atomic <int> siguiente;
+        int fin;
+        int lote;
+        const std::function <void (int desde, int hasta)> * funcion;
+    };
+    Reparto reparto {inicio, fin, lote, &funcion};
+    auto reparte = [datos = &reparto] () {
+        while (true) {
+            int desde = datos->siguiente.fetch_add (datos->lote);
+            if (desde >= datos->fin) {
+                return;
+            }
+            (* datos->funcion) (desde, std::min (desde + datos->lote, datos->fin));
+        }
+    };
+    int lotes = (fin - inicio - 1) / lote + 1;
+    int total_ayudantes = std::min (lotes - 1, total_hilos);
+    std::array <int, maximoHilos> ayudantes;
+    for (int indc = 0; indc < total_ayudantes; ++ indc) {
+        ayudantes [indc] = ejecuta ("paraCada", reparte);
+    }
+    std::exception_ptr excepcion {};
+    try {
+        reparte ();
+    } catch (...) {
+        excepcion = std::current_exception ();
+    }
+    // solo se relanzan las excepciones de los ayudantes; las de otras tareas siguen guardadas
+    for (int indc = 0; indc < total_ayudantes; ++ indc) {
+        while (! terminada (ayudantes [indc])) {
+            if (! ayuda ()) {
+                std::this_thread::yield ();
+            }
+        }
+        std::exception_ptr excepcion_ayudante = extraeError (ayudantes [indc]);
+        if (! excepcion) {
+            excepcion = excepcion_ayudante;
+        }
+    }
+    if (excepcion) {
+        std::rethrow_exception (excepcion);
+    }
+}
+
+
+void Tareas::ponPerfil (Perfil perfil) {
+    Tareas::perfil = std::move (perfil);
+}
+
+
+void Tareas::encola (int indice) {
+    int cola = hilo_actual >= 0 ? hilo_actual : static_cast <int> (siguiente_cola.fetch_add (1) % total_hilos);
+    {
+        std::lock_guard <std::mutex> bloqueo {colas [cola].cerrojo};
+        colas [cola].tareas.push_back (indice);
+    }
+    encoladas ++;
+    {
+        // sin este bloqueo, el aviso se puede perder entre la comprobación y la espera de un hilo
+        std::lock_guard <std::mutex> bloqueo {cerrojo_espera};
+    }
+    despierta.notify_one ();
+}
+
+
+bool Tareas::toma (int hilo, int & indice) {
+    if (encoladas.load () == 0) {
+        return false;
+    }
+    //
+    // La última tarea de la cola propia es la más reciente, probablemente con sus datos aún en la 
+    // caché.
+    if (hilo >= 0) {
+        Cola & cola = colas [hilo];
+        std::lock_guard <std::mutex> bloqueo {cola.cerrojo};
+        if (! cola.tareas.empty ()) {
+            indice = cola.tareas.back ();
+            cola.tareas.pop_back ();
+            // 'activas' aumenta antes de que disminuya 'encoladas', para que 'para' no las vea a 
+            // ambas a cero mientras se ejecuta la tarea
+            activas ++;
+            encoladas --;
+            return true;
+        }
+    }
+    //
+    // Se roba la tarea más antigua de la cola de otro hilo.
+    int primera = hilo >= 0 ? hilo + 1 : 0;
+    for (int paso = 0; paso < total_hilos; ++ paso) {
+        int victima = (primera + paso) % total_hilos;
+        if (victima == hilo) {
+            continue;
+        }
+        Cola & cola = colas [victima];
+        std::lock_guard <std::mutex> bloqueo {cola.cerrojo};
+        if (! cola.tareas.empty ()) {
+            indice = cola.tareas.front ();
+            cola.tareas.pop_front ();
+            activas ++;
+            encoladas --;
+            cuenta_robadas ++;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+bool Tareas::ayuda () {
+    int indice;
+    if (! toma (hilo_actual, indice)) {
+        return false;
+    }
+    completa (indice);
+    return true;
+}
+
+
+void Tareas::completa (int indice) {
+    Tarea & tarea = tareas [indice];
+    //
+    auto inicio = std::chrono::steady_clock::now ();
+    try {
+        tarea.funcion ();
+    } catch (...) {
+        // la generación no cambia hasta que se libera la tarea, más abajo
+        guardaError (tarea.generacion * capacidadTareas + indice, std::current_exception ());
+    }
+    if (perfil) {
+        long micrseg = (long)std::chrono::duration_cast <std::chrono::microseconds> (
+                std::chrono::steady_clock::now () - inicio).count ();
+        perfil (tarea.nombre, hilo_actual, micrseg);
+    }
+    // libera lo capturado por la función sin esperar a que se reutilice la tarea
+    tarea.funcion = nullptr;
+    cuenta_ejecutadas ++;
+    //
+    // Se encolan las sucesoras que ya no esperan a ninguna otra tarea. La tarea se libera, salvo 
+    // que tenga un aviso, que la libera al entregarse.
+    {
+        std::lock_guard <std::mutex> bloqueo {tarea.cerrojo};
+        tarea.estado = Estado::terminada;
+        for (int sucesora : tarea.sucesoras) {
+            if (tareas [sucesora].pendientes.fetch_sub (1) == 1) {
+                encola (sucesora);
+            }
+        }
+        tarea.sucesoras.clear ();
+        if (tarea.aviso) {
+            std::lock_guard <std::mutex> bloqueo_avisos {cerrojo_avisos};
+            avisos.push_back (indice);
+            hay_avisos = true;
+        } else {
+            libera (tarea, indice);
+        }
+    }
+    activas --;
+}
+
+
+void Tareas::libera (Tarea & tarea, int indice) {
+    // se llama con 'tarea.cerrojo' bloqueado
+    tarea.estado = Estado::libre;
+    tarea.generacion ++;
+    if (tarea.generacion > std::numeric_limits <int>::max () / capacidadTareas - 1) {
+        tarea.generacion = 1;
+    }
+    std::lock_guard <std::mutex> bloqueo {cerrojo_libres};
+    libres.push_back (indice);
+}
+
+
+void Tareas::trabaja (int hilo) {
+    hilo_actual = hilo;
+    while (true) {
+        int indice;
+        if (toma (hilo, indice)) {
+            completa (indice);
+            continue;
+        }
+        std::unique_lock <std::mutex> bloqueo {cerrojo_espera};
+        despierta.wait (bloqueo, [] () { return encoladas.load () > 0 || parando; });
+        if (parando && encoladas.load () == 0) {
+            return;
+        }
+    }
+}
+
+
+void Tareas::entregaAvisos () {
+    // sin avisos ni errores, el coste en el bucle del juego es la lectura de 'hay_avisos' y 
+    // 'hay_error'
+    if (hay_avisos) {
+        {
+            std::lock_guard <std::mutex> bloqueo {cerrojo_avisos};
+            avisos_entrega.swap (avisos);
+            sueltos_entrega.swap (avisos_sueltos);
+            hay_avisos = false;
+        }
+        // la excepción de un aviso no impide entregar los demás
+        for (int indice : avisos_entrega) {
+            Tarea & tarea = tareas [indice];
+            Funcion aviso {};
+            {
+                std::lock_guard <std::mutex> bloqueo {tarea.cerrojo};
+                aviso = std::move (tarea.aviso);
+                tarea.aviso = nullptr;
+                libera (tarea, indice);
+            }
+            try {
+                aviso ();
+            } catch (...) {
+                guardaError (0, std::current_exception ());
+            }
+        }
+        avisos_entrega.clear ();
+        for (Funcion & aviso : sueltos_entrega) {
+            try {
+                aviso ();
+            } catch (...) {
+                guardaError (0, std::current_exception ());
+            }
+        }
+        sueltos_entrega.clear ();
+    }
+    relanzaError ();
+}
+
+
+void Tareas::guardaError (int tarea, std::exception_ptr excepcion) {
+    std::lock_guard <std::mutex> bloqueo {cerrojo_error};
+    errores.push_back ({tarea, std::move (excepcion)});
+    hay_error = true;
+}
+
+
+std::exception_ptr Tareas::extraeError (int tarea) {
+    if (! hay_error) {
+        return nullptr;
+    }
+    std::lock_guard <std::mutex> bloqueo {cerrojo_error};
+    for (auto iter = errores.begin (); iter != errores.end (); ++ iter) {
+        if (iter->tarea == tarea) {
+            std::exception_ptr excepcion = std::move (iter->excepcion);
+            errores.erase (iter);
+            hay_error = ! errores.empty ();
+            return excepcion;
+        }
+    }
+    return nullptr;
+}
+
+
+void Tareas::relanzaError () {
+    if (! hay_error) {
+        return;
+    }
+    std::exception_ptr relanzado {};
+    {
+        std::lock_guard <std::mutex> bloqueo {cerrojo_error};
+        if (errores.empty ()) {
+            return;
+        }
+        relanzado = std::move (errores.front ().excepcion);
+        errores.pop_front ();
+        hay_error = ! errores.empty ();
+    }
+    std::rethrow_exception (relanzado);
+}
+
+
+/// @endcond
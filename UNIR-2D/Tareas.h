@@ -0,0 +1,271 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: Tareas.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    /// @brief Servicio de ejecución de tareas en un conjunto de hilos.
+    /// @details Permite sacar del bucle del juego el trabajo que no cabe en un ciclo, como la 
+    /// decodificación de activos, el cálculo de caminos o la búsqueda de la inteligencia 
+    /// artificial, y repartir entre los hilos los cálculos que se pueden hacer por partes.<p>
+    /// La clase Motor arranca los hilos antes de iniciar el juego (véase 
+    /// Motor::ponHilosTareas) y los para al terminar, antes de llamar a 'termina' del juego y 
+    /// después de esperar a que acaben las tareas lanzadas. Las tareas que esperan a una tarea 
+    /// que no se ha lanzado no se ejecutan.<p>
+    /// Una tarea se crea con 'crea', se le añaden las tareas de las que depende con 'dependeDe' y 
+    /// se lanza con 'lanza'. Una tarea lanzada se ejecuta en cuanto terminan todas las tareas de 
+    /// las que depende. Cada hilo tiene su propia cola: las tareas lanzadas desde un hilo de 
+    /// tareas entran en la cola de ese hilo, y las lanzadas desde el hilo del juego se reparten 
+    /// entre las colas. Un hilo toma primero la última tarea de su cola y, si está vacía, roba la 
+    /// primera de la cola de otro hilo.<p>
+    /// Las funciones de las tareas se ejecutan en los hilos de tareas y no deben acceder a los 
+    /// dibujos ni a los actores que el juego modifica a la vez. Para devolver el resultado al 
+    /// juego, una tarea puede tener un aviso (véase 'alTerminar'), que la clase Motor ejecuta en 
+    /// el hilo del juego al comienzo del ciclo siguiente a su terminación.<p>
+    /// Si la función de una tarea lanza una excepción, la excepción se guarda y se vuelve a 
+    /// lanzar en 'espera' de esa tarea o, si nadie la espera, en el hilo del juego al comienzo de 
+    /// un ciclo siguiente, una excepción en cada ciclo. Las excepciones de los avisos también se 
+    /// lanzan al comienzo de un ciclo, después de entregar los demás avisos.<p>
+    /// Los identificadores de las tareas terminadas se reutilizan; una tarea cuyo identificador 
+    /// se ha reutilizado se considera terminada.
+    class Tareas {
+    public:
+
+        /// @brief Máximo número de tareas creadas y no terminadas, o con el aviso pendiente.
+        static constexpr int capacidadTareas = 1024;
+
+        /// @brief Máximo número de hilos de tareas.
+        static constexpr int maximoHilos = 64;
+
+        /// @brief Función de una tarea o de su aviso.
+        using Funcion = std::function <void ()>;
+
+        /// @brief Función que recibe la duración de cada tarea ejecutada (véase 'ponPerfil').
+        /// @details Recibe el nombre de la tarea, el hilo que la ha ejecutado (-1 para el hilo del 
+        /// juego) y la duración en microsegundos. Se llama desde el hilo que ha ejecutado la tarea.
+        using Perfil = std::function <void (const char * nombre, int hilo, long micrseg)>;
+
+        /// @brief Número de hilos de tareas en ejecución.
+        /// @return Número de hilos; cero si el servicio no está arrancado.
+        static int hilos ();
+
+        /// @brief Indica si el hilo que llama es uno de los hilos de tareas.
+        /// @return 'true' si se llama desde una tarea ejecutada en un hilo de tareas.
+        static bool enHiloTareas ();
+
+        /// @brief Crea una tarea, sin lanzarla.
+        /// @details Lanza std::runtime_error si hay 'capacidadTareas' tareas sin terminar.
+        /// @param nombre Nombre de la tarea, para el perfil. Debe ser una cadena constante.
+        /// @param funcion Trabajo de la tarea.
+        /// @return Identificador de la tarea.
+        static int crea (const char * nombre, Funcion funcion);
+
+        /// @brief Indica que una tarea no se puede ejecutar hasta que termine otra.
+        /// @details Se debe llamar antes de lanzar 'tarea'. Si 'previa' ya ha terminado, no tiene 
+        /// efecto.
+        /// @param tarea Tarea que espera.
+        /// @param previa Tarea esperada.
+        static void dependeDe (int tarea, int previa);
+
+        /// @brief Asigna a una tarea un aviso, que se ejecuta en el hilo del juego cuando termina.
+        /// @details El aviso se ejecuta al comienzo del ciclo siguiente a la terminación de la 
+        /// tarea, antes de actualizar el juego. Se puede llamar también con la tarea lanzada o 
+        /// terminada: si la tarea ya tiene un aviso, se ejecutan los dos, en el orden en que se 
+        /// asignaron; si ya ha terminado, el aviso se ejecuta al comienzo del ciclo siguiente.
+        /// @param tarea Tarea a la que se asigna el aviso.
+        /// @param aviso Función del aviso.
+        static void alTerminar (int tarea, Funcion aviso);
+
+        /// @brief Lanza una tarea creada.
+        /// @param tarea Tarea que se lanza.
+        static void lanza (int tarea);
+
+        /// @brief Crea y lanza una tarea.
+        /// @param nombre Nombre de la tarea, para el perfil.
+        /// @param funcion Trabajo de la tarea.
+        /// @return Identificador de la tarea.
+        static int ejecuta (const char * nombre, Funcion funcion);
+
+        /// @brief Crea y lanza una tarea que se ejecuta al terminar otra.
+        /// @param previa Tarea a la que sigue la nueva.
+        /// @param nombre Nombre de la tarea, para el perfil.
+        /// @param funcion Trabajo de la tarea.
+        /// @return Identificador de la nueva tarea.
+        static int continua (int previa, const char * nombre, Funcion funcion);
+
+        /// @brief Indica si una tarea ha terminado.
+        /// @param tarea Identificador de la tarea.
+        /// @return Si la tarea ha terminado.
+        static bool terminada (int tarea);
+
+        /// @brief Espera a que termine una tarea.
+        /// @details Mientras espera, el hilo que llama ejecuta otras tareas pendientes. El aviso de 
+        /// la tarea, si tiene, se sigue ejecutando en el ciclo siguiente. Si la tarea ha lanzado 
+        /// una excepción, se vuelve a lanzar.
+        /// @param tarea Identificador de la tarea.
+        static void espera (int tarea);
+
+        /// @brief Ejecuta una función para todos los índices de un intervalo, repartidos entre los 
+        /// hilos.
+        /// @details El intervalo se divide en lotes consecutivos; cada llamada a la función recibe 
+        /// un lote. El hilo que llama también ejecuta lotes, y el método vuelve cuando se han 
+        /// ejecutado todos. Si algún lote lanza una excepción, se vuelve a lanzar la primera y se 
+        /// descartan las demás.
+        /// @param inicio Primer índice del intervalo.
+        /// @param fin Índice siguiente al último del intervalo.
+        /// @param lote Número de índices de cada lote.
+        /// @param funcion Función que recibe el primer índice del lote y el siguiente al último.
+        static void paraCada (int inicio, int fin, int lote, const std::function <void (int desde, int hasta)> & funcion);
+
+        /// @brief Establece la función que recibe la duración de cada tarea ejecutada.
+        /// @details No se debe cambiar mientras haya tareas lanzadas. Una función vacía anula el 
+        /// perfil.
+        /// @param perfil Función del perfil.
+        static void ponPerfil (Perfil perfil);
+
+        /// @brief Número de tareas ejecutadas desde que se arrancó el servicio.
+        /// @return Número de tareas.
+        static long ejecutadas ();
+
+        /// @brief Número de tareas que un hilo ha robado de la cola de otro.
+        /// @return Número de tareas robadas.
+        static long robadas ();
+
+    private:
+
+        enum class Estado { libre, creada, lanzada, terminada };
+
+        struct Tarea {
+            std::mutex         cerrojo {};
+            int                generacion {1};
+            Estado             estado {Estado::libre};
+            std::atomic <int>  pendientes {};
+            const char *       nombre {};
+            Funcion            funcion {};
+            Funcion            aviso {};
+            // tareas que dependen de esta
+            std::vector <int>  sucesoras {};
+        };
+
+        struct Cola {
+            std::mutex        cerrojo {};
+            std::deque <int>  tareas {};
+        };
+
+        inline static Tarea *    tareas {};
+        inline static Cola *     colas {};
+        inline static int        total_hilos {};
+        inline static std::vector <std::thread> hilos_tareas {};
+        inline static thread_local int hilo_actual {-1};
+
+        inline static std::mutex        cerrojo_libres {};
+        inline static std::vector <int> libres {};
+
+        inline static std::atomic <int>       encoladas {};
+        inline static std::atomic <int>       activas {};
+        inline static std::atomic <unsigned>  siguiente_cola {};
+        inline static std::mutex              cerrojo_espera {};
+        inline static std::condition_variable despierta {};
+        inline static bool                    parando {};
+
+        inline static std::mutex         cerrojo_avisos {};
+        inline static std::atomic <bool> hay_avisos {};
+        inline static std::vector <int>  avisos {};
+        inline static std::vector <int>  avisos_entrega {};
+        // avisos asignados a tareas ya terminadas y liberadas
+        inline static std::vector <Funcion> avisos_sueltos {};
+        inline static std::vector <Funcion> sueltos_entrega {};
+
+        // excepciones no relanzadas, con la tarea que las lanzó (cero para las de los avisos)
+        struct Error {
+            int                 tarea;
+            std::exception_ptr  excepcion;
+        };
+
+        inline static std::mutex          cerrojo_error {};
+        inline static std::atomic <bool>  hay_error {};
+        inline static std::deque <Error>  errores {};
+
+        inline static Perfil              perfil {};
+        inline static std::atomic <long>  cuenta_ejecutadas {};
+        inline static std::atomic <long>  cuenta_robadas {};
+
+        static Tarea & localiza (int tarea, int & indice);
+        static void encola (int indice);
+        static bool toma (int hilo, int & indice);
+        static bool ayuda ();
+        static void completa (int indice);
+        static void libera (Tarea & tarea, int indice);
+        static void trabaja (int hilo);
+        static void guardaError (int tarea, std::exception_ptr excepcion);
+        static std::exception_ptr extraeError (int tarea);
+        static void relanzaError ();
+
+        static void arranca (int hilos);
+        static void para ();
+        static void entregaAvisos ();
+
+        friend class Motor;
+        friend class Rutinas;
+
+    };
+
+
+    inline int Tareas::hilos () {
+        return total_hilos;
+    }
+
+    inline bool Tareas::enHiloTareas () {
+        return hilo_actual >= 0;
+    }
+
+    inline long Tareas::ejecutadas () {
+        return cuenta_ejecutadas.load ();
+    }
+
+    inline long Tareas::robadas () {
+        return cuenta_robadas.load ();
+    }
+
+
+}
+
+
+/// @class unir2d::Tareas
+/// 
+/// Ejemplo de uso:
+/// @code
+/// // Calcula un camino sin detener el juego; el resultado se aplica en el hilo del juego.
+/// auto camino = std::make_shared <std::vector <Coord>> ();
+/// int tarea = Tareas::crea ("camino", [=] () { 
+///     *camino = buscaCamino (origen, destino); 
+/// });
+/// Tareas::alTerminar (tarea, [=] () { 
+///     ficha->sigue (* camino); 
+/// });
+/// Tareas::lanza (tarea);
+/// 
+/// // Reparte el cálculo de las fuerzas de 'particulas' en lotes de 256.
+/// Tareas::paraCada (0, total, 256, [&] (int desde, int hasta) {
+///     for (int indc = desde; indc < hasta; ++ indc) {
+///         particulas [indc].calculaFuerza ();
+///     }
+/// });
+/// @endcode
@@ -16,43 +16,117 @@
 
 
 #include "UNIR-2D.h"
-#include <Windows.h>
 
 using namespace unir2d;
 
 
 void Teclado::configura (Rendidor * rendidor) {
-    winHandle = rendidor->window->getSystemHandle ();
+    s_pulsada.reset ();
+    s_consumida.reset ();
+    s_bajada.reset ();
+    s_subida.reset ();
+    s_pendiente.reset ();
 }
 
 
-void Teclado::sondea () {
-    if (GetFocus () != winHandle) {
+void Teclado::iniciaCiclo () {
+    s_bajada.reset ();
+    s_subida.reset ();
+    for (int indc = 0; indc < totalTeclas; ++ indc) {
+        if (s_pendiente [indc]) {
+            suelta (indc);
+        }
+    }
+    s_pendiente.reset ();
+}
+
+
+void Teclado::procesa (const sf::Event & suceso, Momento momento) {
+    switch (suceso.type) {
+    case sf::Event::KeyPressed: {
+        int indc = indice (suceso.key.code);
+        if (indc >= 0) {
+            pulsa (indc, momento);
+        }
+        break;
+    }
+    case sf::Event::KeyReleased: {
+        int indc = indice (suceso.key.code);
+        if (indc < 0) {
+            break;
+        }
+        // si se ha pulsado en este ciclo, se mantiene pulsada hasta el siguiente
+        if (s_bajada [indc]) {
+            s_pendiente [indc] = true;
+        } else {
+            suelta (indc);
+        }
+        break;
+    }
+    case sf::Event::LostFocus:
+        sueltaTodas ();
+        break;
+    default:
+        break;
+    }
+}
+
+
+int Teclado::indice (sf::Keyboard::Key codigo) {
+    Tecla tecla;
+    switch (codigo) {
+    case sf::Keyboard::Up:     tecla = Tecla::arriba;    break;
+    case sf::Keyboard::Down:   tecla = Tecla::abajo;     break;
+    case sf::Keyboard::Left:   tecla = Tecla::izquierda; break;
+    case sf::Keyboard::Right:  tecla = Tecla::derecha;   break;
+    case sf::Keyboard::A:      tecla = Tecla::A;         break;
+    case sf::Keyboard::S:      tecla = Tecla::S;         break;
+    case sf::Keyboard::D:      tecla = Tecla::D;         break;
+    case sf::Keyboard::W:      tecla = Tecla::W;         break;
+    case sf::Keyboard::Enter:  tecla = Tecla::entrar;    break;
+    case sf::Keyboard::Space:  tecla = Tecla::espacio;   break;
+    case sf::Keyboard::Escape: tecla = Tecla::escape;    break;
+    default:
+        return -1;
+    }
+    return static_cast <int> (tecla);
+}
+
+
+void Teclado::pulsa (int indice, Momento momento) {
+    // soltada y pulsada de nuevo en el mismo ciclo: sigue pulsada, sin soltarla al iniciar el 
+    // ciclo siguiente
+    if (s_pendiente [indice]) {
+        s_pendiente [indice] = false;
+        s_momento_pulsada [indice] = momento;
+        return;
+    }
+    // la repetición automática del sistema no es una pulsación nueva
+    if (s_pulsada [indice]) {
         return;
     }
-    sondea (Tecla::arriba,    VK_UP);
-	sondea (Tecla::abajo,     VK_DOWN);
-	sondea (Tecla::izquierda, VK_LEFT);
-	sondea (Tecla::derecha,   VK_RIGHT);
-	sondea (Tecla::A,         'A');
-	sondea (Tecla::S,         'S');
-	sondea (Tecla::D,         'D');
-	sondea (Tecla::W,         'W');
-	sondea (Tecla::entrar,    VK_RETURN);
-	sondea (Tecla::espacio,   VK_SPACE);
-	sondea (Tecla::escape,    VK_ESCAPE);
+    s_pulsada   [indice] = true;
+    s_bajada    [indice] = true;
+    s_pendiente [indice] = false;
+    s_momento_pulsada [indice] = momento;
 }
 
 
-void Teclado::sondea (Tecla tecla, int virtual_key) {
-    SHORT estado = GetKeyState (virtual_key);
-    int indice = static_cast <int> (tecla);
-    if (estado & 0b10000000) {
-        s_pulsada [indice] = true;
-    } else {
-        s_pulsada   [indice] = false;
-        s_consumida [indice] = false;
+void Teclado::suelta (int indice) {
+    if (! s_pulsada [indice]) {
+        return;
+    }
+    s_pulsada   [indice] = false;
+    s_consumida [indice] = false;
+    s_subida    [indice] = true;
+}
+
+
+void Teclado::sueltaTodas () {
+    for (int indc = 0; indc < totalTeclas; ++ indc) {
+        suelta (indc);
     }
+    s_pendiente.reset ();
 }
 
 
@@ -65,8 +139,27 @@ bool Teclado::pulsando (Tecla tecla) {
 }
 
 
+bool Teclado::recienPulsada (Tecla tecla) {
+    return s_bajada [static_cast <int> (tecla)];
+}
+
+
+bool Teclado::recienSoltada (Tecla tecla) {
+    return s_subida [static_cast <int> (tecla)];
+}
+
+
+double Teclado::segundosPulsada (Tecla tecla) {
+    int indice = static_cast <int> (tecla);
+    if (! s_pulsada [indice]) {
+        return 0.0;
+    }
+    // al reproducir una grabación, los momentos de las pulsaciones y el reloj son los grabados
+    return std::chrono::duration <double> (Tiempo::ahora () - s_momento_pulsada [indice]).count ();
+}
+
+
 void Teclado::consume (Tecla tecla) {
     int indice = static_cast <int> (tecla);
     s_consumida [indice] = true;
 }
-
@@ -25,23 +25,44 @@ namespace unir2d {
 
 
 	/// @brief Clase que implementa el acceso al teclado del sistema.
-	/// @details La clase Motor comprueba el estado de pulsación de las teclas una sola vez en cada 
-	/// ciclo del bucle del juego. De esta forma, el resultado obtenido con los métodos de esta 
-	/// clase es coherente durante todo el ciclo.<p>
+	/// @details La ventana del juego recibe las pulsaciones de las teclas como sucesos, que la 
+	/// clase Motor procesa una sola vez al principio de cada ciclo del bucle del juego. De esta 
+	/// forma, el resultado obtenido con los métodos de esta clase es coherente durante todo el 
+	/// ciclo. Una tecla pulsada y soltada entre dos ciclos consecutivos aparece pulsada durante un 
+	/// ciclo, de modo que las pulsaciones rápidas no se pierden.<p>
 	/// La pulsación de una tecla es lenta en comparación con la ejecución de los ciclos del bucle 
 	/// del juego. Si, durante un ciclo, el juego responde a una pulsación con una acción, en el 
 	/// siguiente ciclo la tecla puede seguir estando pulsada y, en consecuencia, la accion se puede 
 	/// repetir. Para evitar este efecto, esta clase puede marcar una pulsación como 'consumida',
 	/// lo que es equivalente a anular la pulsación. La pulsacion se vuelve a detectar cuando el 
-	/// jugador levanta la tecla y la vuelve a pulsar.
+	/// jugador levanta la tecla y la vuelve a pulsar. Otra forma de evitarlo es responder solo en 
+	/// el ciclo en que se pulsa la tecla (véase recienPulsada).<p>
+	/// Al perder la ventana el foco se sueltan todas las teclas.
 	class Teclado {
 	public:
 
-		/// @brief Comprueba si la tecla indicada está pulsada en el momento de la llamada.
+		/// @brief Comprueba si la tecla indicada está pulsada en el ciclo actual.
 		/// @param tecla Tecla que se comprueba.
 		/// @return Si la tecla está pulsada.
 		static bool pulsando (Tecla tecla);
 
+		/// @brief Comprueba si la tecla indicada se ha pulsado al comienzo del ciclo actual.
+		/// @details Es verdadero solo en el ciclo en que se recibe la pulsación, aunque la tecla 
+		/// esté consumida.
+		/// @param tecla Tecla que se comprueba.
+		/// @return Si la tecla se acaba de pulsar.
+		static bool recienPulsada (Tecla tecla);
+
+		/// @brief Comprueba si la tecla indicada se ha soltado al comienzo del ciclo actual.
+		/// @param tecla Tecla que se comprueba.
+		/// @return Si la tecla se acaba de soltar.
+		static bool recienSoltada (Tecla tecla);
+
+		/// @brief Segundos que lleva pulsada la tecla indicada.
+		/// @param tecla Tecla que se comprueba.
+		/// @return Segundos desde la pulsación, o 0 si la tecla no está pulsada.
+		static double segundosPulsada (Tecla tecla);
+
 		/// @brief Anula la pulsación actual de la tecla indicada.
 		/// @details Si la tecla indicada está pulsada, la marca como no pulsada hasta que el 
 		/// jugador la vuelva a pulsar.
@@ -50,19 +71,31 @@ namespace unir2d {
 
 	private:
 
-		inline static sf::WindowHandle winHandle;
+		using Momento = std::chrono::time_point<std::chrono::steady_clock>;
 
 		static const int totalTeclas = static_cast <int> (Tecla::escape) + 1;
-		inline static std::array <bool, totalTeclas> s_pulsada   { false };
-		inline static std::array <bool, totalTeclas> s_consumida { false };
+		using Teclas = std::bitset <totalTeclas>;
 
-		static void sondea ();
+		inline static Teclas s_pulsada   {};
+		inline static Teclas s_consumida {};
+		inline static Teclas s_bajada    {};
+		inline static Teclas s_subida    {};
+		// teclas pulsadas y soltadas en el mismo ciclo; se sueltan al comienzo del siguiente
+		inline static Teclas s_pendiente {};
+		inline static std::array <Momento, totalTeclas> s_momento_pulsada {};
 
 		static void configura (Rendidor * rendidor);
+		static void iniciaCiclo ();
+		static void procesa (const sf::Event & suceso, Momento momento);
 
-		static void sondea (Tecla tecla, int virtual_key);
+		static int  indice (sf::Keyboard::Key codigo);
+		static void pulsa (int indice, Momento momento);
+		static void suelta (int indice);
+		static void sueltaTodas ();
 
 		friend class Motor;
+		friend class Rendidor;
+		friend class GrabacionEntrada;
 
 	};
 
@@ -27,6 +27,7 @@ Texto::Texto (const string & fuente) {
     sf::Font * font = fuentes.tabla_fuentes.at (fuente);
     m_texto.setFont (* font);
     fuentes.cuenta_usos ++;
+    RegistroRecursos::anotaTamanoFuente (font, m_texto.getCharacterSize ());
 }
 
 
@@ -39,29 +40,74 @@ Texto::~Texto () {
 
 
 float Texto::anchura () {
-    return this->m_texto.getGlobalBounds ().width;
+    // como cuando SFML guardaba la situación en el texto: incluye la escala y la rotación con las 
+    // que se presentó por última vez
+    return this->situacion_presentada.transformRect (this->m_texto.getLocalBounds ()).width;
 }
 
 
 void Texto::dibuja (const Transforma & contenedor, Rendidor * rendidor) {
-    Dibujable::situa (this->m_texto, contenedor, this->m_transforma);
-    rendidor->window->draw (this->m_texto);
-
-    //sf::Transformable objeto {};
-    //Dibujable::situa (objeto, contenedor, this->m_transforma);
-    //sf::RenderStates states {};
-    //states.transform = objeto.getTransform ();
-    //rendidor->window->draw (this->m_texto, states);
+    sf::RenderStates states {};
+    states.transform = situa (contenedor);
+    situacion_presentada = states.transform;
+    cuentaReconstruccion ();
+    rendidor->dibuja (this->m_texto, states, "Texto", cuentaVertices (), texturaGlifos ());
 }
 
 
 void Texto::dibuja (Textura * textura) {
-    this->m_texto.setPosition (m_transforma.posicion ().x (), m_transforma.posicion ().y ());
-    textura->rendible.draw (this->m_texto);
-
-    //sf::Transformable objeto {};
-    //Dibujable::situa (objeto, contenedor, this->m_transforma);
-    //sf::RenderStates states {};
-    //states.transform = objeto.getTransform ();
-    //rendidor->window->draw (this->m_texto, states);
+    // el texto no guarda la situación; se aplica la transformación propia, sin contenedor
+    sf::RenderStates states {};
+    states.transform = m_transforma.matriz ();
+    cuentaReconstruccion ();
+    Estadisticas::cuentaDibujo ("Texto", cuentaVertices (), texturaGlifos (), & textura->rendible);
+    textura->rendible.draw (this->m_texto, states);
+}
+
+
+void Texto::cuentaReconstruccion () {
+    // SFML calcula de nuevo la geometría del texto en el primer uso tras un cambio
+    if (geometria_cambiada) {
+        Estadisticas::cuentaReconstruccion ("Texto");
+        geometria_cambiada = false;
+    }
+}
+
+
+void Texto::asignaCadena (const sf::String & cadena) {
+    m_texto.setString (cadena);
+    geometria_cambiada = true;
+    // seis vértices por cada carácter visible
+    size_t visibles = 0;
+    for (sf::Uint32 caracter : cadena) {
+        if (caracter != ' ' && caracter != '\t' && caracter != '\n') {
+            visibles ++;
+        }
+    }
+    vertices_cadena = visibles * 6;
+}
+
+
+size_t Texto::cuentaVertices () const {
+    return vertices_cadena;
+}
+
+
+const sf::Texture * Texto::texturaGlifos () const {
+    if (m_texto.getFont () == nullptr) {
+        return nullptr;
+    }
+    return & m_texto.getFont ()->getTexture (m_texto.getCharacterSize ());
+}
+
+
+Dibujable::ClaveEstado Texto::claveEstado () const {
+    // SFML guarda los glifos de cada tipografía en una textura distinta para cada tamaño
+    return ClaveEstado {texturaGlifos (), nullptr, sf::Triangles};
+}
+
+
+bool Texto::limitesPantalla (const Transforma & contenedor, sf::FloatRect & limites) {
+    limites = situa (contenedor).transformRect (this->m_texto.getLocalBounds ());
+    return true;
 }
@@ -50,6 +50,14 @@ namespace unir2d {
 		/// @param valor cadena de caracteres.
 		void ponCadena (const wstring & valor);
 
+		/// @brief Establece la cadena de caracteres que aparecerá en la pantalla.
+		/// @param valor cadena de caracteres terminada en nulo.
+		void ponCadena (const char * valor);
+
+		/// @brief Establece la cadena de caracteres que aparecerá en la pantalla.
+		/// @param valor cadena de caracteres terminada en nulo.
+		void ponCadena (const wchar_t * valor);
+
 		/// @brief Establece el tamano de la fuente usada para presentar el texto.
 		/// @param valor tamano de la fuente.
 		void ponTamano (int valor);
@@ -67,6 +75,13 @@ namespace unir2d {
 		static Fuentes fuentes;
 
 		sf::Text m_texto {};
+		bool geometria_cambiada {true};
+		sf::Transform situacion_presentada {};
+		// última cadena recibida, en su forma original, y vértices que genera
+		string  cadena_estrecha {};
+		wstring cadena_ancha {};
+		bool    cadena_es_ancha {false};
+		size_t  vertices_cadena {};
 
         // los textos no se pueden copiar ni mover       
         Texto (const Texto & )              = delete;
@@ -76,8 +91,15 @@ namespace unir2d {
 
         void dibuja (const Transforma & contenedor, Rendidor * rendidor) override;
         void dibuja (Textura * textura);
+        ClaveEstado claveEstado () const override;
+        void asignaCadena (const sf::String & cadena);
+        void cuentaReconstruccion ();
+        size_t cuentaVertices () const;
+        const sf::Texture * texturaGlifos () const;
+        bool limitesPantalla (const Transforma & contenedor, sf::FloatRect & limites) override;
 
         friend class Textura;
+        friend class PanelRendimiento;
 
 	};
 
@@ -85,11 +107,40 @@ namespace unir2d {
 	inline Fuentes Texto::fuentes {};
 
 	inline void Texto::ponCadena (const string & valor) {
-		m_texto.setString (valor);
+		// se compara con la cadena recibida antes de convertirla
+		if (! cadena_es_ancha && valor == cadena_estrecha) {
+			return;
+		}
+		cadena_estrecha = valor;
+		cadena_es_ancha = false;
+		asignaCadena (sf::String {valor});
 	}
 
 	inline void Texto::ponCadena (const std::wstring & valor) {
-		m_texto.setString (valor);
+		if (cadena_es_ancha && valor == cadena_ancha) {
+			return;
+		}
+		cadena_ancha = valor;
+		cadena_es_ancha = true;
+		asignaCadena (sf::String {valor});
+	}
+
+	inline void Texto::ponCadena (const char * valor) {
+		if (! cadena_es_ancha && cadena_estrecha == valor) {
+			return;
+		}
+		cadena_estrecha = valor;
+		cadena_es_ancha = false;
+		asignaCadena (sf::String {valor});
+	}
+
+	inline void Texto::ponCadena (const wchar_t * valor) {
+		if (cadena_es_ancha && cadena_ancha == valor) {
+			return;
+		}
+		cadena_ancha = valor;
+		cadena_es_ancha = true;
+		asignaCadena (sf::String {valor});
 	}
 
 	//inline void Texto::ponCaracterX (unsigned int valor) {
@@ -97,7 +148,11 @@ namespace unir2d {
 	//}
 
 	inline void Texto::ponTamano (int valor) {
-		m_texto.setCharacterSize (valor);
+		if (valor != m_texto.getCharacterSize ()) {
+			m_texto.setCharacterSize (valor);
+			geometria_cambiada = true;
+			RegistroRecursos::anotaTamanoFuente (m_texto.getFont (), valor);
+		}
 	}
 
 	inline void Texto::ponColor (Color valor) {
@@ -34,6 +34,7 @@ void Textura::carga (path archivo) {
     }
     //texture.setSmooth (true);
     rectg_textura = texture.getSize ();  
+    registra (archivo.string ());
 }
 
 
@@ -41,6 +42,7 @@ void Textura::suaviza () {
     assert (iniciada);
     assert (! para_rendir);
     this->texture.setSmooth (true);
+    RegistroRecursos::marcaSuavizada (this);
 }
 
 
@@ -55,6 +57,7 @@ void Textura::crea (Vector tamano) {
     rendible.create (rectg_textura.x, rectg_textura.y);
     rendible.clear ();
     rendida = false;
+    registra ({});
 }
    
 
@@ -87,7 +90,15 @@ const sf::Texture & Textura::entidad () {
 }
 
 
-
-
-
-
+void Textura::registra (const std::string & archivo) {
+    // se estiman 4 bytes por píxel en la tarjeta gráfica
+    RegistroRecursos::Recurso recurso {};
+    recurso.clase       = ClaseRecurso::textura;
+    recurso.nombre      = archivo;
+    recurso.ancho       = rectg_textura.x;
+    recurso.alto        = rectg_textura.y;
+    recurso.suavizada   = texture.isSmooth ();
+    recurso.para_rendir = para_rendir;
+    recurso.bytes       = static_cast <size_t> (rectg_textura.x) * rectg_textura.y * 4;
+    RegistroRecursos::registra (this, recurso);
+}
@@ -94,6 +94,7 @@ namespace unir2d {
         int cuenta_usos {0};
 
         const sf::Texture & entidad ();
+        void registra (const std::string & archivo);
 
         inline static int cuenta_instancias {};
 
@@ -105,9 +106,11 @@ namespace unir2d {
 
         friend class Imagen;
         friend class Baldosas;
+        friend class CapaBaldosas;
         friend class Malla;
         friend class Texto;
         friend class JuegoBase;
+        friend class PanelRendimiento;
 
     };
 
@@ -117,6 +120,9 @@ namespace unir2d {
     }
 
     inline Textura::~Textura () {
+        if (iniciada) {
+            RegistroRecursos::retira (this);
+        }
         cuenta_instancias --;
     }
 
@@ -40,7 +40,10 @@ namespace unir2d {
         bool iniciado () const;
 
         /// @brief Segundos transcurridos desde el inicio de la medición global del tiempo.
-        /// @details Las llamadas al método Termina() no cambian la medición del tiempo.
+        /// @details Las llamadas al método Termina() no cambian la medición del tiempo. Al 
+        /// reproducir una grabación de la entrada (véase Motor::reproduceEntrada), la medición 
+        /// global avanza con los tiempos grabados de cada ciclo; el cronómetro mide siempre el 
+        /// tiempo real.
         /// @return Segundos transcurridos.
         double segundos () const;
 
@@ -89,12 +92,22 @@ namespace unir2d {
         int periodos_crono {};
         std::chrono::microseconds acumulado_crono {};        
 
+        // Reloj de la medición global. Al reproducir una grabación de la entrada, la clase 
+        // GrabacionEntrada lo sustituye por el tiempo grabado de cada ciclo.
+        inline static bool    reloj_simulado {};
+        inline static Momento momento_simulado {};
+
+        static Momento ahora ();
+
+        friend class GrabacionEntrada;
+        friend class Teclado;
+
     };
 
 
     inline void Tiempo::inicia () {
         iniciado_ = true;
-        inicio_tiempo = std::chrono::steady_clock::now ();
+        inicio_tiempo = ahora ();
     }
     
     inline void Tiempo::termina () {
@@ -106,7 +119,7 @@ namespace unir2d {
     }
 
     inline double Tiempo::segundos () const {
-        Duracion duracion = std::chrono::steady_clock::now () - inicio_tiempo;        
+        Duracion duracion = ahora () - inicio_tiempo;        
         std::chrono::duration<double> segundos = 
                 std::chrono::duration_cast <std::chrono::duration <double>> (duracion);
         return segundos.count ();
@@ -148,5 +161,12 @@ namespace unir2d {
         std::this_thread::sleep_for (std::chrono::microseconds (microsegundos));
     }
 
+    inline Tiempo::Momento Tiempo::ahora () {
+        if (reloj_simulado) {
+            return momento_simulado;
+        }
+        return std::chrono::steady_clock::now ();
+    }
+
 
 }
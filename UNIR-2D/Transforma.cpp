@@ -37,8 +37,9 @@ static Vector multiplica (const float mtrz [4][4], const Vector vect) {
 
 Vector Transforma::aplicaAPosicion (const Vector posicion) const {
 	// este es el cálculo:
-	float  sen  = std::sin (m_rotacion);
-	float  cos  = std::cos (m_rotacion);
+	calcula ();
+	float  sen  = m_seno;
+	float  cos  = m_coseno;
 	Vector v_a {
 			posicion.x () * cos - posicion.y () * sen + m_posicion.x () - m_origen.x (),
 			posicion.y () * cos + posicion.x () * sen + m_posicion.y () - m_origen.y () };
@@ -46,5 +47,29 @@ Vector Transforma::aplicaAPosicion (const Vector posicion) const {
 }
 
 
+void Transforma::calculaMatrices () const {
+	float sen = std::sin (m_rotacion);
+	float cos = std::cos (m_rotacion);
+	float esx = m_escala.x ();
+	float esy = m_escala.y ();
+	//
+	// T (posicion) · R (rotacion) · S (escala) · T (- origen), como sf::Transformable
+	m_matriz = sf::Transform {
+			esx * cos, - esy * sen, m_posicion.x () - m_origen.x () * esx * cos + m_origen.y () * esy * sen,
+			esx * sen,   esy * cos, m_posicion.y () - m_origen.x () * esx * sen - m_origen.y () * esy * cos,
+			0.0f,        0.0f,      1.0f };
+	//
+	// T (posicion - origen) · R (rotacion)
+	m_matriz_contenedor = sf::Transform {
+			cos, - sen, m_posicion.x () - m_origen.x (),
+			sen,   cos, m_posicion.y () - m_origen.y (),
+			0.0f,  0.0f, 1.0f };
+	//
+	m_seno   = sen;
+	m_coseno = cos;
+	version_calculada = m_version;
+}
+
+
 /// @endcond
 
@@ -23,7 +23,11 @@ namespace unir2d {
 
 	/// @brief Almacena las geometría de las entidades del juego.
 	/// @details Esta clase es usada internamente por los actores del juego (derivados de ActorBase)
-	/// y por los dibujables del juego (derivados de Dibujable).
+	/// y por los dibujables del juego (derivados de Dibujable).<p>
+	/// Las matrices de la transformación, y el seno y el coseno de la rotación, se calculan solo 
+	/// cuando se usan después de un cambio. Cada cambio asigna una versión nueva a la instancia; 
+	/// las versiones son únicas entre todas las instancias, lo que permite a otras clases 
+	/// guardar resultados calculados a partir de una instancia y saber cuando dejan de ser válidos.
 	class Transforma {
 	public:
 
@@ -45,6 +49,24 @@ namespace unir2d {
 		float aplicaARotacion (float rotacion) const;
 		Vector aplicaAPosicion (Vector posicion) const;
 
+		/// @brief Versión de la instancia; cambia cada vez que cambia algún valor.
+		uint64_t version () const;
+
+		/// @brief Seno de la rotación.
+		float seno () const;
+
+		/// @brief Coseno de la rotación.
+		float coseno () const;
+
+		/// @brief Matriz de la transformación de un dibujable: traslada al origen, escala, rota y
+		/// traslada a la posición.
+		const sf::Transform & matriz () const;
+
+		/// @brief Matriz de la transformación aplicada a los dibujables contenidos en un actor: 
+		/// rota y traslada a la posición menos el origen.
+		/// @details Es la matriz equivalente a los métodos aplicaAPosicion() y aplicaARotacion().
+		const sf::Transform & matrizContenedor () const;
+
 	private:
 
 		Vector m_origen   {0.0, 0.0};
@@ -52,6 +74,21 @@ namespace unir2d {
 		float  m_rotacion {0.0};
 		Vector m_escala   {1.0, 1.0};
 
+		inline static std::atomic <uint64_t> ultima_version {};
+
+		uint64_t m_version {nuevaVersion ()};
+
+		// valores calculados para la versión 'version_calculada'
+		mutable uint64_t      version_calculada {0};
+		mutable float         m_seno   {0.0f};
+		mutable float         m_coseno {1.0f};
+		mutable sf::Transform m_matriz {};
+		mutable sf::Transform m_matriz_contenedor {};
+
+		static uint64_t nuevaVersion ();
+		void calcula () const;
+		void calculaMatrices () const;
+
 	};
 
 
@@ -72,19 +109,69 @@ namespace unir2d {
 	}
 
 	inline void Transforma::ponOrigen (Vector valor) {
+		if (m_origen == valor) {
+			return;
+		}
 		m_origen = valor;
+		m_version = nuevaVersion ();
 	}
 
 	inline void Transforma::ponPosicion (Vector valor) {
+		if (m_posicion == valor) {
+			return;
+		}
 		m_posicion = valor;
+		m_version = nuevaVersion ();
 	}
 
 	inline void Transforma::ponRotacion (float valor) {
+		if (m_rotacion == valor) {
+			return;
+		}
 		m_rotacion = valor;
+		m_version = nuevaVersion ();
+	}
+
+	inline uint64_t Transforma::version () const {
+		return m_version;
+	}
+
+	inline float Transforma::seno () const {
+		calcula ();
+		return m_seno;
+	}
+
+	inline float Transforma::coseno () const {
+		calcula ();
+		return m_coseno;
+	}
+
+	inline const sf::Transform & Transforma::matriz () const {
+		calcula ();
+		return m_matriz;
+	}
+
+	inline const sf::Transform & Transforma::matrizContenedor () const {
+		calcula ();
+		return m_matriz_contenedor;
+	}
+
+	inline uint64_t Transforma::nuevaVersion () {
+		return ++ ultima_version;
+	}
+
+	inline void Transforma::calcula () const {
+		if (version_calculada != m_version) {
+			calculaMatrices ();
+		}
 	}
 
 	inline void Transforma::ponEscala (Vector valor) {
+		if (m_escala == valor) {
+			return;
+		}
 		m_escala = valor;
+		m_version = nuevaVersion ();
 	}
 
 
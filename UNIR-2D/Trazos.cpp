@@ -40,11 +40,9 @@ void Trazos::dibuja (const Transforma & contenedor, Rendidor * rendidor) {
 		this->preparado = true;
 	}
 	//
-	sf::Transformable objeto {};
-	Dibujable::situa (objeto, contenedor, this->m_transforma);
 	sf::RenderStates states {};
-    states.transform = objeto.getTransform ();
-    rendidor->window->draw (vertices, total_vertices, sf::Lines, states);
+    states.transform = situa (contenedor);
+    rendidor->dibuja (vertices, total_vertices, sf::Lines, states, "Trazos");
 /*******************************************************************************/
 /*******************************************************************************
 	if (this->lineas_cambiado) {
@@ -71,4 +69,9 @@ void Trazos::dibuja (const Transforma & contenedor, Rendidor * rendidor) {
     //
 	rendidor->window->draw (this->vertices, states);
 *******************************************************************************/
-}
\ No newline at end of file
+}
+
+
+Dibujable::ClaveEstado Trazos::claveEstado () const {
+    return ClaveEstado {nullptr, nullptr, sf::Lines};
+}
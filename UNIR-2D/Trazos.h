@@ -77,6 +77,7 @@ namespace unir2d {
         Trazos & operator = (Trazos && )      = delete;
 
 		void dibuja (const Transforma & contenedor, Rendidor * rendidor) override;
+		ClaveEstado claveEstado () const override;
 
 	};
 
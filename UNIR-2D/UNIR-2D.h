@@ -25,20 +25,40 @@
 #include <exception>
 #include <system_error>
 #include <memory>
+#include <utility>
+#include <new>
+#include <functional>
+#include <coroutine>
 #include <string>
 using string  = std::string;
 using wstring = std::wstring;
 #include <array>
+#include <bitset>
 #include <vector>
+#include <span>
+#include <tuple>
+#include <deque>
 #include <map>
+#include <unordered_map>
 #include <chrono>
+#include <cwchar>
+#include <locale>
+#include <cstdio>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
 #include <random>
 #include <filesystem>
 #include <iostream>
+#include <fstream>
 #include <cmath>
 #include <numbers>
 #include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <bit>
 
 #include <SFML/Audio.hpp>
 #include <SFML/Graphics.hpp>
@@ -46,13 +66,24 @@ using wstring = std::wstring;
 #include "Coord.h"
 #include "Vector.h"
 #include "Region.h"
+#include "Colisiones.h"
 #include "Color.h"
 #include "Tiempo.h"
+#include "ArenaCiclo.h"
+#include "RastreoMemoria.h"
+#include "RegistroRecursos.h"
+#include "Estadisticas.h"
+#include "Tareas.h"
+#include "Entidades.h"
 #include "Tecla.h"
 #include "Teclado.h"
 #include "BotonRaton.h"
 #include "Raton.h"
+#include "ZonasRaton.h"
+#include "Rutinas.h"
 #include "Transforma.h"
+#include "LoteVectores.h"
+#include "ReservaDibujos.h"
 #include "Dibujable.h"
 #include "RellenoFigura.h"
 #include "Circulo.h"
@@ -62,13 +93,21 @@ using wstring = std::wstring;
 #include "Textura.h"
 #include "Imagen.h"
 #include "Baldosas.h"
+#include "MapaBaldosas.h"
 #include "TrianguloMalla.h"
 #include "Malla.h"
 #include "Fuentes.h"
 #include "Texto.h"
+#include "Audio.h"
 #include "Sonido.h"
+#include "Musica.h"
+#include "Nodo.h"
 #include "ActorBase.h"
+#include "ActorEntidades.h"
 #include "EjecucionJuego.h"
 #include "JuegoBase.h"
+#include "PanelRendimiento.h"
+#include "CapturaFotogramas.h"
+#include "GrabacionEntrada.h"
 #include "Motor.h"
 #include "Rendidor.h"
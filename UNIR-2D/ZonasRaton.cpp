@@ -0,0 +1,339 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: ZonasRaton.cpp
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. No documentado.
+
+
+
+
+#include "UNIR-2D.h"
+
+using namespace unir2d;
+
+
+/// @cond
+
+
+std::vector <ZonasRaton::Zona>     ZonasRaton::zonas {};
+std::vector <int>                  ZonasRaton::libres {};
+std::vector <ZonasRaton::Receptor> ZonasRaton::receptores {};
+std::vector <int>                  ZonasRaton::receptores_libres {};
+std::vector <uint32_t>             ZonasRaton::inicios {};
+std::vector <int>                  ZonasRaton::indices {};
+
+
+int ZonasRaton::agregaReceptor (Receptor receptor) {
+    assert (receptor);
+    int indice;
+    if (receptores_libres.empty ()) {
+        indice = static_cast <int> (receptores.size ());
+        receptores.push_back (std::move (receptor));
+    } else {
+        indice = receptores_libres.back ();
+        receptores_libres.pop_back ();
+        receptores [indice] = std::move (receptor);
+    }
+    return indice;
+}
+
+
+void ZonasRaton::retiraReceptor (int receptor) {
+    assert (receptor >= 0 && receptor < receptores.size () && receptores [receptor]);
+    for (int indice = 0; indice < zonas.size (); ++ indice) {
+        if (zonas [indice].viva && zonas [indice].receptor == receptor) {
+            retira (indice);
+        }
+    }
+    receptores [receptor] = nullptr;
+    receptores_libres.push_back (receptor);
+}
+
+
+int ZonasRaton::agregaRectangulo (int receptor, int clave, const Region & region, int plano, int z) {
+    Zona zona {};
+    zona.forma    = Forma::rectangulo;
+    zona.plano    = static_cast <uint8_t> (plano);
+    zona.z        = z;
+    zona.receptor = receptor;
+    zona.clave    = clave;
+    zona.posicion = region.posicion ();
+    zona.medida   = region.tamano ();
+    assert (plano >= 0 && plano < totalPlanos);
+    return agrega (zona);
+}
+
+
+int ZonasRaton::agregaCirculo (int receptor, int clave, Vector centro, float radio, int plano, int z) {
+    assert (radio >= 0.0f);
+    Zona zona {};
+    zona.forma    = Forma::circulo;
+    zona.plano    = static_cast <uint8_t> (plano);
+    zona.z        = z;
+    zona.receptor = receptor;
+    zona.clave    = clave;
+    zona.posicion = centro;
+    zona.medida   = Vector {radio, radio};
+    assert (plano >= 0 && plano < totalPlanos);
+    return agrega (zona);
+}
+
+
+int ZonasRaton::agregaHexagono (int receptor, int clave, Vector centro, Vector semiejes, int plano, int z) {
+    assert (semiejes.x () >= 0.0f && semiejes.y () >= 0.0f);
+    Zona zona {};
+    zona.forma    = Forma::hexagono;
+    zona.plano    = static_cast <uint8_t> (plano);
+    zona.z        = z;
+    zona.receptor = receptor;
+    zona.clave    = clave;
+    zona.posicion = centro;
+    zona.medida   = semiejes;
+    assert (plano >= 0 && plano < totalPlanos);
+    return agrega (zona);
+}
+
+
+int ZonasRaton::agrega (const Zona & zona) {
+    assert (zona.receptor >= 0 && zona.receptor < receptores.size () && receptores [zona.receptor]);
+    int indice;
+    if (libres.empty ()) {
+        indice = static_cast <int> (zonas.size ());
+        zonas.push_back (zona);
+    } else {
+        indice = libres.back ();
+        libres.pop_back ();
+        zonas [indice] = zona;
+    }
+    zonas [indice].viva = true;
+    cuenta_vivas ++;
+    cambiadas = true;
+    return indice;
+}
+
+
+void ZonasRaton::mueve (int zona, Vector posicion) {
+    assert (zona >= 0 && zona < zonas.size () && zonas [zona].viva);
+    if (zonas [zona].posicion == posicion) {
+        return;
+    }
+    zonas [zona].posicion = posicion;
+    cambiadas = true;
+}
+
+
+void ZonasRaton::retira (int zona) {
+    assert (zona >= 0 && zona < zonas.size () && zonas [zona].viva);
+    int plano = zonas [zona].plano;
+    if (sobre [plano] == zona) {
+        sobre [plano] = -1;
+    }
+    if (sobre_ahora [plano] == zona) {
+        sobre_ahora [plano] = -1;
+    }
+    zonas [zona].viva = false;
+    libres.push_back (zona);
+    cuenta_vivas --;
+    cambiadas = true;
+}
+
+
+void ZonasRaton::vacia () {
+    zonas.clear ();
+    libres.clear ();
+    receptores.clear ();
+    receptores_libres.clear ();
+    inicios.clear ();
+    indices.clear ();
+    celdas_x = 0;
+    celdas_y = 0;
+    cuenta_vivas = 0;
+    cambiadas = false;
+    sobre.fill (-1);
+    sobre_ahora.fill (-1);
+}
+
+
+void ZonasRaton::limita (const Zona & zona, Vector & minimo, Vector & maximo) {
+    if (zona.forma == Forma::rectangulo) {
+        minimo = zona.posicion;
+        maximo = zona.posicion + zona.medida;
+    } else {
+        minimo = zona.posicion - zona.medida;
+        maximo = zona.posicion + zona.medida;
+    }
+}
+
+
+bool ZonasRaton::contiene (const Zona & zona, Vector punto) {
+    switch (zona.forma) {
+    case Forma::rectangulo:
+        return Region {zona.posicion, zona.medida}.contiene (punto);
+    case Forma::circulo: {
+        Vector separa = punto - zona.posicion;
+        return separa.x () * separa.x () + separa.y () * separa.y () <= zona.medida.x () * zona.medida.x ();
+    }
+    case Forma::hexagono: {
+        // los lados inclinados unen el vértice lateral (a, 0) con el extremo (a / 2, b) del lado 
+        // horizontal
+        float dx = std::abs (punto.x () - zona.posicion.x ());
+        float dy = std::abs (punto.y () - zona.posicion.y ());
+        float a  = zona.medida.x ();
+        float b  = zona.medida.y ();
+        return dy <= b && b * dx + 0.5f * a * dy <= a * b;
+    }
+    }
+    return false;
+}
+
+
+void ZonasRaton::reconstruye () {
+    //
+    // La rejilla cubre el rectángulo que contiene a todas las zonas.
+    Vector minimo {};
+    Vector maximo {};
+    bool primera = true;
+    for (const Zona & zona : zonas) {
+        if (! zona.viva) {
+            continue;
+        }
+        Vector zona_min, zona_max;
+        limita (zona, zona_min, zona_max);
+        if (primera) {
+            minimo = zona_min;
+            maximo = zona_max;
+            primera = false;
+        } else {
+            minimo = Vector {std::min (minimo.x (), zona_min.x ()), std::min (minimo.y (), zona_min.y ())};
+            maximo = Vector {std::max (maximo.x (), zona_max.x ()), std::max (maximo.y (), zona_max.y ())};
+        }
+    }
+    origen   = minimo;
+    celdas_x = primera ? 0 : static_cast <int> ((maximo.x () - minimo.x ()) / ladoCelda) + 1;
+    celdas_y = primera ? 0 : static_cast <int> ((maximo.y () - minimo.y ()) / ladoCelda) + 1;
+    //
+    // Cuenta las zonas de cada celda en 'inicios [celda + 1]' y acumula las cuentas para obtener
+    // el comienzo del tramo de cada celda.
+    size_t celdas = static_cast <size_t> (celdas_x) * celdas_y;
+    inicios.assign (celdas + 1, 0);
+    for (int pasada = 0; pasada < 2; ++ pasada) {
+        for (int indice = 0; indice < zonas.size (); ++ indice) {
+            const Zona & zona = zonas [indice];
+            if (! zona.viva) {
+                continue;
+            }
+            Vector zona_min, zona_max;
+            limita (zona, zona_min, zona_max);
+            int x1 = static_cast <int> ((zona_min.x () - origen.x ()) / ladoCelda);
+            int y1 = static_cast <int> ((zona_min.y () - origen.y ()) / ladoCelda);
+            int x2 = std::min (static_cast <int> ((zona_max.x () - origen.x ()) / ladoCelda), celdas_x - 1);
+            int y2 = std::min (static_cast <int> ((zona_max.y () - origen.y ()) / ladoCelda), celdas_y - 1);
+            for (int y = y1; y <= y2; ++ y) {
+                for (int x = x1; x <= x2; ++ x) {
+                    size_t celda = static_cast <size_t> (y) * celdas_x + x;
+                    if (pasada == 0) {
+                        inicios [celda + 1] ++;
+                    } else {
+                        indices [inicios [celda] ++] = indice;
+                    }
+                }
+            }
+        }
+        if (pasada == 0) {
+            for (size_t celda = 0; celda < celdas; ++ celda) {
+                inicios [celda + 1] += inicios [celda];
+            }
+            indices.resize (inicios [celdas]);
+        }
+    }
+    //
+    // La segunda pasada ha avanzado cada comienzo hasta el final de su tramo, que es el comienzo
+    // del tramo siguiente.
+    for (size_t celda = celdas; celda > 0; -- celda) {
+        inicios [celda] = inicios [celda - 1];
+    }
+    inicios [0] = 0;
+}
+
+
+void ZonasRaton::localiza (Vector punto) {
+    sobre_ahora.fill (-1);
+    float x = (punto.x () - origen.x ()) / ladoCelda;
+    float y = (punto.y () - origen.y ()) / ladoCelda;
+    if (x < 0.0f || y < 0.0f || x >= static_cast <float> (celdas_x) || y >= static_cast <float> (celdas_y)) {
+        return;
+    }
+    size_t celda = static_cast <size_t> (y) * celdas_x + static_cast <size_t> (x);
+    for (uint32_t posicion = inicios [celda]; posicion < inicios [celda + 1]; ++ posicion) {
+        int indice = indices [posicion];
+        const Zona & zona = zonas [indice];
+        if (! contiene (zona, punto)) {
+            continue;
+        }
+        // a igualdad de orden, tapa la agregada más tarde; los índices de cada celda son crecientes
+        int & elegida = sobre_ahora [zona.plano];
+        if (elegida < 0 || zonas [elegida].z <= zona.z) {
+            elegida = indice;
+        }
+    }
+}
+
+
+void ZonasRaton::envia (int zona, SucesoZona suceso) {
+    if (! zonas [zona].viva) {
+        return;
+    }
+    int clave = zonas [zona].clave;
+    // copia: el receptor puede retirarse a sí mismo o agregar otros receptores
+    Receptor receptor = receptores [zonas [zona].receptor];
+    receptor (suceso, clave);
+}
+
+
+void ZonasRaton::resuelve () {
+    //
+    // Se busca la zona bajo el ratón solo si se ha movido el ratón o han cambiado las zonas.
+    Vector posicion = Raton::posicion ();
+    if (cambiadas) {
+        reconstruye ();
+        localiza (posicion);
+        posicion_resuelta = posicion;
+        cambiadas = false;
+    } else if (posicion != posicion_resuelta) {
+        localiza (posicion);
+        posicion_resuelta = posicion;
+    }
+    //
+    // Los receptores pueden retirar zonas; 'retira' actualiza 'sobre' y 'sobre_ahora'.
+    for (int plano = 0; plano < totalPlanos; ++ plano) {
+        if (sobre [plano] != sobre_ahora [plano]) {
+            int anterior = sobre [plano];
+            sobre [plano] = sobre_ahora [plano];
+            if (anterior >= 0) {
+                envia (anterior, SucesoZona::sale);
+            }
+            if (sobre [plano] >= 0) {
+                envia (sobre [plano], SucesoZona::entra);
+            }
+        }
+        if (sobre [plano] >= 0 && Raton::dobleClic ()) {
+            envia (sobre [plano], SucesoZona::dobleClic);
+        }
+        if (sobre [plano] >= 0 && Raton::pulsando (BotonRaton::izquierda)) {
+            envia (sobre [plano], SucesoZona::pulsa);
+        }
+    }
+}
+
+
+/// @endcond
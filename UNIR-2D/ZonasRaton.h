@@ -0,0 +1,214 @@
+﻿
+// UNIR-2D :: Motor de juego mínimo para la programación de microjuegos en 2 dimensiones.
+// 
+// Copyright (C) 2022 UNIR-Universidad Internacional de La Rioja. 
+// Todos los derechos reservados. 
+// El sofware se entrega solo para uso educativo, sin ninguna garantía de adecuación para ningún 
+// proposito particular.
+// 
+// Bibliotecas de código usadas: 
+//   1) SFML - Simple and Fast Multimedia Library. Licencia: https://www.sfml-dev.org/license.php  
+// 
+// Archivo: ZonasRaton.h
+// Autor:   agent
+// Versión: 1.0 (19-Oct-2026)
+// Estado:  En desarrollo. Sin revisar. Documentado.
+
+
+#pragma once
+
+
+namespace unir2d {
+
+
+    /// @brief Sucesos que ZonasRaton entrega a los receptores de las zonas.
+    enum class SucesoZona {
+        /// @brief El ratón ha entrado en la zona.
+        entra,
+        /// @brief El ratón ha salido de la zona.
+        sale,
+        /// @brief El botón izquierdo del ratón está pulsado sobre la zona.
+        pulsa,
+        /// @brief Se ha realizado un doble-clic sobre la zona.
+        dobleClic
+    };
+
+
+    /// @brief Índice de las zonas de la pantalla que responden al ratón.
+    /// @details El juego registra sus zonas sensibles (rectángulos, círculos y hexágonos) en 
+    /// lugar de comprobar en cada ciclo si el ratón está sobre cada una de ellas. Cada zona se 
+    /// asocia a un receptor, que es la función del juego que recibe sus sucesos, y a una clave 
+    /// entera que el receptor usa para saber de qué zona se trata.<p>
+    /// Las zonas se reparten en planos. Al comienzo de la actualización de cada ciclo, el motor 
+    /// localiza, en cada plano, la zona que está bajo el ratón; si hay varias, la de mayor orden 
+    /// 'z' y, a igualdad de orden, la agregada más tarde. Las zonas de planos distintos no se 
+    /// tapan entre sí: por ejemplo, una ficha y la celda del tablero sobre la que está reciben 
+    /// ambas la pulsación si están en planos distintos.<p>
+    /// Solo se envían sucesos a los receptores de las zonas afectadas: 'sale' y 'entra' cuando 
+    /// cambia la zona bajo el ratón, y 'dobleClic' y 'pulsa', en este orden, en cada ciclo en que 
+    /// Raton::dobleClic o Raton::pulsando para el botón izquierdo son verdaderos. Los planos se 
+    /// procesan en orden creciente.<p>
+    /// Las zonas se guardan en una rejilla de celdas cuadradas que se reconstruye solo cuando se 
+    /// agregan, mueven o retiran zonas. La búsqueda solo se repite cuando se mueve el ratón o 
+    /// cambian las zonas, y examina únicamente las zonas de la celda que contiene al ratón.
+    class ZonasRaton {
+    public:
+
+        /// @brief Número de planos de zonas.
+        static constexpr int totalPlanos = 4;
+
+        /// @brief Lado de las celdas de la rejilla del índice, en píxeles.
+        static constexpr float ladoCelda = 64.0f;
+
+        /// @brief Función que recibe los sucesos de las zonas.
+        /// @details Recibe el suceso y la clave de la zona indicada al agregarla. Puede agregar, 
+        /// mover y retirar zonas y receptores; los cambios se aplican en el ciclo siguiente.
+        using Receptor = std::function <void (SucesoZona suceso, int clave)>;
+
+        /// @brief Registra un receptor de sucesos.
+        /// @param receptor Función que recibe los sucesos.
+        /// @return Identificador del receptor.
+        static int agregaReceptor (Receptor receptor);
+
+        /// @brief Retira un receptor y todas sus zonas.
+        /// @details El receptor no recibe el suceso 'sale' de las zonas retiradas.
+        /// @param receptor Identificador del receptor.
+        static void retiraReceptor (int receptor);
+
+        /// @brief Agrega una zona rectangular.
+        /// @param receptor Identificador del receptor de los sucesos de la zona.
+        /// @param clave Clave que se entrega al receptor con los sucesos de la zona.
+        /// @param region Región de la pantalla que ocupa la zona.
+        /// @param plano Plano de la zona, entre 0 y 'totalPlanos' - 1.
+        /// @param z Orden de la zona dentro del plano; la de mayor orden tapa a las demás.
+        /// @return Identificador de la zona.
+        static int agregaRectangulo (int receptor, int clave, const Region & region, int plano = 0, int z = 0);
+
+        /// @brief Agrega una zona circular.
+        /// @param receptor Identificador del receptor de los sucesos de la zona.
+        /// @param clave Clave que se entrega al receptor con los sucesos de la zona.
+        /// @param centro Centro del círculo.
+        /// @param radio Radio del círculo.
+        /// @param plano Plano de la zona, entre 0 y 'totalPlanos' - 1.
+        /// @param z Orden de la zona dentro del plano; la de mayor orden tapa a las demás.
+        /// @return Identificador de la zona.
+        static int agregaCirculo (int receptor, int clave, Vector centro, float radio, int plano = 0, int z = 0);
+
+        /// @brief Agrega una zona hexagonal, con dos lados horizontales.
+        /// @details Los vértices izquierdo y derecho están a 'semiejes.x' del centro y los lados 
+        /// horizontales a 'semiejes.y'. Un hexágono regular de lado 'L' tiene semiejes 
+        /// {L, L * sin 60º}.
+        /// @param receptor Identificador del receptor de los sucesos de la zona.
+        /// @param clave Clave que se entrega al receptor con los sucesos de la zona.
+        /// @param centro Centro del hexágono.
+        /// @param semiejes Distancias del centro a los vértices laterales y a los lados horizontales.
+        /// @param plano Plano de la zona, entre 0 y 'totalPlanos' - 1.
+        /// @param z Orden de la zona dentro del plano; la de mayor orden tapa a las demás.
+        /// @return Identificador de la zona.
+        static int agregaHexagono (int receptor, int clave, Vector centro, Vector semiejes, int plano = 0, int z = 0);
+
+        /// @brief Desplaza una zona.
+        /// @details Si la posición no cambia, no se reconstruye el índice.
+        /// @param zona Identificador de la zona.
+        /// @param posicion Esquina superior izquierda, en un rectángulo; centro, en un círculo o en 
+        /// un hexágono.
+        static void mueve (int zona, Vector posicion);
+
+        /// @brief Retira una zona. Su identificador se puede reutilizar.
+        /// @details El receptor no recibe el suceso 'sale' de la zona retirada.
+        /// @param zona Identificador de la zona.
+        static void retira (int zona);
+
+        /// @brief Número de zonas registradas.
+        /// @return Número de zonas.
+        static int cuentaZonas ();
+
+        /// @brief Zona que está bajo el ratón en un plano.
+        /// @param plano Plano que se consulta.
+        /// @return Identificador de la zona, o -1 si no hay ninguna.
+        static int zonaSobre (int plano);
+
+    private:
+
+        enum class Forma : uint8_t { rectangulo, circulo, hexagono };
+
+        struct Zona {
+            bool    viva {};
+            Forma   forma {};
+            uint8_t plano {};
+            int     z {};
+            int     receptor {};
+            int     clave {};
+            // esquina o centro, y tamaño, radio o semiejes
+            Vector  posicion {};
+            Vector  medida {};
+        };
+
+        static std::vector <Zona>     zonas;
+        static std::vector <int>      libres;
+        static std::vector <Receptor> receptores;
+        static std::vector <int>      receptores_libres;
+
+        // rejilla: origen y dimensiones en celdas; 'inicios' indica, para cada celda, el tramo de
+        // 'indices' con sus zonas
+        inline static Vector origen {};
+        inline static int    celdas_x {};
+        inline static int    celdas_y {};
+        static std::vector <uint32_t> inicios;
+        static std::vector <int>      indices;
+
+        inline static int    cuenta_vivas {};
+        inline static bool   cambiadas {};
+        inline static Vector posicion_resuelta {};
+        inline static std::array <int, totalPlanos> sobre {-1, -1, -1, -1};
+        inline static std::array <int, totalPlanos> sobre_ahora {-1, -1, -1, -1};
+
+        static int  agrega (const Zona & zona);
+        static void limita (const Zona & zona, Vector & minimo, Vector & maximo);
+        static bool contiene (const Zona & zona, Vector punto);
+        static void reconstruye ();
+        static void localiza (Vector punto);
+        static void envia (int zona, SucesoZona suceso);
+
+        static void resuelve ();
+        static void vacia ();
+
+        friend class Motor;
+
+    };
+
+
+    inline int ZonasRaton::cuentaZonas () {
+        return cuenta_vivas;
+    }
+
+    inline int ZonasRaton::zonaSobre (int plano) {
+        assert (plano >= 0 && plano < totalPlanos);
+        return sobre [plano];
+    }
+
+
+}
+
+
+/// @class unir2d::ZonasRaton
+/// 
+/// Ejemplo de uso:
+/// @code
+/// // En 'inicia' del actor se registran el receptor y las zonas.
+/// receptor = ZonasRaton::agregaReceptor ([this] (SucesoZona suceso, int clave) {
+///     if (suceso == SucesoZona::entra) {
+///         iluminaBoton (clave);
+///     } else if (suceso == SucesoZona::sale) {
+///         apagaBoton (clave);
+///     } else if (suceso == SucesoZona::pulsa) {
+///         pulsaBoton (clave);
+///         Raton::consumePulsado (BotonRaton::izquierda);
+///     }
+/// });
+/// ZonasRaton::agregaRectangulo (receptor, 0, Region {10, 10, 80, 30});
+/// ZonasRaton::agregaRectangulo (receptor, 1, Region {10, 50, 80, 30});
+/// 
+/// // En 'termina' se retira el receptor con todas sus zonas.
+/// ZonasRaton::retiraReceptor (receptor);
+/// @endcode
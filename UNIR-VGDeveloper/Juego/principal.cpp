@@ -11,6 +11,10 @@ int main () {
         std::setlocale (LC_ALL, "es_ES.utf8");
         juego::JuegoMesa * juego = new juego::JuegoMesa {};
         unir2d::Motor    * motor = new unir2d::Motor {};
+#if defined (UNIR2D_RASTREO_MEMORIA)
+        // configuración 'Rastreo': los ciclos en reposo no deben reservar memoria
+        motor->ponPruebaSinReservas ();
+#endif
         while (true) {
             motor->ejecuta (juego);
             if (juego->ejecucion () == unir2d::EjecucionJuego::cancelado) {
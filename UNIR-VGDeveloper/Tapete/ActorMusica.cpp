@@ -29,41 +29,29 @@ namespace tapete {
     }
 
 
-    void ActorMusica::asignaMusica (const string & archivo, int volumen) {
+    void ActorMusica::asignaMusica (const string & archivo, int volumen, double segundos_fundido) {
         archivo_musica = archivo;
         volumen_musica = volumen;
+        this->segundos_fundido = segundos_fundido;
     }
 
 
     void ActorMusica::inicia () {
-        musica = new unir2d::Sonido {};
-        musica->abre       (archivo_musica);
-        musica->ponVolumen (volumen_musica);
+        // el servicio de música repite la pista sin que el actor tenga que vigilarla
+        unir2d::Musica::ponVolumen (volumen_musica);
+        unir2d::Musica::restaura   (0.0);
+        unir2d::Musica::reproduce  (archivo_musica, segundos_fundido);
     }
 
 
     void ActorMusica::termina () {
-        delete musica;
-        musica = nullptr;
-    }
-
-
-    void ActorMusica::actualiza (double tiempo_seg) {
-        if (! iniciada) {
-            musica->suena ();
-            iniciada = true;
-            return;
-        } 
-        if (! musica->sonando ()) {
-            musica->repite ();
-        }
+        unir2d::Musica::para ();
     }
 
 
     void ActorMusica::bajaMusica () {
-        int volumen = musica->volumen ();
-        volumen = static_cast <int> (volumen * 0.3f);
-        musica->ponVolumen (volumen);
+        // la atenuación es un volumen objetivo; las llamadas repetidas no la acumulan
+        unir2d::Musica::atenua (porcentajeAtenuado, segundos_fundido);
     }
 
 
@@ -20,7 +20,8 @@ namespace tapete {
 
         string archivoMusica ();
         int    volumenMusica ();
-        void asignaMusica (const string & archivo_musica, int volumen);
+        // sin fundido, la música empieza y se atenúa de inmediato
+        void asignaMusica (const string & archivo_musica, int volumen, double segundos_fundido = 0.0);
 
         void bajaMusica ();
 
@@ -29,18 +30,16 @@ namespace tapete {
         void inicia () override;
         void termina () override;
 
-        void actualiza (double tiempo_seg) override;
-
     private:
 
         JuegoMesaBase * juego {}; 
 
         string archivo_musica {};
         int    volumen_musica {};
+        double segundos_fundido {};
 
-        unir2d::Sonido * musica {};
-
-        bool iniciada {};
+        // volumen de la música durante la partida, en porcentaje del volumen asignado
+        static constexpr int porcentajeAtenuado = 30;
 
     };
 
@@ -271,10 +271,22 @@ namespace tapete {
         ponPosicion (Vector {0, 0});
         //
         presencia_personaje.prepara ();
+        //
+        receptor_zonas = unir2d::ZonasRaton::agregaReceptor (
+                [this] (unir2d::SucesoZona suceso, int clave) { sucesoZona (suceso, clave); });
+        unir2d::ZonasRaton::agregaRectangulo (
+                receptor_zonas, claveZonaLateral, presencia_personaje.panel_lateral, 
+                ActorTablero::planoPaneles);
+        zona_ficha = unir2d::ZonasRaton::agregaCirculo (
+                receptor_zonas, claveZonaFicha, centroFicha (), PresenciaPersonaje::radioFicha, 
+                ActorTablero::planoFichas);
     }
 
 
     void ActorPersonaje::termina () {
+        unir2d::ZonasRaton::retiraReceptor (receptor_zonas);
+        receptor_zonas = -1;
+        zona_ficha     = -1;
         extraeDibujos ();
         lista_habilidades.clear ();
         presencia_personaje.libera ();
@@ -283,71 +295,45 @@ namespace tapete {
 
     void ActorPersonaje::actualiza (double tiempo_seg) {
         refrescaFicha ();
-        controlPersonajePulsacion ();
-        controlSobreFicha ();
-        controlFichaPulsacion ();
     }
 
 
-    void ActorPersonaje::refrescaFicha () {
+    Vector ActorPersonaje::centroFicha () const {
         Vector poscn = RejillaTablero::centroHexagono (sitio_ficha);
         poscn += PresenciaTablero::regionRejilla.posicion ();
-        poscn -= PresenciaPersonaje::deslizaFicha;
-        presencia_personaje.imagen_ficha->ponPosicion (poscn);
+        return poscn;
     }
 
 
-    void ActorPersonaje::controlPersonajePulsacion () {
-        bool sclic = unir2d::Raton::pulsando (unir2d::BotonRaton::izquierda);
-        if (sclic) {
-            if (presencia_personaje.panel_lateral.contiene (unir2d::Raton::posicion ())) {
-                juego_->sucesos ()->personajeSeleccionado (this);
-            }
-        }
+    void ActorPersonaje::refrescaFicha () {
+        Vector poscn = centroFicha ();
+        // la zona solo se reconstruye si la ficha ha cambiado de sitio
+        unir2d::ZonasRaton::mueve (zona_ficha, poscn);
+        poscn -= PresenciaPersonaje::deslizaFicha;
+        presencia_personaje.imagen_ficha->ponPosicion (poscn);
     }
 
 
-    void ActorPersonaje::controlSobreFicha () {
-        //
-        bool esta_sobre_ahora = false;
-        //
-        Vector poscn = RejillaTablero::centroHexagono (sitio_ficha);
-        poscn += PresenciaTablero::regionRejilla.posicion ();
-        if (norma (unir2d::Raton::posicion () - poscn) <= PresenciaPersonaje::radioFicha) {
-            esta_sobre_ahora = true;
-        }
-        if (esta_sobre_ficha) {
-            if (esta_sobre_ahora) {
-                // nada que hacer
-            } else {
-                juego_->sucesos ()->saliendoFicha (this); 
-                esta_sobre_ficha = false;
-            }
-        } else {
-            if (esta_sobre_ahora) {
-                juego_->sucesos ()->entrandoFicha (this);
-                esta_sobre_ficha = true;
-            } else {
-                // nada que hacer
+    void ActorPersonaje::sucesoZona (unir2d::SucesoZona suceso, int clave) {
+        if (clave == claveZonaLateral) {
+            if (suceso == unir2d::SucesoZona::pulsa) {
+                juego_->sucesos ()->personajeSeleccionado (this);
             }
+            return;
         }
-    }
-
-
-    void ActorPersonaje::controlFichaPulsacion () {
-        bool dclic = unir2d::Raton::dobleClic ();
-        bool sclic = unir2d::Raton::pulsando (unir2d::BotonRaton::izquierda);
-        if (dclic || sclic) {
-            Vector poscn = RejillaTablero::centroHexagono (sitio_ficha);
-            poscn += PresenciaTablero::regionRejilla.posicion ();
-            if (norma (unir2d::Raton::posicion () - poscn) <= PresenciaPersonaje::radioFicha) {
-                if (dclic) {
-                    juego_->sucesos ()->fichaSeleccionada (this);
-                } 
-                if (sclic) {
-                    juego_->sucesos ()->fichaPulsada (this);
-                }
-            }
+        switch (suceso) {
+        case unir2d::SucesoZona::entra:
+            juego_->sucesos ()->entrandoFicha (this);
+            break;
+        case unir2d::SucesoZona::sale:
+            juego_->sucesos ()->saliendoFicha (this);
+            break;
+        case unir2d::SucesoZona::dobleClic:
+            juego_->sucesos ()->fichaSeleccionada (this);
+            break;
+        case unir2d::SucesoZona::pulsa:
+            juego_->sucesos ()->fichaPulsada (this);
+            break;
         }
     }
 
@@ -142,13 +142,16 @@ namespace tapete {
 
         PresenciaPersonaje presencia_personaje {this};
 
-        bool esta_sobre_ficha {false};
+        // claves de las zonas del ratón
+        static constexpr int claveZonaFicha   = 0;
+        static constexpr int claveZonaLateral = 1;
+        int receptor_zonas {-1};
+        int zona_ficha {-1};
 
 
+        Vector centroFicha () const;
         void refrescaFicha ();
-        void controlPersonajePulsacion ();
-        void controlSobreFicha ();
-        void controlFichaPulsacion ();
+        void sucesoZona (unir2d::SucesoZona suceso, int clave);
 
         static void aserta (bool expresion, const string & mensaje);
 
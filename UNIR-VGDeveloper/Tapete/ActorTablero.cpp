@@ -263,10 +263,14 @@ namespace tapete {
         cuadro_indica           .prepara ();
         vista_camino_celdas     .prepara ();
         listado_ayuda           .prepara ();
+        //
+        registraZonas ();
     }
 
 
     void ActorTablero::termina () {
+        unir2d::ZonasRaton::retiraReceptor (receptor_zonas);
+        receptor_zonas = -1;
         extraeDibujos ();
         listado_ayuda           .libera ();
         vista_camino_celdas     .libera ();
@@ -280,205 +284,98 @@ namespace tapete {
 
 
     void ActorTablero::actualiza (double tiempo_seg) {
-        controlSobreRetrato ();
-        controlSobreHabilidad ();
-        controlRetratoPulsacion ();
-        controlHabilidadPulsacion ();
-        controlSobreCelda ();
-        controlCeldaPulsacion ();
-        controlAyudaPulsacion ();
         rejilla_tablero.refrescaMarcaje ();
     }
-       
-
-    void ActorTablero::controlSobreRetrato () {
-        //
-        SobreRetrato sobre_ahora;
-        sobre_ahora.esta = false;
-        //
-        if (presencia_actuante_izqrd.panel_retrato.contiene (unir2d::Raton::posicion ())) {
-            sobre_ahora.esta = true;
-            sobre_ahora.lado = LadoTablero::Izquierda;
-        }
-        if (presencia_actuante_derch.panel_retrato.contiene (unir2d::Raton::posicion ())) {
-            sobre_ahora.esta = true;
-            sobre_ahora.lado = LadoTablero::Derecha;
-        }
-        //
-        if (sobre_ahora.esta) {
-            if (sobre_habilidad.esta) {
-                juego->sucesos ()->saliendoHabilidad (sobre_habilidad.lado, sobre_habilidad.indice);               
-                sobre_habilidad.esta = false;
-            } else if (sobre_retrato.esta) {
-                if (sobre_retrato.lado   == sobre_ahora.lado) {
-                    // nada que hacer
-                } else {
-                    juego->sucesos ()->saliendoActuante (sobre_retrato.lado); 
-                    sobre_retrato = sobre_ahora;                    
-                    juego->sucesos ()->entrandoActuante (sobre_retrato.lado);
-                }
-            } else {
-                //presencia (sobre_ahora.lado).indicaHabilidad (sobre_ahora.indice);
-                sobre_retrato = sobre_ahora;
-                juego->sucesos ()->entrandoActuante (sobre_retrato.lado);
-            }
-        } else {
-            if (sobre_retrato.esta) {
-                juego->sucesos ()->saliendoActuante (sobre_retrato.lado);               
-                sobre_retrato.esta = false;
-            } else {
-                // nada que hacer
-            }
-        }
-    }
 
 
-    void ActorTablero::controlSobreHabilidad () {
-        //
-        SobreHabilidad sobre_ahora;
-        sobre_ahora.esta = false;
+    void ActorTablero::registraZonas () {
+        receptor_zonas = unir2d::ZonasRaton::agregaReceptor (
+                [this] (unir2d::SucesoZona suceso, int clave) { sucesoZona (suceso, clave); });
         //
-        for (int indc = 0; indc < presencia_actuante_izqrd.paneles_habilidad.size (); ++ indc) {
-            if (presencia_actuante_izqrd.paneles_habilidad [indc].contiene (unir2d::Raton::posicion ())) {
-                sobre_ahora.esta   = true;
-                sobre_ahora.lado   = LadoTablero::Izquierda;
-                sobre_ahora.indice = indc;
-            }
-        }
-        for (int indc = 0; indc < presencia_actuante_derch.paneles_habilidad.size (); ++ indc) {
-            if (presencia_actuante_derch.paneles_habilidad [indc].contiene (unir2d::Raton::posicion ())) {
-                sobre_ahora.esta   = true;
-                sobre_ahora.lado   = LadoTablero::Derecha;
-                sobre_ahora.indice = indc;
+        for (LadoTablero lado : {LadoTablero::Izquierda, LadoTablero::Derecha}) {
+            int dato_lado = static_cast <int> (lado);
+            unir2d::ZonasRaton::agregaRectangulo (
+                    receptor_zonas, claveZona (ZonaTablero::retrato, dato_lado, 0), 
+                    presencia (lado).panel_retrato, planoPaneles);
+            for (int indc = 0; indc < presencia (lado).paneles_habilidad.size (); ++ indc) {
+                unir2d::ZonasRaton::agregaRectangulo (
+                        receptor_zonas, claveZona (ZonaTablero::habilidad, dato_lado, indc), 
+                        presencia (lado).paneles_habilidad [indc], planoPaneles);
             }
         }
+        unir2d::ZonasRaton::agregaCirculo (
+                receptor_zonas, claveZona (ZonaTablero::ayuda, 0, 0), 
+                PresenciaTablero::centro_ayuda, PresenciaTablero::radio_ayuda, planoPaneles);
         //
-        if (sobre_ahora.esta) {
-            if (sobre_retrato.esta) {
-                juego->sucesos ()->saliendoActuante (sobre_habilidad.lado);               
-                sobre_retrato.esta = false;
-            } else if (sobre_habilidad.esta) {
-                if (sobre_habilidad.lado   == sobre_ahora.lado &&
-                    sobre_habilidad.indice == sobre_ahora.indice   ) {
-                    // nada que hacer
-                } else {
-                    juego->sucesos ()->saliendoHabilidad (sobre_habilidad.lado, sobre_habilidad.indice); 
-                    sobre_habilidad = sobre_ahora;                    
-                    juego->sucesos ()->entrandoHabilidad (sobre_habilidad.lado, sobre_habilidad.indice);
+        // las celdas tienen la fila y la columna ambas pares o ambas impares
+        Vector semiejes {RejillaTablero::ladoHexagono, RejillaTablero::ladoHexagono * RejillaTablero::seno60};
+        for (int fila = 1; fila <= RejillaTablero::filas; ++ fila) {
+            for (int coln = 1; coln <= RejillaTablero::columnas; ++ coln) {
+                if (fila % 2 != coln % 2) {
+                    continue;
                 }
-            } else {
-                //presencia (sobre_ahora.lado).indicaHabilidad (sobre_ahora.indice);
-                sobre_habilidad = sobre_ahora;
-                juego->sucesos ()->entrandoHabilidad (sobre_habilidad.lado, sobre_habilidad.indice);
-            }
-        } else {
-            if (sobre_habilidad.esta) {
-                juego->sucesos ()->saliendoHabilidad (sobre_habilidad.lado, sobre_habilidad.indice);               
-                sobre_habilidad.esta = false;
-            } else {
-                // nada que hacer
+                Vector centro = RejillaTablero::centroHexagono (Coord {fila, coln});
+                centro += PresenciaTablero::regionRejilla.posicion ();
+                unir2d::ZonasRaton::agregaHexagono (
+                        receptor_zonas, claveZona (ZonaTablero::celda, fila, coln), 
+                        centro, semiejes, planoCeldas);
             }
         }
     }
 
 
-    void ActorTablero::controlRetratoPulsacion () {
-        bool dclic = unir2d::Raton::dobleClic ();
-        bool sclic = unir2d::Raton::pulsando (unir2d::BotonRaton::izquierda);
-        if (sclic) {
-            if (presencia_actuante_izqrd.panel_retrato.contiene (unir2d::Raton::posicion ())) {       
-                juego->sucesos ()->actuanteSeleccionado (LadoTablero::Izquierda);
-            }
-            if (presencia_actuante_derch.panel_retrato.contiene (unir2d::Raton::posicion ())) {    
-                juego->sucesos ()->actuanteSeleccionado (LadoTablero::Derecha);
-            }
-        }
+    int ActorTablero::claveZona (ZonaTablero zona, int dato_1, int dato_2) {
+        assert (0 <= dato_1 && dato_1 <= 0xFF && 0 <= dato_2 && dato_2 <= 0xFF);
+        return static_cast <int> (zona) << 16 | dato_1 << 8 | dato_2;
     }
 
 
-    void ActorTablero::controlHabilidadPulsacion () {
-        bool dclic = unir2d::Raton::dobleClic ();
-        bool sclic = unir2d::Raton::pulsando (unir2d::BotonRaton::izquierda);
-        if (sclic) {
-            for (int indc = 0; indc < presencia_actuante_izqrd.paneles_habilidad.size (); ++ indc) {
-                if (presencia_actuante_izqrd.paneles_habilidad [indc].contiene (unir2d::Raton::posicion ())) {
-                    juego->sucesos ()->habilidadSeleccionada (LadoTablero::Izquierda, indc);
-                }
-            }
-            for (int indc = 0; indc < presencia_actuante_derch.paneles_habilidad.size (); ++ indc) {
-                if (presencia_actuante_derch.paneles_habilidad [indc].contiene (unir2d::Raton::posicion ())) {
-                    juego->sucesos ()->habilidadSeleccionada (LadoTablero::Derecha, indc);
-                }
-            }
-        }
-    }
-
-
-    void ActorTablero::controlSobreCelda () {
-        //
-        SobreCelda sobre_ahora;
-        sobre_ahora.esta = false;
-        //
-        Coord coord {};
-        Vector poscn = unir2d::Raton::posicion ();
-        poscn -= PresenciaTablero::regionRejilla.posicion ();
-        rejilla_tablero.localizaCelda (poscn, coord); 
-        if (coord != Coord {0, 0}) { 
-            sobre_ahora.esta  = true;
-            sobre_ahora.celda = coord;
-        }
+    void ActorTablero::sucesoZona (unir2d::SucesoZona suceso, int clave) {
+        ZonaTablero zona   = static_cast <ZonaTablero> (clave >> 16);
+        int         dato_1 = (clave >> 8) & 0xFF;
+        int         dato_2 = clave & 0xFF;
         //
-        if (sobre_ahora.esta) {
-            if (sobre_celda.esta) {
-                if (sobre_celda.celda == sobre_ahora.celda) {
-                    // nada que hacer
-                } else {
-                    juego->sucesos ()->saliendoCelda (sobre_celda.celda); 
-                    sobre_celda = sobre_ahora;                    
-                    juego->sucesos ()->entrandoCelda (sobre_celda.celda);
-                }
-            } else {
-                sobre_celda = sobre_ahora;
-                juego->sucesos ()->entrandoCelda (sobre_celda.celda);
+        switch (zona) {
+        case ZonaTablero::retrato: {
+            LadoTablero lado = static_cast <LadoTablero> (dato_1);
+            if (suceso == unir2d::SucesoZona::entra) {
+                juego->sucesos ()->entrandoActuante (lado);
+            } else if (suceso == unir2d::SucesoZona::sale) {
+                juego->sucesos ()->saliendoActuante (lado);
+            } else if (suceso == unir2d::SucesoZona::pulsa) {
+                juego->sucesos ()->actuanteSeleccionado (lado);
             }
-        } else {
-            if (sobre_celda.esta) {
-                juego->sucesos ()->saliendoCelda (sobre_celda.celda);               
-                sobre_celda.esta = false;
-            } else {
-                // nada que hacer
+            break;
+        }
+        case ZonaTablero::habilidad: {
+            LadoTablero lado = static_cast <LadoTablero> (dato_1);
+            if (suceso == unir2d::SucesoZona::entra) {
+                juego->sucesos ()->entrandoHabilidad (lado, dato_2);
+            } else if (suceso == unir2d::SucesoZona::sale) {
+                juego->sucesos ()->saliendoHabilidad (lado, dato_2);
+            } else if (suceso == unir2d::SucesoZona::pulsa) {
+                juego->sucesos ()->habilidadSeleccionada (lado, dato_2);
             }
+            break;
         }
-    }
-
-
-    void ActorTablero::controlCeldaPulsacion () {
-        bool dclic = unir2d::Raton::dobleClic ();
-        bool sclic = unir2d::Raton::pulsando (unir2d::BotonRaton::izquierda);
-        if (dclic || sclic) {
-            Coord coord {};
-            Vector poscn = unir2d::Raton::posicion ();
-            poscn -= PresenciaTablero::regionRejilla.posicion ();
-            rejilla_tablero.localizaCelda (poscn, coord); 
-            if (coord != Coord {0, 0}) { 
-                if (dclic) {
-                    juego->sucesos ()->celdaSeleccionada (coord);
-                } else if (sclic) {
-                    juego->sucesos ()->celdaPulsada (coord);
-                }
+        case ZonaTablero::celda: {
+            Coord celda {dato_1, dato_2};
+            if (suceso == unir2d::SucesoZona::entra) {
+                juego->sucesos ()->entrandoCelda (celda);
+            } else if (suceso == unir2d::SucesoZona::sale) {
+                juego->sucesos ()->saliendoCelda (celda);
+            } else if (suceso == unir2d::SucesoZona::dobleClic) {
+                juego->sucesos ()->celdaSeleccionada (celda);
+            } else if (suceso == unir2d::SucesoZona::pulsa && ! unir2d::Raton::dobleClic ()) {
+                juego->sucesos ()->celdaPulsada (celda);
             }
+            break;
         }
-    }
-
-
-    void ActorTablero::controlAyudaPulsacion () {
-        bool dclic = unir2d::Raton::dobleClic ();
-        bool sclic = unir2d::Raton::pulsando (unir2d::BotonRaton::izquierda);
-        if (sclic) {
-            Vector separa {unir2d::Raton::posicion () - PresenciaTablero::centro_ayuda};  
-            if (unir2d::norma (separa) < PresenciaTablero::radio_ayuda) {
+        case ZonaTablero::ayuda:
+            if (suceso == unir2d::SucesoZona::pulsa) {
                 juego->sucesos ()->ayudaSeleccionada ();
             }
+            break;
         }
     }
 
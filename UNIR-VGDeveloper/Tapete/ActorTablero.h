@@ -18,6 +18,11 @@ namespace tapete {
         static constexpr int columnasGraficoMuros = RejillaTablero::columnas * 3 - 2;
         using GraficoMuros = std::array <const char [columnasGraficoMuros + 1], RejillaTablero::filas>;
 
+        // planos de las zonas del ratón (véase unir2d::ZonasRaton)
+        static constexpr int planoPaneles = 0;
+        static constexpr int planoCeldas  = 1;
+        static constexpr int planoFichas  = 2;
+
 
         ActorTablero (JuegoMesaBase * juego);
         ~ActorTablero ();
@@ -58,8 +63,8 @@ namespace tapete {
 
         template <typename S>
         void escribeMonitor (
-                const std::vector <S> & mensaje, 
-                const std::vector <S> & indica  );
+                const unir2d::VectorCiclo <S> & mensaje, 
+                const unir2d::VectorCiclo <S> & indica  );
 
         void muestraDisplay (int digito_1, int digito_2);
         void borraDisplay ();
@@ -99,32 +104,21 @@ namespace tapete {
         string archivo_sonido_desplaza {};
         int    volumen_sonido_desplaza {};
 
-        struct SobreRetrato {
-            bool        esta {false};  
-            LadoTablero lado {};
-        };
-        SobreRetrato sobre_retrato {};
-        struct SobreHabilidad {
-            bool        esta {false};  
-            LadoTablero lado {};
-            int         indice {};
-        };
-        SobreHabilidad sobre_habilidad {};
-        struct SobreCelda {
-            bool  esta {false};
-            Coord celda {};
+        // las claves de las zonas del ratón llevan el tipo de zona en los bits 16 y siguientes, 
+        // y dos datos en los bits 8 a 15 y 0 a 7
+        enum class ZonaTablero {
+            retrato,
+            habilidad,
+            celda,
+            ayuda
         };
-        SobreCelda sobre_celda {};
+        int receptor_zonas {-1};
 
         void calculaSitiosMuros ();
 
-        void controlSobreRetrato ();
-        void controlSobreHabilidad ();
-        void controlRetratoPulsacion ();
-        void controlHabilidadPulsacion ();
-        void controlSobreCelda ();
-        void controlCeldaPulsacion ();
-        void controlAyudaPulsacion ();
+        void registraZonas ();
+        void sucesoZona (unir2d::SucesoZona suceso, int clave);
+        static int claveZona (ZonaTablero zona, int dato_1, int dato_2);
 
         static void aserta (bool expresion, const string & mensaje);
 
@@ -140,8 +134,8 @@ namespace tapete {
 
     template <typename S>
     void ActorTablero::escribeMonitor (
-            const std::vector <S> & mensaje, 
-            const std::vector <S> & indica  ) {
+            const unir2d::VectorCiclo <S> & mensaje, 
+            const unir2d::VectorCiclo <S> & indica  ) {
         aserta (mensaje.size () + indica.size () <= PresenciaTablero::lineas_texto_monitor,
                 "excesivo número de línea a escribir");
         //
@@ -19,6 +19,7 @@ namespace tapete {
 
 
     void CuadroIndica::prepara () {
+        unir2d::RegistroRecursos::Propietario propietario {"CuadroIndica"};
         rectangl_indica = new unir2d::Rectangulo ();
         trazos_indica   = new unir2d::Trazos ();
         texto_indica    = new unir2d::Texto ("DejaVuSans");
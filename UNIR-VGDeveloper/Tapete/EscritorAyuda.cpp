@@ -218,8 +218,8 @@ namespace tapete {
             break;
         }
         listado.escribe (std::format (L"    * {} ({})", habilidad->nombre (), tipo)); 
-        std::vector <wstring> describe = parrafea (68, habilidad->descripcion ());
-        for (const wstring & parrafo : describe) {
+        unir2d::VectorCiclo <std::wstring_view> describe = parrafea (68, habilidad->descripcion ());
+        for (std::wstring_view parrafo : describe) {
             listado.escribe (std::format (L"      {}", parrafo));        
         }
         wstring linea {L"    "};
@@ -341,8 +341,10 @@ namespace tapete {
     }
 
 
-    std::vector <wstring> EscritorAyuda::parrafea (int anchura, const wstring & parrafo) {
-        std::vector <wstring> lineas {};
+    // Las líneas son vistas de 'parrafo', que debe existir mientras se usan.
+    unir2d::VectorCiclo <std::wstring_view> EscritorAyuda::parrafea (int anchura, const wstring & parrafo) {
+        std::wstring_view texto {parrafo};
+        unir2d::VectorCiclo <std::wstring_view> lineas {};
         int inicio = 0;
         while (true) {
             if (inicio >= parrafo.length ()) {
@@ -350,12 +352,12 @@ namespace tapete {
             }
             int sigue = inicio + anchura;
             if (sigue >= parrafo.length ()) {
-                lineas.push_back (parrafo.substr (inicio, anchura));
+                lineas.push_back (texto.substr (inicio, anchura));
                 return lineas;
             }
             while (true) {
                 if (parrafo.at (sigue) == ' ') {
-                    lineas.push_back (parrafo.substr (inicio, sigue - inicio));
+                    lineas.push_back (texto.substr (inicio, sigue - inicio));
                     inicio = sigue + 1;
                     break;
                 }
@@ -46,7 +46,7 @@ namespace tapete {
                 const SistemaAtaque::CambioEfecto & registro);
 
 
-        static std::vector <wstring> parrafea (int anchura, const wstring & parrafo); 
+        static unir2d::VectorCiclo <std::wstring_view> parrafea (int anchura, const wstring & parrafo); 
 
 
     };
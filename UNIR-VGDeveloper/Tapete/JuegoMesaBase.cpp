@@ -32,6 +32,15 @@ namespace tapete {
     }
 
 
+    string JuegoMesaBase::nombreEstado () const {
+        ModoJuegoComun * modo_comun = dynamic_cast <ModoJuegoComun *> (modo_);
+        if (modo_comun == nullptr) {
+            return string {};
+        }
+        return modo_comun->estado ().nombre ();
+    }
+
+
     SucesosJuegoComun * JuegoMesaBase::sucesos () {
         return sucesos_;
     }
@@ -179,11 +188,6 @@ namespace tapete {
     }
 
 
-    unir2d::Tiempo & JuegoMesaBase::tiempoCalculo () {
-        return tiempo_calculo;
-    }
-
-
     const std::vector <wstring> & JuegoMesaBase::nombresAlumnos () const {
         return nombres_alumnos_;
     }
@@ -292,7 +296,6 @@ namespace tapete {
 
     void JuegoMesaBase::posactualiza (double tiempo_seg) {
         controlTeclado ();
-        controlTiempo  ();
     }
 
 
@@ -309,13 +312,6 @@ namespace tapete {
     }
 
 
-    void JuegoMesaBase::controlTiempo () {
-        if (tiempo_calculo.iniciado ()) {
-            sucesos_->alarmaCalculo (tiempo_calculo);
-        }
-    }
-
-
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 
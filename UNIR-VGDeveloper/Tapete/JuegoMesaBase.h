@@ -32,8 +32,6 @@ namespace tapete {
         ModoJuegoBase *     modo ();  
         SistemaAtaque     & sistemaAtaque ();
 
-        unir2d::Tiempo & tiempoCalculo ();
-
     protected:
 
         static string carpeta_activos_comun;
@@ -92,13 +90,11 @@ namespace tapete {
         ModoJuegoBase *     modo_ {};
         SistemaAtaque       ataque_  {this};
 
-        unir2d::Tiempo tiempo_calculo {};
-
 
         void regionVentana (Vector & posicion, Vector & tamano) const override;
+        string nombreEstado () const override;
 
         void controlTeclado ();
-        void controlTiempo ();
 
     };
 
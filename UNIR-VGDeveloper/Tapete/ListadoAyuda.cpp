@@ -20,18 +20,19 @@ namespace tapete {
 
 
     void ListadoAyuda::prepara () {
-        papel = new unir2d::Rectangulo (region.ancho (), region.alto ());
+        unir2d::RegistroRecursos::Propietario propietario {"ListadoAyuda"};
+        papel = lote_dibujos.crea <unir2d::Rectangulo> (region.ancho (), region.alto ());
         papel->ponIndiceZ (1);
         papel->ponPosicion (region.posicion ());
         //
         Vector poscn_izqrd = region.posicion () + Vector {3, 6};
         Vector poscn_derch = region.posicion () + Vector {region.tamano ().x () - 6 * 2, 6};
         for (int indc = 0; indc < cuentaBoquetes; ++ indc) {
-            boquetes_izqrd [indc] = new unir2d::Circulo (4);
+            boquetes_izqrd [indc] = lote_dibujos.crea <unir2d::Circulo> (4);
             boquetes_izqrd [indc]->ponIndiceZ (1);
             boquetes_izqrd [indc]->ponPosicion (poscn_izqrd);
             boquetes_izqrd [indc]->ponColor (Color::Gris);
-            boquetes_derch [indc] = new unir2d::Circulo (4);
+            boquetes_derch [indc] = lote_dibujos.crea <unir2d::Circulo> (4);
             boquetes_derch [indc]->ponIndiceZ (1);
             boquetes_derch [indc]->ponPosicion (poscn_derch);
             boquetes_derch [indc]->ponColor (Color::Gris);
@@ -39,9 +40,9 @@ namespace tapete {
             poscn_derch += Vector {0, 20};
         }
         //
-        trazos_izqrd = new unir2d::Trazos ();
+        trazos_izqrd = lote_dibujos.crea <unir2d::Trazos> ();
         trazos_izqrd->ponIndiceZ (1);
-        trazos_derch = new unir2d::Trazos ();
+        trazos_derch = lote_dibujos.crea <unir2d::Trazos> ();
         trazos_derch->ponIndiceZ (1);
         Vector punto_izqrd = region.posicion () + Vector {17, 4};
         Vector punto_derch = region.posicion () + Vector {region.tamano ().x (), 0} + Vector {-17, 4};
@@ -55,11 +56,11 @@ namespace tapete {
         }
         //
         constexpr int margen = 10;
-        sombra_derch = new unir2d::Rectangulo (margen, region.alto ());
+        sombra_derch = lote_dibujos.crea <unir2d::Rectangulo> (margen, region.alto ());
         sombra_derch->ponIndiceZ (1);
         sombra_derch->ponPosicion (Vector {region.posicion ().x () + region.ancho (), region.posicion ().y () + margen});
         sombra_derch->ponColor (Color {0, 0, 0, 80});
-        sombra_abajo = new unir2d::Rectangulo (region.ancho () - margen, margen);
+        sombra_abajo = lote_dibujos.crea <unir2d::Rectangulo> (region.ancho () - margen, margen);
         sombra_abajo->ponIndiceZ (1);
         sombra_abajo->ponPosicion (Vector {region.posicion ().x () + margen, region.posicion ().y () + region.alto ()});
         sombra_abajo->ponColor (Color {0, 0, 0, 80});
@@ -76,11 +77,11 @@ namespace tapete {
         //
         Vector poscn = region.posicion () + Vector {25, 9};
         for (int indc = 0; indc < lineasTextoListado; ++ indc) {
-            texto_claro  [indc] = new unir2d::Texto ("DejaVuSansMono");
+            texto_claro  [indc] = lote_dibujos.crea <unir2d::Texto> ("DejaVuSansMono");
             texto_claro  [indc]->ponIndiceZ (1);
             texto_claro  [indc]->ponTamano (12);
             texto_claro  [indc]->ponColor (Color::GrisOscuro);
-            texto_oscuro [indc] = new unir2d::Texto ("DejaVuSansMono-Bold");
+            texto_oscuro [indc] = lote_dibujos.crea <unir2d::Texto> ("DejaVuSansMono-Bold");
             texto_oscuro [indc]->ponIndiceZ (1);
             texto_oscuro [indc]->ponTamano (12);
             texto_oscuro [indc]->ponColor (Color::GrisOscuro);
@@ -91,14 +92,14 @@ namespace tapete {
             poscn += Vector {0, 14};
         }
         //
-        sigue_arriba = new unir2d::Texto ("DejaVuSansMono-Bold");
+        sigue_arriba = lote_dibujos.crea <unir2d::Texto> ("DejaVuSansMono-Bold");
         sigue_arriba->ponIndiceZ (1);
         sigue_arriba->ponTamano (12);
         sigue_arriba->ponColor (Color::GrisOscuro);
         sigue_arriba->ponCadena ("(sigue...)");
         poscn = region.posicion () + Vector {tamano.x () - 92, 9};
         sigue_arriba->ponPosicion (poscn);
-        sigue_abajo  = new unir2d::Texto ("DejaVuSansMono-Bold");
+        sigue_abajo  = lote_dibujos.crea <unir2d::Texto> ("DejaVuSansMono-Bold");
         sigue_abajo ->ponIndiceZ (1);
         sigue_abajo ->ponTamano (12);
         sigue_abajo ->ponColor (Color::GrisOscuro);
@@ -113,31 +114,17 @@ namespace tapete {
 
 
     void ListadoAyuda::libera () {
-        delete sigue_arriba;
-        delete sigue_abajo;
+        lote_dibujos.libera ();
         sigue_arriba = nullptr;
         sigue_abajo  = nullptr;
-        for (int indc = 0; indc < lineasTextoListado; ++ indc) {
-            delete texto_claro  [indc];
-            delete texto_oscuro [indc];
-            texto_claro  [indc] = nullptr;
-            texto_oscuro [indc] = nullptr;
-        }
-        delete sombra_abajo;
-        delete sombra_derch;
+        texto_claro .fill (nullptr);
+        texto_oscuro.fill (nullptr);
         sombra_abajo = nullptr;
         sombra_derch = nullptr;
-        delete trazos_derch;
-        delete trazos_izqrd;
         trazos_derch = nullptr;
         trazos_izqrd = nullptr;
-        for (int indc = 0; indc < cuentaBoquetes; ++ indc) {
-            delete boquetes_izqrd [indc];
-            delete boquetes_derch [indc];
-            boquetes_izqrd [indc] = nullptr;
-            boquetes_derch [indc] = nullptr;
-        }
-        delete papel;
+        boquetes_izqrd.fill (nullptr);
+        boquetes_derch.fill (nullptr);
         papel = nullptr;
     }
 
@@ -48,6 +48,8 @@ namespace tapete {
 
         bool visible {};  
 
+        unir2d::LoteDibujos                            lote_dibujos {};
+
         unir2d::Rectangulo *                           papel;
         std::array <unir2d::Circulo *, cuentaBoquetes> boquetes_izqrd;
         std::array <unir2d::Circulo *, cuentaBoquetes> boquetes_derch;
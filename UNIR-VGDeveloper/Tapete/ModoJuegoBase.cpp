@@ -11,6 +11,8 @@ namespace tapete {
 
     ModoJuegoBase::ModoJuegoBase (JuegoMesaBase * juego) {
         this->juego_ = juego;
+        // la semilla del juego permite repetir una partida al reproducir su entrada grabada
+        generador_azar.seed (juego->semilla ());
         lado_equipo_inicial = LadoTablero::nulo;
         lado_equipo_actual  = LadoTablero::nulo;
     }
@@ -1081,7 +1083,7 @@ namespace tapete {
         //
         asertaHabilidadArea ("atacaArea", true);
         // 
-        std::vector <ActorPersonaje *> lista_oponentes {};
+        unir2d::VectorCiclo <ActorPersonaje *> lista_oponentes {};
         personajesAreaCeldas (lista_oponentes);
         //
         juego_->sistemaAtaque ().calcula (
@@ -1123,16 +1125,6 @@ namespace tapete {
     //----------------------------------------------------------------------------------------------
 
 
-    void ModoJuegoBase::iniciaTiempoCalculo () {
-        juego_->tiempoCalculo ().inicia ();
-    }
-
-
-    void ModoJuegoBase::terminaTiempoCalculo () {
-        juego_->tiempoCalculo ().termina ();
-    }
-
-
     //----------------------------------------------------------------------------------------------
 
 
@@ -1232,10 +1224,8 @@ namespace tapete {
 
 
     int ModoJuegoBase::azarosa (unsigned int contador) {
-	    std::random_device semilla {};
-        std::mt19937 generador {semilla ()};
 	    std::uniform_int_distribution <unsigned int> distrb {0, contador - 1};
-        return distrb (generador);
+        return distrb (generador_azar);
     }
 
 
@@ -1292,7 +1282,7 @@ namespace tapete {
 
 
     void ModoJuegoBase::personajesAreaCeldas (
-            std::vector <ActorPersonaje *> & lista_oponentes) const {
+            unir2d::VectorCiclo <ActorPersonaje *> & lista_oponentes) const {
         for (int indc_radio = 0; indc_radio < area_celdas.size (); ++ indc_radio) {
             for (Coord celda : area_celdas [indc_radio]) {
                 for (ActorPersonaje * persj : juego_->personajes ()) {
@@ -115,9 +115,6 @@ namespace tapete {
         void ocultaAtaqueArea ();
         void atacaArea ();
 
-        void iniciaTiempoCalculo ();
-        void terminaTiempoCalculo ();
-
         void muestraIndicaActuante  (LadoTablero lado);
         void muestraIndicaHabilidad (LadoTablero lado, int indice_habilidad);
         void muestraIndicaFicha     (ActorPersonaje * personaje);    
@@ -205,6 +202,7 @@ namespace tapete {
         AreaCentradaCeldas   area_celdas {};
 
         int valor_aleatorio_100 {};
+        std::mt19937 generador_azar {};
 
         InformesProceso informes_proceso {};
 
@@ -213,14 +211,14 @@ namespace tapete {
         inline static Color color_objetivo = Color::Marron;
 
 
-        static int azarosa (unsigned int contador);
+        int azarosa (unsigned int contador);
 
         int   puntosEnJuegoCamino   (Coord proxima_celda) const;
         float distanciaCeldas (Coord celda_origen, Coord celda_destino) const;
 
         void marcaCeldasArea ();
         void desmarcaCeldasArea ();
-        void personajesAreaCeldas (std::vector <ActorPersonaje *> & lista_oponentes) const;
+        void personajesAreaCeldas (unir2d::VectorCiclo <ActorPersonaje *> & lista_oponentes) const;
 
         void iniciaPersonajes ();
         void restauraPersonajes ();
@@ -18,6 +18,7 @@ namespace tapete {
 
     ModoJuegoComun::~ModoJuegoComun () {
         validaEstado ({ EstadoJuegoComun::terminal });
+        unir2d::Rutinas::cancela (rutina_calculo);
         //
     }
 
@@ -502,14 +503,13 @@ namespace tapete {
             //
             if (habilidadAccion ()->antagonista () == Antagonista::aliado) {
                 ModoJuegoBase::atacaOponente ();
-            } else {
-                ModoJuegoBase::iniciaTiempoCalculo ();
             }
             //
             if (habilidadAccion ()->antagonista () == Antagonista::aliado) {
                 estado ().transita (EstadoJuegoComun::oponenteHabilidadResultado);
             } else {
                 estado ().transita (EstadoJuegoComun::oponenteHabilidadCalculando);
+                rutina_calculo = unir2d::Rutinas::lanza (calculaHabilidadOponente ());
             }
             validaAtributos ();
             informaProceso ("efectuaHabilidadOponente");
@@ -520,31 +520,21 @@ namespace tapete {
     }
 
 
-    void ModoJuegoComun::calculaHabilidadOponente (unir2d::Tiempo & tiempo) {
+    unir2d::Rutina ModoJuegoComun::calculaHabilidadOponente () {
+        co_await animaCalculo (EstadoJuegoComun::oponenteHabilidadCalculando);
+        if (estado () != EstadoJuegoComun::oponenteHabilidadCalculando) {
+            co_return;
+        }
         try {
             validaEstado ({ EstadoJuegoComun::oponenteHabilidadCalculando });
                             //  elegidos ambos, con atacante (no agotado), modo acción habilidad   
                             //  sin etapas camino, con habilidad oponente, con oponente, sin celda área
             //
-            double segundos = tiempo.segundos ();
-            if (segundos < segundos_calculo) {
-                ModoJuegoBase::alea100 ();
-                ModoJuegoBase::muestraAleatorio100 ();
-            } else {                
-                ModoJuegoBase::terminaTiempoCalculo ();
-                ModoJuegoBase::atacaOponente ();
-            }
+            ModoJuegoBase::atacaOponente ();
             //
-            if (segundos < segundos_calculo) {
-                // este transito no aporta nada y confunde mucho 
-                //estado ().transita (EstadoJuegoComun::oponenteHabilidadCalculando);
-            } else {
-                estado ().transita (EstadoJuegoComun::oponenteHabilidadResultado);
-            }
+            estado ().transita (EstadoJuegoComun::oponenteHabilidadResultado);
             validaAtributos ();
-            if (segundos >= segundos_calculo) {
-                informaProceso ("calculaHabilidadOponente");
-            }
+            informaProceso ("calculaHabilidadOponente");
             escribeEstado ();
         } catch (const std::exception & excepcion) {
             excepciona ("calculaHabilidadOponente", excepcion);
@@ -660,14 +650,13 @@ namespace tapete {
             //
             if (habilidadAccion ()->antagonista () == Antagonista::aliado) {
                 ModoJuegoBase::atacaArea ();
-            } else {
-                ModoJuegoBase::iniciaTiempoCalculo ();
             }
             //
             if (habilidadAccion ()->antagonista () == Antagonista::aliado) {
                 estado ().transita (EstadoJuegoComun::areaHabilidadResultado);
             } else {
                 estado ().transita (EstadoJuegoComun::areaHabilidadCalculando);
+                rutina_calculo = unir2d::Rutinas::lanza (calculaHabilidadArea ());
             }
             validaAtributos ();
             informaProceso ("efectuaHabilidadArea");
@@ -678,31 +667,21 @@ namespace tapete {
     }
 
 
-    void ModoJuegoComun::calculaHabilidadArea (unir2d::Tiempo & tiempo) {
+    unir2d::Rutina ModoJuegoComun::calculaHabilidadArea () {
+        co_await animaCalculo (EstadoJuegoComun::areaHabilidadCalculando);
+        if (estado () != EstadoJuegoComun::areaHabilidadCalculando) {
+            co_return;
+        }
         try {
             validaEstado ({ EstadoJuegoComun::areaHabilidadCalculando });
                             //  elegidos ambos, con atacante (no agotado), modo acción habilidad   
                             //  sin etapas camino, con habilidad área, sin oponente, con celda área
             //
-            double segundos = tiempo.segundos ();
-            if (segundos < segundos_calculo) {
-                ModoJuegoBase::alea100 ();
-                ModoJuegoBase::muestraAleatorio100 ();
-            } else {
-                ModoJuegoBase::terminaTiempoCalculo ();
-                ModoJuegoBase::atacaArea ();
-            }
+            ModoJuegoBase::atacaArea ();
             //
-            if (segundos < segundos_calculo) {
-                // este transito no aporta nada y confunde mucho 
-                //estado ().transita (EstadoJuegoComun::areaHabilidadCalculando);
-            } else {
-                estado ().transita (EstadoJuegoComun::areaHabilidadResultado);
-            }
+            estado ().transita (EstadoJuegoComun::areaHabilidadResultado);
             validaAtributos ();
-            if (segundos >= segundos_calculo) {
-                informaProceso ("calculaHabilidadArea");
-            }
+            informaProceso ("calculaHabilidadArea");
             escribeEstado ();
         } catch (const std::exception & excepcion) {
             excepciona ("calculaHabilidadArea", excepcion);
@@ -710,6 +689,32 @@ namespace tapete {
     }
 
 
+    unir2d::Rutina ModoJuegoComun::animaCalculo (int calculando) {
+        // Los dígitos cambian en cada ciclo hasta que pasa el tiempo del cálculo o cambia el 
+        // estado. Mientras se muestra la ayuda, se espera a que se oculte y se vuelva al estado 
+        // del cálculo, que termina entonces si ya ha pasado su tiempo.
+        double final = unir2d::Rutinas::ahora () + segundos_calculo;
+        while (true) {
+            if (estado () == EstadoJuegoComun::mostrandoAyuda) {
+                co_await unir2d::Rutinas::esperaQue ([this] () { 
+                    return estado () != EstadoJuegoComun::mostrandoAyuda; 
+                });
+                continue;
+            }
+            if (estado () != calculando || unir2d::Rutinas::ahora () >= final) {
+                co_return;
+            }
+            try {
+                ModoJuegoBase::alea100 ();
+                ModoJuegoBase::muestraAleatorio100 ();
+            } catch (const std::exception & excepcion) {
+                excepciona ("animaCalculo", excepcion);
+            }
+            co_await unir2d::Rutinas::siguienteCiclo ();
+        }
+    }
+
+
     void ModoJuegoComun::revierteHabilidadArea () {
         try {
             validaEstado ({ 
@@ -1144,34 +1149,34 @@ namespace tapete {
         case EstadoJuegoComun::terminal:
             break;
         case EstadoJuegoComun::inicioJugada:
-            juego ()->tablero ()->escribeMonitor (std::vector <string>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *>
                     { "Selecciona el retrato para mover la",
                         "ficha o selecciona una habilidad."   },
                     {}                                        );
             break;
         case EstadoJuegoComun::preparacionDesplazamiento:
-            juego ()->tablero ()->escribeMonitor (std::vector <string>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *>
                     { "Marca el camino comenzando en la",
                       "ficha del personaje."             },
                     {}                                     );
             break;
         case EstadoJuegoComun::marcacionCaminoFicha:
-            juego ()->tablero ()->escribeMonitor (std::vector <string>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *>
                     { "Marca las etapas del camino. Despues",
                       "pulsa 'espacio' para mover la ficha",
                       "o 'Esc' para cancelar."               },
                     {}                                         );
             break;
         case EstadoJuegoComun::habilidadSimpleInvalida:
-            juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                     { L"La habilidad no se puede usar." },
-                    { habilidadAccion ()->nombre ()     });
+                    { habilidadAccion ()->nombre ().c_str ()     });
             break;
         case EstadoJuegoComun::habilidadSimpleConfirmacion:
-            juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                     { L"Pulsa 'espacio' para usar la",
                       L"habilidad, 'Esc' para cancelar."},
-                    { habilidadAccion ()->nombre () }     );
+                    { habilidadAccion ()->nombre ().c_str () }     );
             break;
         //case EstadoJuegoComun::habilidadSimpleCalculando:
         //    juego ()->tablero ()->escribeMonitor (std::vector <wstring>
@@ -1180,111 +1185,111 @@ namespace tapete {
         //            { habilidadAccion ()->nombre () }     );
         //    break;
         case EstadoJuegoComun::habilidadSimpleResultado:
-            juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                     { L"Habilidad usada.",
                       L"Pulsa 'espacio'.",
                       L"O pulsa en 'interrogación'."},
-                    { habilidadAccion ()->nombre () }     );
+                    { habilidadAccion ()->nombre ().c_str () }     );
             break;
         case EstadoJuegoComun::preparacionHabilidadOponente:
             if (habilidadAccion ()->antagonista () == Antagonista::aliado) {
-                juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+                juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                         { L"Selecciona un aliado." },
-                        { habilidadAccion ()->nombre () });
+                        { habilidadAccion ()->nombre ().c_str () });
             } else {
-                juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+                juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                         { L"Selecciona un oponente." },
-                        { habilidadAccion ()->nombre () });
+                        { habilidadAccion ()->nombre ().c_str () });
             }
             break;
         case EstadoJuegoComun::oponenteHabilidadInvalido:
             if (habilidadAccion ()->antagonista () == Antagonista::aliado) {
-                juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+                juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                         { L"La habilidad no se puede usar con",
                           L"ese aliado."                        },
                         { std::format (L"{} a favor de {}", 
                                     atacante ()->nombre (), 
-                                    oponente ()->nombre ()),
-                          habilidadAccion ()->nombre ()      });
+                                    oponente ()->nombre ()).c_str (),
+                          habilidadAccion ()->nombre ().c_str () });
             } else {
-                juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+                juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                         { L"La habilidad no se puede usar contra",
                           L"ese oponente."                        },
                         { std::format (L"{} contra {}", 
                                     atacante ()->nombre (), 
-                                    oponente ()->nombre ()),
-                          habilidadAccion ()->nombre ()      });
+                                    oponente ()->nombre ()).c_str (),
+                          habilidadAccion ()->nombre ().c_str () });
             }
             break;
         case EstadoJuegoComun::oponenteHabilidadConfirmacion:
             if (habilidadAccion ()->antagonista () == Antagonista::aliado) {
-                juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+                juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                         { L"Pulsa 'espacio' para usar la",
                           L"habilidad, 'Esc' para cancelar." },
                         { std::format (L"{} a favor de {}", 
                                     atacante ()->nombre (), 
-                                    oponente ()->nombre ()),
-                          habilidadAccion ()->nombre ()      });
+                                    oponente ()->nombre ()).c_str (),
+                          habilidadAccion ()->nombre ().c_str () });
             } else {
-                juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+                juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                         { L"Pulsa 'espacio' para usar la",
                           L"habilidad, 'Esc' para cancelar." },
                         { std::format (L"{} contra {}", 
                                     atacante ()->nombre (), 
-                                    oponente ()->nombre ()),
-                          habilidadAccion ()->nombre ()      });
+                                    oponente ()->nombre ()).c_str (),
+                          habilidadAccion ()->nombre ().c_str () });
             }
             break;
         case EstadoJuegoComun::oponenteHabilidadCalculando:
-            juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                     { L"Calculando.",
                       L"Espera."},
-                    { habilidadAccion ()->nombre () }     );
+                    { habilidadAccion ()->nombre ().c_str () }     );
             break;
         case EstadoJuegoComun::oponenteHabilidadResultado:
-            juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                     { L"Habilidad usada.",
                       L"Pulsa 'espacio'."},
-                    { habilidadAccion ()->nombre () }     );
+                    { habilidadAccion ()->nombre ().c_str () }     );
             break;
         case EstadoJuegoComun::preparacionHabilidadArea:
-            juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                     { L"Selecciona una celda para usar la",
                       L"habilidad sobre un área."          },
-                    { habilidadAccion ()->nombre () }        );
+                    { habilidadAccion ()->nombre ().c_str () }        );
             break;
         case EstadoJuegoComun::areaHabilidadInvalida:
-            juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                     { L"La habilidad no se puede usar sobre",
                       L"esas celdas."                         },
-                    { habilidadAccion ()->nombre () }          );
+                    { habilidadAccion ()->nombre ().c_str () }          );
             break;
         case EstadoJuegoComun::areaHabilidadConfirmacion:
-            juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                     { L"Pulsa 'espacio' para usar la",
                       L"habilidad, 'Esc' para cancelar." },
-                    { habilidadAccion ()->nombre () });
+                    { habilidadAccion ()->nombre ().c_str () });
             break;
         case EstadoJuegoComun::areaHabilidadCalculando:
-            juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                     { L"Calculando.",
                       L"Espera."},
-                    { habilidadAccion ()->nombre () }     );
+                    { habilidadAccion ()->nombre ().c_str () }     );
             break;
         case EstadoJuegoComun::areaHabilidadResultado:
-            juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                     { L"Habilidad usada.",
                       L"Pulsa 'espacio'."},
-                    { habilidadAccion ()->nombre () }     );
+                    { habilidadAccion ()->nombre ().c_str () }     );
             break;
         case EstadoJuegoComun::mostrandoAyuda:
-            juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                     { L"Pulsa la interrogación para cerrar ",
                       L"la ayuda."},
                     {  }     );
             break;
         case EstadoJuegoComun::finalPartida:
-            juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                     { L"Agotados todos los rondas de juego",
                       L"La partida ha terminado."            },
                     {}                                         );
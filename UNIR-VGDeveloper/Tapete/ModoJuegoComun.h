@@ -46,13 +46,13 @@ namespace tapete {
         void evaluaHabilidadOponente   (int indice_habilidad);
         void evaluaHabilidadOponente   (ActorPersonaje * personaje);
         void efectuaHabilidadOponente  ();
-        void calculaHabilidadOponente  (unir2d::Tiempo & tiempo);
+        unir2d::Rutina calculaHabilidadOponente ();
         void revierteHabilidadOponente ();
         
         void evaluaHabilidadArea   (int indice_habilidad);
         void evaluaHabilidadArea   (Coord celda);
         void efectuaHabilidadArea  ();
-        void calculaHabilidadArea  (unir2d::Tiempo & tiempo);
+        unir2d::Rutina calculaHabilidadArea ();
         void revierteHabilidadArea ();
     
 //        virtual void asumeHabilidad ();
@@ -114,6 +114,10 @@ namespace tapete {
 
         static constexpr double segundos_calculo = 1.0;
 
+        int64_t rutina_calculo {};
+
+        unir2d::Rutina animaCalculo (int calculando);
+
     };
 
 
@@ -200,20 +200,20 @@ namespace tapete {
         switch (estado ()) {
         case EstadoJuegoEquipo::inicioRonda:
             if (ronda () == 1) {
-                juego ()->tablero ()->escribeMonitor (std::vector <string> 
+                juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *> 
                         { "Inicio de la partida.",
                           "Ronda de juego 1.",
                           "Pulsa 'espacio'."      },
                         {}                          );
             } else {
-                juego ()->tablero ()->escribeMonitor (std::vector <string> 
-                        { std::format ("Ronda de juego {}.", this->ronda ()),
+                juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *> 
+                        { std::format ("Ronda de juego {}.", this->ronda ()).c_str (),
                           "Pulsa 'espacio'."                                  },
                         {}                                                      );
             }
             break;
         case EstadoJuegoEquipo::inicioTurno:
-            juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                     { L"Nueva turno de juego.",
                       L"Pulsa 'espacio'."                       },
                     {}                                            );
@@ -277,27 +277,27 @@ namespace tapete {
         switch (estado ()) {
         case EstadoJuegoLibreDoble::inicioRonda:
             if (ronda () == 1) {
-                juego ()->tablero ()->escribeMonitor (std::vector <string> 
+                juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *> 
                         { "Inicio de la partida.",
                           "Ronda de juego 1.",
                           "Pulsa 'espacio'."      },
                         {}                          );
             } else {
-                juego ()->tablero ()->escribeMonitor (std::vector <string> 
-                        { std::format ("Ronda de juego {}.", this->ronda ()),
+                juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *> 
+                        { std::format ("Ronda de juego {}.", this->ronda ()).c_str (),
                           "Pulsa 'espacio'."                                  },
                         {}                                                      );
             }
             break;
         case EstadoJuegoLibreDoble::inicioTurnoNoElegido:
             if (ladoEquipoActual () == LadoTablero::Izquierda) {
-                juego ()->tablero ()->escribeMonitor (std::vector <string>  
+                juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *>  
                         { "Selecciona un personaje del equipo",
                           "rojo.",
                           "Pulsa un retrato."            },
                         {}                                             );
             } else {
-                juego ()->tablero ()->escribeMonitor (std::vector <string> 
+                juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *> 
                         { "Selecciona un personaje del equipo",
                           "azul.",
                           "Pulsa un retrato."       },
@@ -305,7 +305,7 @@ namespace tapete {
             }
             break;
         case EstadoJuegoLibreDoble::inicioTurnoConfirmacion:
-            juego ()->tablero ()->escribeMonitor (std::vector <string>  
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *>  
                     { "Pulsa 'espacio' para confirmar, 'Esc'",
                       "para reintentar."                      },
                     {}                                          );
@@ -316,14 +316,14 @@ namespace tapete {
             } else {
                 juga = "Segunda jugada.";
             }
-            juego ()->tablero ()->escribeMonitor (std::vector <string>
-                    { juga,
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *>
+                    { juga.c_str (),
                         "Selecciona el retrato para mover la",
                         "ficha o selecciona una habilidad."   },
                     {}                                        );
             break;
         case EstadoJuegoLibreDoble::agotadosPuntosAccion:
-            juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                     { L"Puntos de acción agotados.",
                       L"Pulsa 'espacio'."           },
                     {}                               );
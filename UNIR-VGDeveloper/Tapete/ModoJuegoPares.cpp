@@ -288,31 +288,31 @@ namespace tapete {
         switch (estado ()) {
         case EstadoJuegoPares::inicioRonda:
             if (ronda () == 1) {
-                juego ()->tablero ()->escribeMonitor (std::vector <string> 
+                juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *> 
                         { "Inicio de la partida.",
                           "Ronda de juego 1.",
                           "Pulsa 'espacio'."      },
                         {}                          );
             } else {
-                juego ()->tablero ()->escribeMonitor (std::vector <string> 
-                        { std::format ("Ronda de juego {}.", this->ronda ()),
+                juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *> 
+                        { std::format ("Ronda de juego {}.", this->ronda ()).c_str (),
                           "Pulsa 'espacio'."                                  },
                         {}                                                      );
             }
             break;
         case EstadoJuegoPares::inicioTurnoNoElegidos:
             if (ronda () == 1 && turno () == 1) {
-                juego ()->tablero ()->escribeMonitor (std::vector <string> 
+                juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *> 
                         { "Selecciona un personaje.",
                           "Pulsa un retrato." },
                         {}                                  );
             } else {
                 if (turno () == 1) {
-                    juego ()->tablero ()->escribeMonitor (std::vector <string> 
+                    juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *> 
                             { "Selecciona un personaje." },
                             {}                             );
                 } else {
-                    juego ()->tablero ()->escribeMonitor (std::vector <string> 
+                    juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *> 
                             { "Nueva turno de juego.",
                               "Selecciona un personaje." },
                             {}                             );
@@ -321,31 +321,31 @@ namespace tapete {
             break;
         case EstadoJuegoPares::inicioTurnoElegidoUno:
             if (personajeElegido (LadoTablero::Izquierda) == nullptr) {
-                juego ()->tablero ()->escribeMonitor (std::vector <string>  
+                juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *>  
                         { "Selecciona un segundo personaje del",
                           "equipo rojo."                        },
                         {}                                        );
             } else {
-                juego ()->tablero ()->escribeMonitor (std::vector <string> 
+                juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *> 
                         { "Selecciona un segundo personaje del",
                           "equipo azul."                        },
                         {}                                        );           
             }
             break;
         case EstadoJuegoPares::inicioTurnoConfirmacion:
-            juego ()->tablero ()->escribeMonitor (std::vector <string>  
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const char *>  
                     { "Pulsa 'espacio' para confirmar, 'Esc'",
                       "para reintentar."                      },
                     {}                                          );
             break;
         case EstadoJuegoPares::agotadosPuntosAccion:
-            juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                     { L"Puntos de acción agotados.",
                       L"Pulsa 'espacio'."           },
                     {}                               );
             break;
         case EstadoJuegoPares::finalTurno:
-            juego ()->tablero ()->escribeMonitor (std::vector <wstring>
+            juego ()->tablero ()->escribeMonitor (unir2d::VectorCiclo <const wchar_t *>
                     { L"Agotados los puntos de acción de AMBOS",
                       L"personajes.",
                       L"Pulsa 'espacio'."                       },
@@ -22,6 +22,7 @@ namespace tapete {
 
 
     void PresenciaActuante::prepara () {
+        unir2d::RegistroRecursos::Propietario propietario {"PresenciaActuante"};
         preparaPaneles ();
         preparaPersonaje ();
         preparaHabilidades ();
@@ -34,6 +35,13 @@ namespace tapete {
 
 
     void PresenciaActuante::libera () {
+        // ActorTablero::termina () extrae todos los dibujos antes de llamar a este método, y con 
+        // ellos el nodo; si no, se extrae aquí
+        if (nodo_panel.actor () != nullptr) {
+            actor_tablero->extraeNodo (& nodo_panel);
+        }
+        nodo_panel.extraeDibujos ();
+        //
         delete imagen_barra_vida;
         imagen_barra_vida = nullptr;
         if (textura_barras_vida->cuentaUsos () == 0) {
@@ -98,6 +106,9 @@ namespace tapete {
             x += 52;
         }
         //
+        nodo_panel.ponPosicion (panel_abajo.posicion ());
+        nodo_panel.ponVisible (false);
+        actor_tablero->agregaNodo (& nodo_panel);
     }
 
 
@@ -109,10 +120,9 @@ namespace tapete {
         //
         imagen_marco_personaje = new unir2d::Imagen {};
         imagen_marco_personaje->asigna (textura_marco_personaje);
-        imagen_marco_personaje->ponPosicion (panel_abajo.posicion () + Vector {0, 20});
-        imagen_marco_personaje->ponVisible (false);
+        imagen_marco_personaje->ponPosicion (Vector {0, 20});
         //
-        actor_tablero->agregaDibujo (imagen_marco_personaje);
+        nodo_panel.agregaDibujo (imagen_marco_personaje);
     }
 
 
@@ -122,17 +132,16 @@ namespace tapete {
             textura_marco_habilidad->carga (JuegoMesaBase::carpetaActivos () + "marco_habilidad.png");
         }
         //
-        Vector poscn = panel_abajo.posicion () + Vector {81, 34};
+        Vector poscn = Vector {81, 34};
         for (int indc = 0; indc < cuentaHabilidades; ++ indc) {
             imagen_marco_habilidad [indc] = new unir2d::Imagen {};
             imagen_marco_habilidad [indc]->asigna (textura_marco_habilidad);
             imagen_marco_habilidad [indc]->ponPosicion (poscn);
             poscn += Vector {52, 0};
-            imagen_marco_habilidad [indc]->ponVisible (false);
         }
         //
         for (int indc = 0; indc < PresenciaActuante::cuentaHabilidades; ++ indc) {
-            actor_tablero->agregaDibujo (imagen_marco_habilidad [indc]);
+            nodo_panel.agregaDibujo (imagen_marco_habilidad [indc]);
         }
     }
 
@@ -144,18 +153,17 @@ namespace tapete {
             textura_luces_punto_accion->carga (JuegoMesaBase::carpetaActivos () + "piloto_colores.png");
         }
         // 
-        Vector poscn = panel_abajo.posicion () + Vector {74, 0};
+        Vector poscn = Vector {74, 0};
         for (int indc = 0; indc < cuentaPuntosAccion; ++ indc) {
             imagen_luces_punto_accion [indc] = new unir2d::Imagen {};
             imagen_luces_punto_accion [indc]->asigna (textura_luces_punto_accion);
             imagen_luces_punto_accion [indc]->defineEstampas (1, 25);
             imagen_luces_punto_accion [indc]->ponPosicion (poscn);
             poscn += Vector {26, 0};
-            imagen_luces_punto_accion [indc]->ponVisible (false);
         }
         //
         for (int indc = 0; indc < PresenciaActuante::cuentaPuntosAccion; ++ indc) {
-            actor_tablero->agregaDibujo (imagen_luces_punto_accion [indc]);
+            nodo_panel.agregaDibujo (imagen_luces_punto_accion [indc]);
         }
     }
 
@@ -168,10 +176,9 @@ namespace tapete {
         imagen_barra_vida = new unir2d::Imagen {};
         imagen_barra_vida->asigna (textura_barras_vida);
         imagen_barra_vida->defineEstampas (cuentaBarrasVida, 1);
-        imagen_barra_vida->ponPosicion (panel_abajo.posicion () + Vector {81, 96});
-        imagen_barra_vida->ponVisible (false);
+        imagen_barra_vida->ponPosicion (Vector {81, 96});
         //
-        actor_tablero->agregaDibujo (imagen_barra_vida);
+        nodo_panel.agregaDibujo (imagen_barra_vida);
     }
 
 
@@ -183,19 +190,20 @@ namespace tapete {
         //
         imagen_marca_retrato = new unir2d::Imagen {};
         imagen_marca_retrato->asigna (textura_marca);
-        imagen_marca_retrato->ponPosicion (panel_retrato.posicion () + Vector {5, 70});
+        imagen_marca_retrato->ponPosicion (panel_retrato.posicion () - panel_abajo.posicion () + Vector {5, 70});
         imagen_marca_retrato->ponVisible (false);
         //
         for (int indc = 0; indc < PresenciaActuante::cuentaHabilidades; ++ indc) {
             imagen_marca_habilidad [indc] = new unir2d::Imagen {};
             imagen_marca_habilidad [indc]->asigna (textura_marca);
-            imagen_marca_habilidad [indc]->ponPosicion (paneles_habilidad [indc].posicion () + Vector {-9, 45});
+            imagen_marca_habilidad [indc]->ponPosicion (
+                    paneles_habilidad [indc].posicion () - panel_abajo.posicion () + Vector {-9, 45});
             imagen_marca_habilidad [indc]->ponVisible (false);
         }
         //
-        actor_tablero->agregaDibujo (imagen_marca_retrato);
+        nodo_panel.agregaDibujo (imagen_marca_retrato);
         for (int indc = 0; indc < PresenciaActuante::cuentaHabilidades; ++ indc) {
-            actor_tablero->agregaDibujo (imagen_marca_habilidad [indc]);
+            nodo_panel.agregaDibujo (imagen_marca_habilidad [indc]);
         }
     }
 
@@ -205,19 +213,15 @@ namespace tapete {
         //
         this->personaje_mostrado = personaje;
 
-        imagen_marco_personaje->ponVisible (true);
+        nodo_panel.ponVisible (true);
 
+        // el retrato y las habilidades son del personaje y se situan respecto al actor
         unir2d::Imagen * retrato = personaje->presencia ().imagenRetrato ();
-        retrato->ponPosicion (panel_abajo.posicion () + Vector {2, 22});
+        retrato->ponPosicion (nodo_panel.posicion () + Vector {2, 22});
         retrato->ponVisible (true);
 
         for (int indc = 0; indc < cuentaPuntosAccion; ++ indc) {
             imagen_luces_punto_accion [indc]->seleccionaEstampa (1, 1);
-            imagen_luces_punto_accion [indc]->ponVisible (true);
-        }
-
-        for (int indc = 0; indc < cuentaHabilidades; ++ indc) {
-            imagen_marco_habilidad [indc]->ponVisible (true);
         }
 
 
@@ -226,8 +230,9 @@ namespace tapete {
         std::vector <unir2d::Imagen *> lista_fonds = 
                 actor_tablero->presencia_habilidades.imagenesFondosHabilidad (personaje);
         for (int indc = 0; indc < lista_habld.size (); ++ indc) {
-            lista_habld [indc]->ponPosicion (imagen_marco_habilidad [indc]->posicion () + Vector {2, 2});
-            lista_fonds [indc]->ponPosicion (imagen_marco_habilidad [indc]->posicion () + Vector {2, 2});
+            Vector poscn = nodo_panel.posicion () + imagen_marco_habilidad [indc]->posicion ();
+            lista_habld [indc]->ponPosicion (poscn + Vector {2, 2});
+            lista_fonds [indc]->ponPosicion (poscn + Vector {2, 2});
             lista_habld [indc]->ponVisible (true);
             lista_fonds [indc]->ponVisible (true);
         }
@@ -241,7 +246,6 @@ namespace tapete {
         //}      
 
         imagen_barra_vida->seleccionaEstampa (indiceBarraVida (), 1);
-        imagen_barra_vida->ponVisible (true);
         //
         visible_ = true;
     }
@@ -250,19 +254,11 @@ namespace tapete {
     void PresenciaActuante::oculta () {
         aserta (visible_, "presencia no visible");
         //
-        imagen_marco_personaje->ponVisible (false);
+        nodo_panel.ponVisible (false);
 
         unir2d::Imagen * retrato = personaje_mostrado->presencia ().imagenRetrato ();
         retrato->ponVisible (false);
 
-        for (int indc = 0; indc < cuentaPuntosAccion; ++ indc) {
-            imagen_luces_punto_accion [indc]->ponVisible (false);
-        }
-
-        for (int indc = 0; indc < cuentaHabilidades; ++ indc) {
-            imagen_marco_habilidad [indc]->ponVisible (false);
-        }
-
         std::vector <unir2d::Imagen *> lista_habld = 
                 actor_tablero->presencia_habilidades.imagenesHabilidades (personaje_mostrado);
         std::vector <unir2d::Imagen *> lista_fonds = 
@@ -276,12 +272,7 @@ namespace tapete {
         //            actor_tablero->presencia_habilidades.imagenesHabilidades (personaje_mostrado)) {
         //    imagen->ponVisible (false);
         //}
-        imagen_barra_vida->ponVisible (false);
-        //
-        imagen_marca_retrato->ponVisible (false);
-        for (int indc = 0; indc < PresenciaActuante::cuentaHabilidades; ++ indc) {
-            imagen_marca_habilidad [indc]->ponVisible (false);
-        }
+        desmarcaRetratoHabilidad ();
         //
         visible_ = false;
         personaje_mostrado = nullptr;
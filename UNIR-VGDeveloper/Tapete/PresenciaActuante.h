@@ -38,6 +38,9 @@ namespace tapete {
         Region                                 panel_retrato {};
         std::array <Region, cuentaHabilidades> paneles_habilidad {};
 
+        // los elementos propios del panel se situan respecto a este nodo, que los muestra y oculta
+        unir2d::Nodo nodo_panel {};
+
         inline static unir2d::Textura * textura_marco_personaje {};
         unir2d::Imagen *                imagen_marco_personaje {};
 
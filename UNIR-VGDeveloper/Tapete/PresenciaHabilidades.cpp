@@ -30,6 +30,7 @@ namespace tapete {
 
 
     void PresenciaHabilidades::prepara () {
+        unir2d::RegistroRecursos::Propietario propietario {"PresenciaHabilidades"};
         texturas_fondos     .resize (actor_tablero->juego->habilidades ().size ());
         texturas_habilidades.resize (actor_tablero->juego->habilidades ().size ());
         for (int indc = 0; indc < texturas_habilidades.size (); ++ indc) {
@@ -62,6 +63,8 @@ namespace tapete {
             Habilidad * habld = actor_tablero->juego->habilidades () [indc];
             sonidos_habilidades [indc] = new unir2d::Sonido {};
             sonidos_habilidades [indc]->carga (habld->archivoSonido ());
+            // las habilidades no deben perder su voz frente a los sonidos de desplazamiento
+            sonidos_habilidades [indc]->ponPrioridad (1);
         }
     }
 
@@ -20,6 +20,7 @@ namespace tapete {
 
 
     void PresenciaPersonaje::prepara () {
+        unir2d::RegistroRecursos::Propietario propietario {"PresenciaPersonaje"};
         //
         textura_retrato = new unir2d::Textura ();
         textura_retrato->carga (actor_personaje->archivo_retrato);
@@ -37,9 +38,16 @@ namespace tapete {
 
 
     void PresenciaPersonaje::libera () {
+        // los dibujos se destruyen antes que las texturas que usan
+        lote_dibujos.libera ();
+        imagen_ficha            = nullptr;
+        imagen_retrato_actuante = nullptr;
+        imagen_barra_vida       = nullptr;
+        imagen_marco_retrato    = nullptr;
+        imagen_retrato_lateral  = nullptr;
+        fondo_retrato           = nullptr;
+        imagen_titulo           = nullptr;
         //
-        delete imagen_ficha;
-        imagen_ficha = nullptr;
         delete textura_ficha;
         textura_ficha = nullptr;
         //
@@ -59,31 +67,18 @@ namespace tapete {
         //}
         //imagenes_habilidad_actuante.clear ();
         //
-        delete imagen_retrato_actuante;
-        imagen_retrato_actuante = nullptr;
-        //
-        delete imagen_barra_vida;
-        imagen_barra_vida = nullptr;
         if (textura_barras_vida->cuentaUsos () == 0) {
             delete textura_barras_vida;
             textura_barras_vida = nullptr;
         }      
         //
-        delete imagen_marco_retrato;
-        imagen_marco_retrato = nullptr;
         if (textura_marco_retrato->cuentaUsos () == 0) {
             delete textura_marco_retrato;
             textura_marco_retrato = nullptr;
         }
-        delete imagen_retrato_lateral;
-        imagen_retrato_lateral = nullptr;
-        delete fondo_retrato;
-        fondo_retrato = nullptr;
         //
 //        delete texto_nombre;
 //        texto_nombre = nullptr;
-        delete imagen_titulo;
-        imagen_titulo = nullptr;
         if (textura_titulos->cuentaUsos () == 0) {
             delete textura_titulos;
             textura_titulos = nullptr;
@@ -156,7 +151,7 @@ namespace tapete {
             texto_nombr = nullptr;
         }
         //
-        imagen_titulo = new unir2d::Imagen {};
+        imagen_titulo = lote_dibujos.crea <unir2d::Imagen> ();
         imagen_titulo->asigna (textura_titulos);
         imagen_titulo->defineEstampas (filas_plnch, colns_plnch);
         int coln;
@@ -174,11 +169,11 @@ namespace tapete {
 
 
     void PresenciaPersonaje::preparaRetratoLateral () {
-        fondo_retrato = new unir2d::Rectangulo {80, 80};
+        fondo_retrato = lote_dibujos.crea <unir2d::Rectangulo> (80, 80);
         fondo_retrato->ponPosicion (panel_lateral.posicion () + Vector {6, 26});
         fondo_retrato->ponColor (Color {0x50, 0x50, 0x50});
         //
-        imagen_retrato_lateral = new unir2d::Imagen ();
+        imagen_retrato_lateral = lote_dibujos.crea <unir2d::Imagen> ();
         imagen_retrato_lateral->ponPosicion (panel_lateral.posicion () + Vector {10, 30});
         imagen_retrato_lateral->asigna (textura_retrato);
         //
@@ -186,7 +181,7 @@ namespace tapete {
             textura_marco_retrato = new unir2d::Textura {};
             textura_marco_retrato->carga (JuegoMesaBase::carpetaActivos () + "marco_75.png");
         }
-        imagen_marco_retrato = new unir2d::Imagen ();
+        imagen_marco_retrato = lote_dibujos.crea <unir2d::Imagen> ();
         imagen_marco_retrato->ponPosicion (panel_lateral.posicion () + Vector {0, 20});
         imagen_marco_retrato->asigna (textura_marco_retrato);
         //
@@ -209,7 +204,7 @@ namespace tapete {
             textura_barras_vida = new unir2d::Textura {};
             textura_barras_vida->carga (JuegoMesaBase::carpetaActivos () + "barras_vida.png");
         }
-        imagen_barra_vida = new unir2d::Imagen {};
+        imagen_barra_vida = lote_dibujos.crea <unir2d::Imagen> ();
         imagen_barra_vida->asigna (textura_barras_vida);
         imagen_barra_vida->defineEstampas (cuentaBarrasVida, 1);
         imagen_barra_vida->seleccionaEstampa (indiceBarraVida (), 1);
@@ -220,7 +215,7 @@ namespace tapete {
 
 
     void PresenciaPersonaje::preparaRetratoActuante () {
-        imagen_retrato_actuante = new unir2d::Imagen ();
+        imagen_retrato_actuante = lote_dibujos.crea <unir2d::Imagen> ();
         //imagen_retrato_actuante->ponPosicion (panel_lateral.posicion () + Vector {10, 38});
         imagen_retrato_actuante->asigna (textura_retrato);
         imagen_retrato_actuante->ponVisible (false);
@@ -232,7 +227,7 @@ namespace tapete {
     void PresenciaPersonaje::preparaFicha () {
         textura_ficha = new unir2d::Textura {};
         textura_ficha->carga (actor_personaje->archivoFicha ());
-        imagen_ficha = new unir2d::Imagen {};
+        imagen_ficha = lote_dibujos.crea <unir2d::Imagen> ();
         imagen_ficha->asigna (textura_ficha);
         //
         actor_personaje->agregaDibujo (imagen_ficha);
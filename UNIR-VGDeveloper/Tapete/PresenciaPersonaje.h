@@ -38,6 +38,9 @@ namespace tapete {
 
         unir2d::Textura * textura_retrato {};
 
+        // dibujos de la presencia, que se destruyen juntos
+        unir2d::LoteDibujos lote_dibujos {};
+
         inline static unir2d::Textura * textura_titulos {};
         unir2d::Imagen *                imagen_titulo {};
 
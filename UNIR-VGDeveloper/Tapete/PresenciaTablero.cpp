@@ -20,6 +20,7 @@ namespace tapete {
 
 
     void PresenciaTablero::prepara () {
+        unir2d::RegistroRecursos::Propietario propietario {"PresenciaTablero"};
         preparaBaldosas ();
         preparaMuros    (); 
         preparaPaneles  (); 
@@ -75,8 +76,7 @@ namespace tapete {
         baldosas_fondo->defineSuperficie (filas_superf, colns_superf);
         std::vector <uint32_t> mapeo {};
         mapeo.resize (static_cast <int> (filas_superf * colns_superf));
-	    std::random_device semilla {};
-        std::mt19937 generador {semilla ()};
+        std::mt19937 generador {actor_tablero->juego->semilla ()};
 	    std::uniform_int_distribution <unsigned int> distrb_filas {0, filas_estamp - 1};
 	    std::uniform_int_distribution <unsigned int> distrb_colns {0, colns_estamp - 1};
         for (int f_s = 0; f_s < filas_superf; ++ f_s) {
@@ -252,45 +252,21 @@ namespace tapete {
         //      por arriba y en el sentido de las agujas del reloj
         // índice 3: los triángulos se definen con 3 puntos, incluyendo en centro del hexágono y 2 
         //      vértices consecutivos
-        puntos_rejilla.resize (posiciones_rejilla.size ());
-        std::vector <Vector> punto_hexgn {RejillaTablero::puntosHexagono};
-        for (int indc_celda = 0; indc_celda < posiciones_rejilla.size (); ++ indc_celda) {
-            for (int indc_hexgn = 0; indc_hexgn < RejillaTablero::puntosHexagono; ++ indc_hexgn) {
-                Vector punto;
-                if (indc_hexgn == 0) {
-                    punto = RejillaTablero::centroHexagono (posiciones_rejilla [indc_celda]);
-                } else {
-                    punto = RejillaTablero::verticeHexagono (posiciones_rejilla [indc_celda], indc_hexgn);
-                }
-                punto_hexgn [indc_hexgn] = Vector {punto.x (), punto.y ()};
+        size_t total_celdas = posiciones_rejilla.size ();
+        puntos_rejilla.resize (total_celdas);
+        //
+        // los centros y los vértices se calculan en bloque
+        RejillaTablero::PuntosCeldas punto_hexgn;
+        RejillaTablero::calculaHexagonos (posiciones_rejilla, punto_hexgn);
+        //
+        for (size_t indc_celda = 0; indc_celda < total_celdas; ++ indc_celda) {
+            Vector centro = punto_hexgn [0].vector (indc_celda);
+            for (int indc_trngl = 0; indc_trngl < 6; ++ indc_trngl) {
+                puntos_rejilla [indc_celda] [indc_trngl] = {
+                        centro,
+                        punto_hexgn [indc_trngl + 1].vector (indc_celda),
+                        punto_hexgn [(indc_trngl + 1) % 6 + 1].vector (indc_celda) };
             }
-    //for (int indc_hexgn = 0; indc_hexgn < puntos_hexagono; ++ indc_hexgn) {
-    //    std::cout << "(" << punto_hexgn [indc_hexgn].x << "," << punto_hexgn [indc_hexgn].y << ")" << std::endl;
-    //}
-            puntos_rejilla [indc_celda] [0] = {
-                    punto_hexgn [0],
-                    punto_hexgn [1],
-                    punto_hexgn [2] };
-            puntos_rejilla [indc_celda] [1] = {
-                    punto_hexgn [0],
-                    punto_hexgn [2],
-                    punto_hexgn [3] };
-            puntos_rejilla [indc_celda] [2] = {
-                    punto_hexgn [0],
-                    punto_hexgn [3],
-                    punto_hexgn [4] };
-            puntos_rejilla [indc_celda] [3] = {
-                    punto_hexgn [0],
-                    punto_hexgn [4],
-                    punto_hexgn [5] };
-            puntos_rejilla [indc_celda] [4] = {
-                    punto_hexgn [0],
-                    punto_hexgn [5],
-                    punto_hexgn [6] };
-            puntos_rejilla [indc_celda] [5] = {
-                    punto_hexgn [0],
-                    punto_hexgn [6],
-                    punto_hexgn [1] };
         }
     }
 
@@ -299,18 +275,21 @@ namespace tapete {
                     const PuntosHexagonos & puntos_rejilla,
                     const IndicesEstampas & indices_estampas,
                     const PuntosHexagonos & puntos_textura   ) {
-        this->malla_muros->define ((int) puntos_rejilla.size () * 6);
+        // se construye la malla de una vez; los vértices repetidos se sueldan en la malla
+        std::vector <Vector> puntos {};
+        std::vector <Vector> texels {};
+        puntos.reserve (puntos_rejilla.size () * 6 * 3);
+        texels.reserve (puntos_rejilla.size () * 6 * 3);
         for (int indc_celda = 0; indc_celda < puntos_rejilla.size (); ++ indc_celda) {
             for (int indc_trngl = 0; indc_trngl < 6; ++ indc_trngl) {
-                unir2d::TrianguloMalla trngl_malla {};
+                int indc_estmp = indices_estampas [indc_celda] [indc_trngl]; 
                 for (int indc_vertc = 0; indc_vertc < 3; ++ indc_vertc) {
-                    trngl_malla.ponPunto (indc_vertc, puntos_rejilla [indc_celda] [indc_trngl] [indc_vertc]);
-                    int indc_estmp = indices_estampas [indc_celda] [indc_trngl]; 
-                    trngl_malla.ponTexel (indc_vertc, puntos_textura [indc_estmp] [indc_trngl] [indc_vertc]);
+                    puntos.push_back (puntos_rejilla [indc_celda] [indc_trngl] [indc_vertc]);
+                    texels.push_back (puntos_textura [indc_estmp] [indc_trngl] [indc_vertc]);
                 }
-                this->malla_muros->asigna (indc_celda * 6 + indc_trngl, trngl_malla);
             }
         }
+        this->malla_muros->construye (puntos, texels);
     }
 
 
@@ -401,13 +380,13 @@ namespace tapete {
         textura_fondo_monitor = new unir2d::Textura {};
         textura_fondo_monitor->carga (JuegoMesaBase::carpetaActivos () + "monitor_fondo.png");
         //
-        imagen_fondo_monitor = new unir2d::Imagen {};
+        imagen_fondo_monitor = lote_monitor.crea <unir2d::Imagen> ();
         imagen_fondo_monitor->asigna (textura_fondo_monitor);
         imagen_fondo_monitor->ponPosicion (poscn);
         //
         poscn += Vector {9, 9};
         for (int indc = 0; indc < lineas_texto_monitor; ++ indc) {
-            texto_monitor [indc] = new unir2d::Texto ("DejaVuSansMono");
+            texto_monitor [indc] = lote_monitor.crea <unir2d::Texto> ("DejaVuSansMono");
             texto_monitor [indc]->ponTamano (12);
             texto_monitor [indc]->ponColor (fosforo_verde);
             texto_monitor [indc]->ponCadena ("Hola gente.");
@@ -418,11 +397,8 @@ namespace tapete {
 
 
     void PresenciaTablero::liberaMonitor () {
-        for (int indc = 0; indc < lineas_texto_monitor; ++ indc) {
-            delete texto_monitor [indc];
-            texto_monitor [indc] = nullptr;
-        }        
-        delete imagen_fondo_monitor;
+        lote_monitor.libera ();
+        texto_monitor.fill (nullptr);
         imagen_fondo_monitor = nullptr;
         delete textura_fondo_monitor;
         textura_fondo_monitor = nullptr;
@@ -79,6 +79,7 @@ namespace tapete {
         static constexpr Color fosforo_verde {60, 252, 117};
         unir2d::Textura * textura_fondo_monitor {};
         unir2d::Imagen  * imagen_fondo_monitor {};
+        unir2d::LoteDibujos lote_monitor {};
         static constexpr int lineas_texto_monitor = 7;
         std::array <unir2d::Texto *, lineas_texto_monitor> texto_monitor {};
 
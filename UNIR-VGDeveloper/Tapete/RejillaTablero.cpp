@@ -42,6 +42,32 @@ namespace tapete {
     }
 
 
+    void RejillaTablero::calculaHexagonos (const std::vector <Coord> & celdas, PuntosCeldas & puntos) {
+        // los centros se obtienen de las coordenadas con una transformación afín (ver 
+        // 'centroHexagono') y los vértices trasladando los centros (ver 'verticeHexagono')
+        constexpr float lado = ladoHexagono;
+        constexpr float seno = seno60;
+        puntos [0].redimensiona (0);
+        puntos [0].reserva (celdas.size ());
+        for (const Coord & coord : celdas) {
+            puntos [0].agrega (Vector {coord});
+        }
+        puntos [0].transforma (Vector {1.5f * lado, 0.0f}, Vector {0.0f, seno * lado}, Vector {- 0.5f * lado, 0.0f});
+        constexpr std::array <Vector, puntosHexagono> desplazamiento {
+                Vector {  0.0f,          0.0f},
+                Vector {- 0.5f * lado, - seno * lado},
+                Vector {  0.5f * lado, - seno * lado},
+                Vector {  1.0f * lado,   0.0f},
+                Vector {  0.5f * lado,   seno * lado},
+                Vector {- 0.5f * lado,   seno * lado},
+                Vector {- 1.0f * lado,   0.0f} };
+        for (int indc_hexgn = 1; indc_hexgn < puntosHexagono; ++ indc_hexgn) {
+            puntos [indc_hexgn] = puntos [0];
+            puntos [indc_hexgn].traslada (desplazamiento [indc_hexgn]);
+        }
+    }
+
+
     RejillaTablero::RejillaTablero (ActorTablero * actor_tablero) {
         this->actor_tablero = actor_tablero;
     }
@@ -166,32 +192,18 @@ namespace tapete {
 
 
     void RejillaTablero::prepara () {
+        unir2d::RegistroRecursos::Propietario propietario {"RejillaTablero"};
         //------------------------------------------------------------
         trazos_rejilla = new unir2d::Trazos {};
         trazos_rejilla->ponPosicion (PresenciaTablero::regionRejilla.posicion ());
         Color color {0x80, 0xC0, 0x80};
+        std::vector <Coord> celdas {};
         bool fila_par = true;
         for (int fila = 0; fila <= filas + 2; ++ fila) {
             bool coln_par = true;
             for (int coln = 0; coln <= columnas + 1; ++ coln) {
                 if (fila_par == coln_par) {
-                    Coord coord {fila, coln};
-                    Vector punto1 = verticeHexagono (coord, 1);
-                    Vector punto2 = verticeHexagono (coord, 2);
-                    Vector punto3 = verticeHexagono (coord, 3);
-                    Vector punto4 = verticeHexagono (coord, 4);
-                    if (1 <= fila && fila <= filas + 2 &&
-                        1 <= coln && coln <= columnas    ) {
-                        trazos_rejilla->agrega (unir2d::TrazoLinea {punto1, punto2, color});
-                    }
-                    if (1 <= fila && fila <= filas + 1 && 
-                        0 <= coln && coln <= columnas    ) {
-                        trazos_rejilla->agrega (unir2d::TrazoLinea {punto2, punto3, color});
-                    }
-                    if (0 <= fila && fila <= filas && 
-                        0 <= coln && coln <= columnas) {
-                        trazos_rejilla->agrega (unir2d::TrazoLinea {punto3, punto4, color});
-                    }
+                    celdas.push_back (Coord {fila, coln});
                 }
                 if (coln_par) {
                     coln_par = false;
@@ -205,6 +217,28 @@ namespace tapete {
                 fila_par = true;
             }
         }
+        PuntosCeldas puntos;
+        calculaHexagonos (celdas, puntos);
+        for (size_t indice = 0; indice < celdas.size (); ++ indice) {
+            int fila = celdas [indice].fila ();
+            int coln = celdas [indice].coln ();
+            Vector punto1 = puntos [1].vector (indice);
+            Vector punto2 = puntos [2].vector (indice);
+            Vector punto3 = puntos [3].vector (indice);
+            Vector punto4 = puntos [4].vector (indice);
+            if (1 <= fila && fila <= filas + 2 &&
+                1 <= coln && coln <= columnas    ) {
+                trazos_rejilla->agrega (unir2d::TrazoLinea {punto1, punto2, color});
+            }
+            if (1 <= fila && fila <= filas + 1 && 
+                0 <= coln && coln <= columnas    ) {
+                trazos_rejilla->agrega (unir2d::TrazoLinea {punto2, punto3, color});
+            }
+            if (0 <= fila && fila <= filas && 
+                0 <= coln && coln <= columnas) {
+                trazos_rejilla->agrega (unir2d::TrazoLinea {punto3, punto4, color});
+            }
+        }
         //------------------------------------------------------------
         trazos_marcaje = new unir2d::Trazos {};
         trazos_marcaje->ponPosicion (PresenciaTablero::regionRejilla.posicion ());
@@ -273,21 +307,27 @@ namespace tapete {
         if (! cambio_trazos_marcaje) {
             return;
         }
+        cambio_trazos_marcaje = false;
         trazos_marcaje->borraLineas ();
-        for (MarcajeCelda marcj : marcaje_celdas) {
-            trazaHexagono (marcj);
+        // las tablas se conservan entre llamadas, para no reservar memoria en cada refresco
+        celdas_marcaje.clear ();
+        for (const MarcajeCelda & marcj : marcaje_celdas) {
+            celdas_marcaje.push_back (marcj.posicion);
+        }
+        calculaHexagonos (celdas_marcaje, puntos_marcaje);
+        for (size_t indice = 0; indice < marcaje_celdas.size (); ++ indice) {
+            trazaHexagono (marcaje_celdas [indice], puntos_marcaje, indice);
         }
     }
 
 
-    void RejillaTablero::trazaHexagono (const MarcajeCelda & marcaje) {
-        Vector centro = centroHexagono (marcaje.posicion);
-        Vector punto1 = verticeHexagono (marcaje.posicion, 1);
-        Vector punto2 = verticeHexagono (marcaje.posicion, 2);
-        Vector punto3 = verticeHexagono (marcaje.posicion, 3);
-        Vector punto4 = verticeHexagono (marcaje.posicion, 4);
-        Vector punto5 = verticeHexagono (marcaje.posicion, 5);
-        Vector punto6 = verticeHexagono (marcaje.posicion, 6);
+    void RejillaTablero::trazaHexagono (const MarcajeCelda & marcaje, const PuntosCeldas & puntos, size_t indice) {
+        Vector punto1 = puntos [1].vector (indice);
+        Vector punto2 = puntos [2].vector (indice);
+        Vector punto3 = puntos [3].vector (indice);
+        Vector punto4 = puntos [4].vector (indice);
+        Vector punto5 = puntos [5].vector (indice);
+        Vector punto6 = puntos [6].vector (indice);
         punto1 += Vector { 1,  1};
         punto2 += Vector {-1,  1};
         punto3 += Vector {-1,  0};
@@ -37,6 +37,11 @@ namespace tapete {
 
         static constexpr int   puntosHexagono = 7;
 
+        // centros (índice 0) y vértices (índices 1 a 6, ver 'verticeHexagono') de los hexágonos 
+        // de varias celdas, calculados en bloque
+        using PuntosCeldas = std::array <unir2d::LoteVectores, puntosHexagono>;
+        static void calculaHexagonos (const std::vector <Coord> & celdas, PuntosCeldas & puntos);
+
 
         ActorTablero * actor_tablero;
 
@@ -51,6 +56,8 @@ namespace tapete {
 
         unir2d::Trazos * trazos_marcaje {};
         bool             cambio_trazos_marcaje {};
+        std::vector <Coord> celdas_marcaje {};
+        PuntosCeldas        puntos_marcaje;
 
 
         explicit RejillaTablero (ActorTablero * actor_tablero);
@@ -62,7 +69,7 @@ namespace tapete {
         std::vector <MarcajeCelda>::iterator buscaMarcaCelda (Coord posicion);
 
         void refrescaMarcaje ();
-        void trazaHexagono (const MarcajeCelda & marcaje);
+        void trazaHexagono (const MarcajeCelda & marcaje, const PuntosCeldas & puntos, size_t indice);
 
 
         friend class ActorTablero;
@@ -159,7 +159,7 @@ namespace tapete {
     void SistemaAtaque::calcula (
             ActorPersonaje *               atacante, 
             Habilidad *                    habilidad,
-            std::vector <ActorPersonaje *> lista_oponentes, 
+            const unir2d::VectorCiclo <ActorPersonaje *> & lista_oponentes, 
             int                            aleatorio_100) {
         assert (habilidad->tipoEnfoque () == EnfoqueHabilidad::area);
         assert (habilidad->tipoAcceso  () == AccesoHabilidad::directo ||
@@ -344,17 +344,5 @@ namespace tapete {
     }
 
 
-    void SucesosJuegoComun::alarmaCalculo (unir2d::Tiempo & tiempo) {
-        switch (modo ()->estado ()) {
-        case EstadoJuegoComun::oponenteHabilidadCalculando:
-            modo ()->calculaHabilidadOponente (tiempo);
-            break;
-        case EstadoJuegoComun::areaHabilidadCalculando:
-            modo ()->calculaHabilidadArea (tiempo);
-            break;
-        }
-    }
-
-
 }
 
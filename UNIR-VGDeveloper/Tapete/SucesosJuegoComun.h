@@ -49,8 +49,6 @@ namespace tapete {
         virtual void pulsadoArriba  ();
         virtual void pulsadoAbajo   ();
 
-        virtual void alarmaCalculo (unir2d::Tiempo & tiempo);
-
     private:
 
         JuegoMesaBase *  juego_ {};
@@ -25,6 +25,7 @@ namespace tapete {
 
 
     void VistaCaminoCeldas::prepara () {
+        unir2d::RegistroRecursos::Propietario propietario {"VistaCaminoCeldas"};
         if (textura_mdiana == nullptr) {
             textura_mdiana = new unir2d::Textura {};
             textura_mdiana->carga (JuegoMesaBase::carpetaActivos () + "microdiana.png");